@@ -34,6 +34,24 @@
 extern "C" {
 #endif
 
+/**
+ * @brief   Number of times @ref mutex_lock polls a locked mutex before
+ *          blocking
+ *
+ * Blocking costs two context switches, which can take longer than the
+ * critical section of a short-lived lock. With this set to a non-zero value,
+ * the caller first polls the mutex with interrupts enabled and only blocks if
+ * it is still locked afterwards.
+ *
+ * As long as the caller is spinning, no other thread of the same or a lower
+ * priority can run. On a single core this only pays off if the mutex is
+ * released from an ISR, e.g. when it signals the completion of a short
+ * transfer, so the default is to not spin at all.
+ */
+#ifndef CONFIG_MUTEX_LOCK_SPIN
+#define CONFIG_MUTEX_LOCK_SPIN      0
+#endif
+
 /**
  * @brief Mutex structure. Must never be modified by the user.
  */
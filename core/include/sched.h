@@ -194,6 +194,19 @@ typedef enum {
 #define SCHED_PRIO_LEVELS 16
 #endif
 
+/**
+ * @def CONFIG_SCHED_EDF_PRIO
+ * @brief The priority level at which threads are scheduled earliest deadline
+ *        first when the `sched_edf` module is used
+ *
+ * Threads of this priority are kept in their run queue ordered by
+ * thread_t::deadline instead of in FIFO order. Threads without a deadline
+ * are queued behind all threads that have one.
+ */
+#ifndef CONFIG_SCHED_EDF_PRIO
+#define CONFIG_SCHED_EDF_PRIO   (THREAD_PRIORITY_MAIN - 1)
+#endif
+
 /**
  * @brief   Triggers the scheduler to schedule the next thread
  *
@@ -270,6 +283,22 @@ NORETURN void sched_task_exit(void);
  */
 void sched_change_priority(thread_t *thread, uint8_t priority);
 
+#if IS_USED(MODULE_SCHED_EDF) || defined(DOXYGEN)
+/**
+ * @brief   Set the deadline of the given thread
+ *
+ * If @p thread is in the run queue of @ref CONFIG_SCHED_EDF_PRIO, it is
+ * moved to the position of its new deadline. This does not invoke the
+ * scheduler.
+ *
+ * @pre     (thread != NULL)
+ *
+ * @param[in,out] thread    target thread
+ * @param[in]     deadline  new absolute deadline of @p thread, 0 for none
+ */
+void sched_set_deadline(thread_t *thread, uint32_t deadline);
+#endif
+
 /**
  * @brief  Set CPU to idle mode (CPU dependent)
  *
@@ -320,10 +349,15 @@ void sched_register_cb(sched_callback_t callback);
  * @param   prio      The priority of the runqueue to advance
  *
  */
+#if IS_USED(MODULE_SCHED_EDF)
+/* keeps the EDF run queue ordered by deadline */
+void sched_runq_advance(uint8_t prio);
+#else
 static inline void sched_runq_advance(uint8_t prio)
 {
     clist_lpoprpush(&sched_runqueues[prio]);
 }
+#endif
 
 #if (IS_USED(MODULE_SCHED_RUNQ_CALLBACK)) || defined(DOXYGEN)
 /**
@@ -206,6 +206,11 @@ struct _thread {
 #ifdef PICOLIBC_TLS
     void *tls;                      /**< thread local storage ptr */
 #endif
+#if defined(MODULE_SCHED_EDF) || defined(DOXYGEN)
+    uint32_t deadline;              /**< absolute deadline for earliest
+                                         deadline first scheduling, 0 if
+                                         none                           */
+#endif
 };
 
 /**
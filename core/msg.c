@@ -35,6 +35,9 @@
 #endif
 #include "irq.h"
 #include "cib.h"
+#if IS_USED(MODULE_TRACE_MSG)
+#include "trace.h"
+#endif
 
 #define ENABLE_DEBUG 0
 #include "debug.h"
@@ -105,6 +108,10 @@ static int _msg_send(msg_t *m, kernel_pid_t target_pid, bool block,
         return -1;
     }
 
+#if IS_USED(MODULE_TRACE_MSG)
+    trace_event(TRACE_MSG_SEND, target_pid, m->type);
+#endif
+
     thread_t *me = thread_get_active();
 
     DEBUG("msg_send() %s:%i: Sending from %" PRIkernel_pid " to %" PRIkernel_pid
@@ -209,6 +216,10 @@ static int _msg_send_oneway(msg_t *m, kernel_pid_t target_pid)
         return -1;
     }
 
+#if IS_USED(MODULE_TRACE_MSG)
+    trace_event(TRACE_MSG_SEND, target_pid, m->type);
+#endif
+
     if (target->status == STATUS_RECEIVE_BLOCKED) {
         DEBUG("%s: Direct msg copy from %" PRIkernel_pid " to %"
               PRIkernel_pid ".\n", __func__, thread_getpid(), target_pid);
@@ -308,6 +319,9 @@ int msg_reply(msg_t *m, msg_t *reply)
 
     DEBUG("msg_reply(): %" PRIkernel_pid ": Direct msg copy.\n",
           thread_getpid());
+#if IS_USED(MODULE_TRACE_MSG)
+    trace_event(TRACE_MSG_SEND, target->pid, reply->type);
+#endif
     /* copy msg to target */
     msg_t *target_message = (msg_t *)target->wait_data;
 
@@ -335,6 +349,9 @@ int msg_reply_int(msg_t *m, msg_t *reply)
         return -1;
     }
 
+#if IS_USED(MODULE_TRACE_MSG)
+    trace_event(TRACE_MSG_SEND, target->pid, reply->type);
+#endif
     msg_t *target_message = (msg_t *)target->wait_data;
 
     *target_message = *reply;
@@ -343,14 +360,26 @@ int msg_reply_int(msg_t *m, msg_t *reply)
     return 1;
 }
 
+static inline int _msg_receive_traced(msg_t *m, int block)
+{
+    int res = _msg_receive(m, block);
+
+#if IS_USED(MODULE_TRACE_MSG)
+    if (res == 1) {
+        trace_event(TRACE_MSG_RECV, m->sender_pid, m->type);
+    }
+#endif
+    return res;
+}
+
 int msg_try_receive(msg_t *m)
 {
-    return _msg_receive(m, 0);
+    return _msg_receive_traced(m, 0);
 }
 
 int msg_receive(msg_t *m)
 {
-    return _msg_receive(m, 1);
+    return _msg_receive_traced(m, 1);
 }
 
 static int _msg_receive(msg_t *m, int block)
@@ -31,11 +31,63 @@
 #include "irq.h"
 #include "list.h"
 
+#if IS_USED(MODULE_MUTEX_PROFILING)
+#include "mutex_profiling.h"
+#endif
+
 #define ENABLE_DEBUG 0
 #include "debug.h"
 
 #if MAXTHREADS > 1
 
+/**
+ * @brief   Prepare waiting for a locked mutex
+ * @pre     IRQs are enabled
+ *
+ * Polls the mutex up to @ref CONFIG_MUTEX_LOCK_SPIN times and returns the
+ * time the wait started at for the contention profile.
+ */
+static inline __attribute__((always_inline))
+uint32_t _wait_start(mutex_t *mutex)
+{
+    uint32_t since = 0;
+
+#if IS_USED(MODULE_MUTEX_PROFILING)
+    since = mutex_profiling_now();
+#endif
+#if CONFIG_MUTEX_LOCK_SPIN > 0
+    for (unsigned i = 0; i < CONFIG_MUTEX_LOCK_SPIN; i++) {
+        if (*(list_node_t * volatile *)&mutex->queue.next == NULL) {
+            break;
+        }
+    }
+#else
+    (void)mutex;
+#endif
+    return since;
+}
+
+/**
+ * @brief   Record the acquisition of @p mutex in the contention profile
+ */
+static inline __attribute__((always_inline))
+void _acquired(mutex_t *mutex, uinttxtptr_t pc, bool waited, uint32_t since)
+{
+#if IS_USED(MODULE_MUTEX_PROFILING)
+    if (waited) {
+        mutex_profiling_contended(mutex, pc, since);
+    }
+    else {
+        mutex_profiling_acquired(mutex, pc);
+    }
+#else
+    (void)mutex;
+    (void)pc;
+    (void)waited;
+    (void)since;
+#endif
+}
+
 /**
  * @brief   Block waiting for a locked mutex
  * @pre     IRQs are disabled
@@ -53,7 +105,7 @@ void _block(mutex_t *mutex,
             unsigned irq_state,
             uinttxtptr_t pc)
 {
-    /* pc is only used when MODULE_CORE_MUTEX_DEBUG */
+    /* pc is only used when MODULE_CORE_MUTEX_DEBUG or MODULE_MUTEX_PROFILING */
     (void)pc;
 #if IS_USED(MODULE_CORE_MUTEX_DEBUG)
     printf("[mutex] waiting for thread %" PRIkernel_pid " (pc = 0x%" PRIxTXTPTR
@@ -98,9 +150,17 @@ void _block(mutex_t *mutex,
 bool mutex_lock_internal(mutex_t *mutex, bool block)
 {
     uinttxtptr_t pc = 0;
-#if IS_USED(MODULE_CORE_MUTEX_DEBUG)
+#if IS_USED(MODULE_CORE_MUTEX_DEBUG) || IS_USED(MODULE_MUTEX_PROFILING)
     pc = cpu_get_caller_pc();
 #endif
+    uint32_t since = 0;
+    bool waited = false;
+
+    if ((CONFIG_MUTEX_LOCK_SPIN || IS_USED(MODULE_MUTEX_PROFILING))
+        && block && (mutex->queue.next != NULL)) {
+        since = _wait_start(mutex);
+        waited = true;
+    }
     unsigned irq_state = irq_disable();
 
     DEBUG("PID[%" PRIkernel_pid "] mutex_lock_internal(block=%u).\n",
@@ -123,13 +183,21 @@ bool mutex_lock_internal(mutex_t *mutex, bool block)
         DEBUG("PID[%" PRIkernel_pid "] mutex_lock(): early out.\n",
               thread_getpid());
         irq_restore(irq_state);
+        _acquired(mutex, pc, waited, since);
     }
     else {
         if (!block) {
             irq_restore(irq_state);
             return false;
         }
+#if IS_USED(MODULE_MUTEX_PROFILING)
+        if (!waited) {
+            /* the mutex got locked in between, start the clock now */
+            since = mutex_profiling_now();
+        }
+#endif
         _block(mutex, irq_state, pc);
+        _acquired(mutex, pc, true, since);
     }
 
     return true;
@@ -138,9 +206,17 @@ bool mutex_lock_internal(mutex_t *mutex, bool block)
 int mutex_lock_cancelable(mutex_cancel_t *mc)
 {
     uinttxtptr_t pc = 0;
-#if IS_USED(MODULE_CORE_MUTEX_DEBUG)
+#if IS_USED(MODULE_CORE_MUTEX_DEBUG) || IS_USED(MODULE_MUTEX_PROFILING)
     pc = cpu_get_caller_pc();
 #endif
+    uint32_t since = 0;
+    bool waited = false;
+
+    if ((CONFIG_MUTEX_LOCK_SPIN || IS_USED(MODULE_MUTEX_PROFILING))
+        && (mc->mutex->queue.next != NULL)) {
+        since = _wait_start(mc->mutex);
+        waited = true;
+    }
     unsigned irq_state = irq_disable();
 
     DEBUG("PID[%" PRIkernel_pid "] mutex_lock_cancelable()\n",
@@ -172,15 +248,23 @@ int mutex_lock_cancelable(mutex_cancel_t *mc)
         DEBUG("PID[%" PRIkernel_pid "] mutex_lock_cancelable() early out.\n",
               thread_getpid());
         irq_restore(irq_state);
+        _acquired(mutex, pc, waited, since);
         return 0;
     }
     else {
+#if IS_USED(MODULE_MUTEX_PROFILING)
+        if (!waited) {
+            since = mutex_profiling_now();
+        }
+#endif
         _block(mutex, irq_state, pc);
         if (mc->cancelled) {
             DEBUG("PID[%" PRIkernel_pid "] mutex_lock_cancelable() "
                   "cancelled.\n", thread_getpid());
+            return -ECANCELED;
         }
-        return (mc->cancelled) ? -ECANCELED : 0;
+        _acquired(mutex, pc, true, since);
+        return 0;
     }
 }
 
@@ -197,6 +281,10 @@ void mutex_unlock(mutex_t *mutex)
         return;
     }
 
+#if IS_USED(MODULE_MUTEX_PROFILING)
+    mutex_profiling_released(mutex);
+#endif
+
     if (mutex->queue.next == MUTEX_LOCKED) {
         mutex->queue.next = NULL;
         /* the mutex was locked and no thread was waiting for it */
@@ -240,6 +328,9 @@ void mutex_unlock_and_sleep(mutex_t *mutex)
     unsigned irqstate = irq_disable();
 
     if (mutex->queue.next) {
+#if IS_USED(MODULE_MUTEX_PROFILING)
+        mutex_profiling_released(mutex);
+#endif
         if (mutex->queue.next == MUTEX_LOCKED) {
             mutex->queue.next = NULL;
         }
@@ -20,6 +20,7 @@
  * @}
  */
 
+#include <stdbool.h>
 #include <stdint.h>
 #include <inttypes.h>
 
@@ -36,6 +37,10 @@
 #include "mpu.h"
 #endif
 
+#if IS_USED(MODULE_TRACE_SCHED)
+#include "trace.h"
+#endif
+
 #define ENABLE_DEBUG 0
 #include "debug.h"
 
@@ -206,6 +211,11 @@ thread_t *__attribute__((used)) sched_run(void)
             sched_cb(KERNEL_PID_UNDEF, next_thread->pid);
         }
 #endif
+#if IS_USED(MODULE_TRACE_SCHED)
+        trace_event(TRACE_SCHED_SWITCH,
+                    previous_thread ? previous_thread->pid : KERNEL_PID_UNDEF,
+                    next_thread->pid);
+#endif
 
 #ifdef PICOLIBC_TLS
         _set_tls(next_thread->tls);
@@ -224,6 +234,54 @@ thread_t *__attribute__((used)) sched_run(void)
     return next_thread;
 }
 
+#if IS_USED(MODULE_SCHED_EDF)
+/* true if a has to run before b, threads without deadline go last */
+static bool _edf_before(const thread_t *a, const thread_t *b)
+{
+    if (!a->deadline) {
+        return false;
+    }
+    if (!b->deadline) {
+        return true;
+    }
+    return (int32_t)(a->deadline - b->deadline) < 0;
+}
+
+/* insert behind all threads not running after this one, keeping threads
+ * with equal deadlines in FIFO order */
+static void _edf_insert(clist_node_t *rq, thread_t *thread)
+{
+    clist_node_t *last = rq->next;
+
+    if (!last || !_edf_before(thread, container_of(last, thread_t, rq_entry))) {
+        clist_rpush(rq, &thread->rq_entry);
+        return;
+    }
+
+    clist_node_t *prev = last;
+    while (!_edf_before(thread, container_of(prev->next, thread_t, rq_entry))) {
+        prev = prev->next;
+    }
+    thread->rq_entry.next = prev->next;
+    prev->next = &thread->rq_entry;
+}
+
+void sched_runq_advance(uint8_t prio)
+{
+    clist_node_t *rq = &sched_runqueues[prio];
+
+    if (prio != CONFIG_SCHED_EDF_PRIO) {
+        clist_lpoprpush(rq);
+        return;
+    }
+
+    clist_node_t *head = clist_lpop(rq);
+    if (head) {
+        _edf_insert(rq, container_of(head, thread_t, rq_entry));
+    }
+}
+#endif
+
 /* Note: Forcing the compiler to inline this function will reduce .text for applications
  *       not linking in sched_change_priority(), which benefits the vast majority of apps.
  */
@@ -231,6 +289,12 @@ static inline __attribute__((always_inline)) void _runqueue_push(thread_t *threa
 {
     DEBUG("sched_set_status: adding thread %" PRIkernel_pid " to runqueue %" PRIu8 ".\n",
           thread->pid, priority);
+#if IS_USED(MODULE_SCHED_EDF)
+    if (priority == CONFIG_SCHED_EDF_PRIO) {
+        _edf_insert(&sched_runqueues[priority], thread);
+    }
+    else
+#endif
     clist_rpush(&sched_runqueues[priority], &(thread->rq_entry));
     _set_runqueue_bit(priority);
 
@@ -289,6 +353,15 @@ void sched_switch(uint16_t other_prio)
           active_thread->pid, current_prio, on_runqueue,
           other_prio);
 
+#if IS_USED(MODULE_SCHED_EDF)
+    /* a thread with an earlier deadline may have been queued in front */
+    if (on_runqueue && (current_prio == other_prio) &&
+        (current_prio == CONFIG_SCHED_EDF_PRIO) &&
+        (sched_runqueues[current_prio].next->next != &active_thread->rq_entry)) {
+        on_runqueue = 0;
+    }
+#endif
+
     if (!on_runqueue || (current_prio > other_prio)) {
         if (irq_is_in()) {
             DEBUG("sched_switch: setting sched_context_switch_request.\n");
@@ -332,6 +405,26 @@ void sched_register_cb(void (*callback)(kernel_pid_t, kernel_pid_t))
 }
 #endif
 
+#if IS_USED(MODULE_SCHED_EDF)
+void sched_set_deadline(thread_t *thread, uint32_t deadline)
+{
+    assert(thread);
+
+    unsigned irq_state = irq_disable();
+
+    if ((thread->priority == CONFIG_SCHED_EDF_PRIO) && thread_is_active(thread)) {
+        _runqueue_pop(thread);
+        thread->deadline = deadline;
+        _runqueue_push(thread, thread->priority);
+    }
+    else {
+        thread->deadline = deadline;
+    }
+
+    irq_restore(irq_state);
+}
+#endif
+
 void sched_change_priority(thread_t *thread, uint8_t priority)
 {
     assert(thread && (priority < SCHED_PRIO_LEVELS));
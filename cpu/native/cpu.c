@@ -210,6 +210,13 @@ void native_cpu_init(void)
     _end_context.uc_stack.ss_flags = 0;
     makecontext(&_end_context, sched_task_exit, 0);
 
+    /* All threads share this context and its stack. Block the signals until
+     * sched_task_exit() disables interrupts itself: a thread preempted in
+     * between would have its stack overwritten by the next exiting thread. */
+    if (sigfillset(&_end_context.uc_sigmask) == -1) {
+        err(EXIT_FAILURE, "native_cpu_init: sigfillset");
+    }
+
     (void)VALGRIND_STACK_REGISTER(_end_context.uc_stack.ss_sp,
                                   (char *)_end_context.uc_stack.ss_sp + _end_context.uc_stack.ss_size);
     VALGRIND_DEBUG("VALGRIND_STACK_REGISTER(%p, %p)\n",
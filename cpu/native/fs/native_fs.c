@@ -17,7 +17,9 @@
 #include <errno.h>
 #include <stdlib.h>
 #include <string.h>
+#include <sys/mman.h>
 
+#include "container.h"
 #include "mutex.h"
 #include "native_internal.h"
 #include "fs/native_fs.h"
@@ -40,6 +42,13 @@
 /* Reentrancy guard required by the various static locals of the implementation */
 static mutex_t _lock;
 
+/* Host files mapped into memory for direct access, protected by _lock */
+static struct {
+    const vfs_file_t *filp;
+    void *addr;
+    size_t len;
+} _maps[VFS_MAX_OPEN_FILES];
+
 static void _do_prefix(vfs_mount_t *mountp, const char *name, char *buffer, size_t len)
 {
     const native_desc_t *fs_desc = mountp->private_data;
@@ -163,6 +172,57 @@ static ssize_t _read(vfs_file_t *filp, void *dest, size_t nbytes)
     return real_read(FD(filep), dest, nbytes);
 }
 
+static ssize_t _read_extent(vfs_file_t *filp, const void **data, size_t nbytes)
+{
+    off_t pos = real_lseek(FD(filep), 0, SEEK_CUR);
+    unsigned idx = ARRAY_SIZE(_maps);
+    struct stat st;
+
+    if (pos < 0 || real_fstat(FD(filep), &st) < 0) {
+        return -errno;
+    }
+    if (!S_ISREG(st.st_mode)) {
+        return -ENOTSUP;
+    }
+    if (pos >= st.st_size) {
+        return 0;
+    }
+
+    mutex_lock(&_lock);
+    for (unsigned i = 0; i < ARRAY_SIZE(_maps); i++) {
+        if (_maps[i].filp == filp || (!_maps[i].filp && idx == ARRAY_SIZE(_maps))) {
+            idx = i;
+        }
+    }
+    if (idx == ARRAY_SIZE(_maps)) {
+        mutex_unlock(&_lock);
+        return -ENOTSUP;
+    }
+    if ((size_t)st.st_size > _maps[idx].len) {
+        /* the file grew, map it again */
+        void *addr = mmap(NULL, st.st_size, PROT_READ, MAP_SHARED, FD(filep), 0);
+        if (addr == MAP_FAILED) {
+            mutex_unlock(&_lock);
+            return -ENOTSUP;
+        }
+        if (_maps[idx].addr) {
+            munmap(_maps[idx].addr, _maps[idx].len);
+        }
+        _maps[idx].filp = filp;
+        _maps[idx].addr = addr;
+        _maps[idx].len = st.st_size;
+    }
+    mutex_unlock(&_lock);
+
+    if (nbytes > (size_t)(st.st_size - pos)) {
+        nbytes = st.st_size - pos;
+    }
+    *data = (uint8_t *)_maps[idx].addr + pos;
+    real_lseek(FD(filep), nbytes, SEEK_CUR);
+
+    return nbytes;
+}
+
 static ssize_t _write(vfs_file_t *filp, const void *src, size_t nbytes)
 {
     return real_write(FD(filep), src, nbytes);
@@ -185,6 +245,15 @@ static int _fsync(vfs_file_t *filp)
 
 static int _close(vfs_file_t *filp)
 {
+    mutex_lock(&_lock);
+    for (unsigned i = 0; i < ARRAY_SIZE(_maps); i++) {
+        if (_maps[i].filp == filp) {
+            munmap(_maps[i].addr, _maps[i].len);
+            memset(&_maps[i], 0, sizeof(_maps[i]));
+        }
+    }
+    mutex_unlock(&_lock);
+
     return real_close(FD(filep));
 }
 
@@ -267,6 +336,7 @@ static const vfs_file_ops_t native_file_ops = {
     .open = _open,
     .close = _close,
     .read = _read,
+    .read_extent = _read_extent,
     .write = _write,
     .lseek = _lseek,
     .fstat = _fstat,
@@ -0,0 +1,180 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser General
+ * Public License v2.1. See the file LICENSE in the top level directory for
+ * more details.
+ */
+
+/**
+ * @defgroup    cpu_native_prof  Sampling profiler
+ * @ingroup     cpu_native
+ * @brief       Profile native instances per RIOT thread
+ *
+ * All RIOT threads of a native instance run in a single host thread, so host
+ * profilers like `perf` or gprof can not tell them apart. With the
+ * `native_prof` module, the instance samples itself instead: a SIGPROF is
+ * raised every @ref CONFIG_NATIVE_PROF_INTERVAL_US of CPU time, and the
+ * stack that was interrupted is recorded together with the PID and name of
+ * the RIOT thread that was running, or `isr` for interrupt handlers. Of
+ * interrupt handlers and the context switches between threads, only the
+ * interrupted function is recorded, as their stacks can not be unwound.
+ *
+ * Samples with the same thread and stack are counted together. The profile
+ * is exported as folded stacks, one line per stack:
+ *
+ *     <thread>;<frame>;...;<frame> <count>
+ *
+ * with the outermost frame first. Functions of shared libraries are already
+ * named, `dist/tools/native_prof/native_prof.py` turns the remaining
+ * addresses into function names, the result can be opened with
+ * `flamegraph.pl` or https://www.speedscope.app.
+ *
+ * Sampling starts at boot and the profile is written on exit with the
+ * `-P <file>` option:
+ *
+ *     make all term TERMFLAGS="-P prof.txt"
+ *     make eval-prof NATIVE_PROF=prof.txt > prof.folded
+ *
+ * Alternatively, an application can profile a section with
+ * @ref native_prof_start and @ref native_prof_stop and export the result
+ * with @ref native_prof_export.
+ *
+ * Time spent idle is not sampled, as the host process does not use CPU time
+ * while it sleeps.
+ *
+ * @{
+ *
+ * @file
+ * @brief       Sampling profiler
+ */
+
+#ifndef NATIVE_PROF_H
+#define NATIVE_PROF_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   CPU time between two samples in µs
+ */
+#ifndef CONFIG_NATIVE_PROF_INTERVAL_US
+#define CONFIG_NATIVE_PROF_INTERVAL_US  1000
+#endif
+
+/**
+ * @brief   Maximum number of frames recorded per sample
+ *
+ * Outer frames of deeper stacks are cut off.
+ */
+#ifndef CONFIG_NATIVE_PROF_DEPTH
+#define CONFIG_NATIVE_PROF_DEPTH        32
+#endif
+
+/**
+ * @brief   Maximum number of different stacks
+ *
+ * Samples of further stacks are counted as dropped.
+ */
+#ifndef CONFIG_NATIVE_PROF_STACKS
+#define CONFIG_NATIVE_PROF_STACKS       1024
+#endif
+
+/**
+ * @brief   Profiler statistics
+ */
+typedef struct {
+    uint32_t samples;       /**< number of samples recorded */
+    uint32_t dropped;       /**< samples dropped as there was no room */
+    uint32_t stacks;        /**< number of different stacks */
+} native_prof_stats_t;
+
+/**
+ * @brief   Write function for @ref native_prof_export
+ *
+ * @param[in]   arg     argument passed to @ref native_prof_export
+ * @param[in]   data    data to write
+ * @param[in]   len     length of @p data
+ */
+typedef void (*native_prof_write_t)(void *arg, const void *data, size_t len);
+
+/**
+ * @brief   Set the host file the profile is written to on exit
+ *
+ * Sampling starts at boot if a file is set.
+ *
+ * @param[in]   path    path of the file on the host
+ */
+void native_prof_setup(const char *path);
+
+/**
+ * @brief   Initialize the profiler
+ *
+ * Called on startup.
+ */
+void native_prof_init(void);
+
+/**
+ * @brief   Start sampling
+ */
+void native_prof_start(void);
+
+/**
+ * @brief   Stop sampling
+ */
+void native_prof_stop(void);
+
+/**
+ * @brief   Forget all samples
+ */
+void native_prof_reset(void);
+
+/**
+ * @brief   Get the profiler statistics
+ *
+ * @param[out]  stats   statistics
+ */
+void native_prof_get_stats(native_prof_stats_t *stats);
+
+/**
+ * @brief   Write the profile as folded stacks
+ *
+ * Sampling is paused while the profile is exported.
+ *
+ * @param[in]   write   function to write the output with
+ * @param[in]   arg     argument passed to @p write
+ */
+void native_prof_export(native_prof_write_t write, void *arg);
+
+/**
+ * @brief   Write the profile as folded stacks to stdio
+ */
+void native_prof_export_stdio(void);
+
+/**
+ * @brief   Write the profile as folded stacks to a file on the host
+ *
+ * @param[in]   path    path of the file on the host
+ *
+ * @return  0 on success
+ * @return  negative errno on error
+ */
+int native_prof_export_file(const char *path);
+
+/**
+ * @brief   Write the profile to the file given with `-P` on exit
+ *
+ * Called by pm_off().
+ */
+void native_prof_exit(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NATIVE_PROF_H */
+/** @} */
@@ -0,0 +1,125 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser General
+ * Public License v2.1. See the file LICENSE in the top level directory for
+ * more details.
+ */
+
+/**
+ * @defgroup    cpu_native_sim  Virtual time simulation
+ * @ingroup     cpu_native
+ * @brief       Run native instances in virtual time, driven by a coordinator
+ *
+ * With the `native_sim` module, `periph_timer` of native does not follow the
+ * host clock. Instead, the instance connects to a coordinator, e.g. the ZEP
+ * dispatcher in simulation mode (`dist/tools/zep_dispatch`), which decides
+ * when virtual time advances:
+ *
+ * - the instance runs without virtual time passing until it is idle
+ * - when all instances are idle, the coordinator advances virtual time to the
+ *   next timer of any instance or the next delivery of a ZEP frame
+ * - instances that have a timer expiring or a frame arriving at that time are
+ *   run one after another, in the order of their `--id`
+ *
+ * Instances do not have to wait for time to pass, so a simulation usually
+ * runs much faster than real time. As long as nothing happens outside of the
+ * simulation, a run with the same seeds always gives the same result.
+ *
+ * Input from outside of the simulation, e.g. on stdin, wakes up an idle
+ * instance at the current virtual time.
+ *
+ * Code that busy waits for time to pass (e.g. `ztimer_spin()`) never returns,
+ * as virtual time does not advance while an instance is running.
+ *
+ * The coordinator is given with the `-S <addr>:<port>` option.
+ *
+ * @{
+ *
+ * @file
+ * @brief       Virtual time simulation
+ */
+
+#ifndef NATIVE_SIM_H
+#define NATIVE_SIM_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Time of an alarm that is not set
+ */
+#define NATIVE_SIM_NEVER    UINT64_MAX
+
+/**
+ * @brief   Message types between instances and the coordinator
+ */
+enum {
+    NATIVE_SIM_HELLO,   /**< instance connected, `id` is set */
+    NATIVE_SIM_RUN,     /**< run the instance at virtual `time` */
+    NATIVE_SIM_IDLE,    /**< instance is idle until `time` */
+    NATIVE_SIM_BUSY,    /**< idle instance got input from outside */
+};
+
+/**
+ * @brief   Message between instances and the coordinator
+ *
+ * Messages are exchanged over a TCP connection in host byte order.
+ */
+typedef struct {
+    uint8_t type;           /**< message type */
+    uint8_t reserved[3];    /**< unused */
+    uint32_t id;            /**< instance id */
+    uint64_t time;          /**< virtual time in µs */
+} native_sim_msg_t;
+
+/**
+ * @brief   Set the address of the coordinator
+ *
+ * @param[in]   addr    address of the coordinator
+ * @param[in]   port    TCP port of the coordinator
+ */
+void native_sim_setup(const char *addr, const char *port);
+
+/**
+ * @brief   Connect to the coordinator and wait until the instance may start
+ */
+void native_sim_init(void);
+
+/**
+ * @brief   Get the current virtual time
+ *
+ * @return  virtual time in µs
+ */
+uint64_t native_sim_now(void);
+
+/**
+ * @brief   Raise SIGALRM at the given virtual time
+ *
+ * @param[in]   time    virtual time in µs
+ */
+void native_sim_set_alarm(uint64_t time);
+
+/**
+ * @brief   Clear the alarm
+ *
+ * @return  the time the alarm was set to, @ref NATIVE_SIM_NEVER if none
+ */
+uint64_t native_sim_clear_alarm(void);
+
+/**
+ * @brief   Wait until the coordinator runs the instance again
+ *
+ * Called instead of sleeping when native is idle.
+ */
+void native_sim_idle(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NATIVE_SIM_H */
+/** @} */
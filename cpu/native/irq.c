@@ -455,6 +455,16 @@ void native_interrupt_init(void)
         err(EXIT_FAILURE, "native_interrupt_init: sigdelset");
     }
 
+#ifdef MODULE_NATIVE_PROF
+    /* the profiler samples code with interrupts disabled, too */
+    if (sigdelset(&_native_sig_set, SIGPROF) == -1) {
+        err(EXIT_FAILURE, "native_interrupt_init: sigdelset");
+    }
+    if (sigdelset(&_native_sig_set_dint, SIGPROF) == -1) {
+        err(EXIT_FAILURE, "native_interrupt_init: sigdelset");
+    }
+#endif
+
     /* SIGUSR1 is handled like a regular interrupt */
     if (sigaction(SIGUSR1, &sa, NULL)) {
         err(EXIT_FAILURE, "native_interrupt_init: sigaction");
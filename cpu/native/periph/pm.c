@@ -23,6 +23,13 @@
 #include "async_read.h"
 #include "tty_uart.h"
 
+#ifdef MODULE_NATIVE_PROF
+#include "native_prof.h"
+#endif
+#ifdef MODULE_NATIVE_SIM
+#include "native_sim.h"
+#endif
+
 #ifdef MODULE_PERIPH_SPIDEV_LINUX
 #include "spidev_linux.h"
 #endif
@@ -38,7 +45,12 @@ unsigned _native_retval = EXIT_SUCCESS;
 static void _native_sleep(void)
 {
     _native_pending_syscalls_up(); /* no switching here */
+#ifdef MODULE_NATIVE_SIM
+    /* let virtual time pass */
+    native_sim_idle();
+#else
     real_pause();
+#endif
     _native_pending_syscalls_down();
 
     if (_native_pending_signals > 0) {
@@ -64,6 +76,9 @@ void pm_set(unsigned mode)
 void pm_off(void)
 {
     puts("\nnative: exiting");
+#ifdef MODULE_NATIVE_PROF
+    native_prof_exit();
+#endif
 #ifdef MODULE_PERIPH_SPIDEV_LINUX
     spidev_linux_teardown();
 #endif
@@ -23,6 +23,9 @@
  * This is based on native's hwtimer implementation by Ludwig Knüpfer.
  * I removed the multiplexing, as ztimer does the same. (kaspar)
  *
+ * With the `native_sim` module, the timer counts virtual time instead, which
+ * is advanced by the simulation coordinator, see @ref cpu_native_sim.
+ *
  * @}
  */
 
@@ -36,6 +39,7 @@
 #include "cpu.h"
 #include "cpu_conf.h"
 #include "native_internal.h"
+#include "native_sim.h"
 #include "panic.h"
 #include "periph/timer.h"
 #include "time_units.h"
@@ -52,7 +56,9 @@ static void *_cb_arg;
 
 static struct itimerspec its;
 
+#if !IS_USED(MODULE_NATIVE_SIM)
 static timer_t itimer_monotonic;
+#endif
 
 /**
  * returns ticks for give timespec
@@ -63,6 +69,14 @@ static unsigned long ts2ticks(struct timespec *tp)
     return (((unsigned long)tp->tv_sec * NATIVE_TIMER_SPEED) + (tp->tv_nsec / 1000));
 }
 
+#if IS_USED(MODULE_NATIVE_SIM)
+static void ticks2ts(unsigned long ticks, struct timespec *tp)
+{
+    tp->tv_sec = ticks / NATIVE_TIMER_SPEED;
+    tp->tv_nsec = (ticks % NATIVE_TIMER_SPEED) * (NS_PER_SEC / NATIVE_TIMER_SPEED);
+}
+#endif
+
 /**
  * native timer signal handler
  *
@@ -72,6 +86,12 @@ void native_isr_timer(void)
 {
     DEBUG("%s\n", __func__);
 
+#if IS_USED(MODULE_NATIVE_SIM)
+    if (its.it_interval.tv_sec || its.it_interval.tv_nsec) {
+        native_sim_set_alarm(native_sim_now() + ts2ticks(&its.it_interval));
+    }
+#endif
+
     _callback(_cb_arg, 0);
 }
 
@@ -114,6 +134,13 @@ int timer_init(tim_t dev, uint32_t freq, timer_cb_t cb, void *arg)
     _callback = cb;
     _cb_arg = arg;
 
+#if IS_USED(MODULE_NATIVE_SIM)
+    /* the coordinator raises SIGALRM */
+    if (native_register_interrupt(SIGALRM, native_isr_timer) != 0) {
+        DEBUG_PUTS("Failed to register SIGALRM handler");
+        return -1;
+    }
+#else
     if (timer_create(CLOCK_MONOTONIC, NULL, &itimer_monotonic) != 0) {
         DEBUG_PUTS("Failed to create a monotonic itimer");
         return -1;
@@ -124,6 +151,7 @@ int timer_init(tim_t dev, uint32_t freq, timer_cb_t cb, void *arg)
         timer_delete(itimer_monotonic);
         return -1;
     }
+#endif
 
     return 0;
 }
@@ -201,11 +229,22 @@ void timer_start(tim_t dev)
     (void)dev;
     DEBUG("%s\n", __func__);
 
+#if IS_USED(MODULE_NATIVE_SIM)
+    unsigned long offset = ts2ticks(&its.it_value);
+
+    if (offset) {
+        native_sim_set_alarm(native_sim_now() + offset);
+    }
+    else {
+        native_sim_clear_alarm();
+    }
+#else
     _native_syscall_enter();
     if (timer_settime(itimer_monotonic, 0, &its, NULL) == -1) {
         core_panic(PANIC_GENERAL_ERROR, "Failed to set monotonic timer");
     }
     _native_syscall_leave();
+#endif
 }
 
 void timer_stop(tim_t dev)
@@ -213,12 +252,19 @@ void timer_stop(tim_t dev)
     (void)dev;
     DEBUG("%s\n", __func__);
 
+#if IS_USED(MODULE_NATIVE_SIM)
+    uint64_t alarm = native_sim_clear_alarm();
+    uint64_t now = native_sim_now();
+
+    ticks2ts(alarm == NATIVE_SIM_NEVER ? 0 : alarm - now, &its.it_value);
+#else
     _native_syscall_enter();
     struct itimerspec zero = {0};
     if (timer_settime(itimer_monotonic, 0, &zero, &its) == -1) {
         core_panic(PANIC_GENERAL_ERROR, "Failed to set monotonic timer");
     }
     _native_syscall_leave();
+#endif
 
     DEBUG("time left: %lu.%09lu\n", (unsigned long)its.it_value.tv_sec, its.it_value.tv_nsec);
 }
@@ -229,10 +275,13 @@ unsigned int timer_read(tim_t dev)
         return 0;
     }
 
-    struct timespec t;
-
     DEBUG("timer_read()\n");
 
+#if IS_USED(MODULE_NATIVE_SIM)
+    return native_sim_now() - time_null;
+#else
+    struct timespec t;
+
     _native_syscall_enter();
 
     if (clock_gettime(CLOCK_MONOTONIC, &t) == -1) {
@@ -242,4 +291,5 @@ unsigned int timer_read(tim_t dev)
     _native_syscall_leave();
 
     return ts2ticks(&t) - time_null;
+#endif
 }
@@ -0,0 +1,350 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser General
+ * Public License v2.1. See the file LICENSE in the top level directory for
+ * more details.
+ */
+
+/**
+ * @ingroup     cpu_native_prof
+ * @{
+ *
+ * @file
+ * @brief       Sampling profiler
+ *
+ * @}
+ */
+
+#include <dlfcn.h>
+#include <err.h>
+#include <errno.h>
+#include <execinfo.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <stdarg.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <libgen.h>
+#include <string.h>
+#include <sys/time.h>
+
+#include "msg.h"
+#include "native_internal.h"
+#include "native_prof.h"
+#include "thread.h"
+#include "time_units.h"
+#include "util/ucontext.h"
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+/* FNV-1a, 32 bit */
+#define FNV_OFFSET  (2166136261U)
+#define FNV_PRIME   (16777619U)
+
+typedef struct {
+    uint32_t count;                         /* 0 if the slot is free */
+    uint32_t hash;
+    kernel_pid_t pid;
+    uint8_t depth;
+    const char *name;                       /* the thread may be gone later */
+    void *frames[CONFIG_NATIVE_PROF_DEPTH]; /* innermost frame first */
+} _stack_t;
+
+static _stack_t _stacks[CONFIG_NATIVE_PROF_STACKS];
+static native_prof_stats_t _stats;
+static const char *_path;
+static volatile bool _running;
+
+void native_prof_setup(const char *path)
+{
+    _path = path;
+}
+
+static uint32_t _hash(kernel_pid_t pid, void * const *frames, unsigned depth)
+{
+    uint32_t hash = FNV_OFFSET;
+    const uint8_t *data = (const uint8_t *)frames;
+
+    hash = (hash ^ (uint8_t)pid) * FNV_PRIME;
+    for (size_t i = 0; i < depth * sizeof(void *); i++) {
+        hash = (hash ^ data[i]) * FNV_PRIME;
+    }
+    return hash;
+}
+
+static void _record(kernel_pid_t pid, const char *name,
+                    void * const *frames, unsigned depth)
+{
+    uint32_t hash = _hash(pid, frames, depth);
+
+    for (unsigned i = 0; i < CONFIG_NATIVE_PROF_STACKS; i++) {
+        _stack_t *s = &_stacks[(hash + i) % CONFIG_NATIVE_PROF_STACKS];
+
+        if (s->count == 0) {
+            s->hash = hash;
+            s->pid = pid;
+            s->name = name;
+            s->depth = depth;
+            memcpy(s->frames, frames, depth * sizeof(void *));
+            s->count = 1;
+            _stats.samples++;
+            _stats.stacks++;
+            return;
+        }
+        if ((s->hash == hash) && (s->pid == pid) && (s->name == name) &&
+            (s->depth == depth) &&
+            !memcmp(s->frames, frames, depth * sizeof(void *))) {
+            s->count++;
+            _stats.samples++;
+            return;
+        }
+    }
+    _stats.dropped++;
+}
+
+static void _sample(int sig, siginfo_t *info, void *context)
+{
+    (void)sig;
+    (void)info;
+    /* this handler, the signal trampoline, then the interrupted code */
+    void *frames[CONFIG_NATIVE_PROF_DEPTH + 2];
+    void *pc = (void *)_context_get_fptr(context);
+    int n = 0;
+    int first = 0;
+
+    /* The ISR context is entered and left with makecontext() and
+     * setcontext(), a signal in the middle of that leaves a stack the
+     * unwinder can not walk. Record only the interrupted address then. */
+    if (!_native_in_isr) {
+        n = backtrace(frames, ARRAY_SIZE(frames));
+    }
+
+    /* drop the frames of the signal handler */
+    while ((first < n) && (frames[first] != pc)) {
+        first++;
+    }
+    if (first == n) {
+        /* in an ISR, or the unwinder did not get past the signal frame */
+        frames[0] = pc;
+        first = 0;
+        n = 1;
+    }
+    if (n - first > CONFIG_NATIVE_PROF_DEPTH) {
+        n = first + CONFIG_NATIVE_PROF_DEPTH;
+    }
+
+    kernel_pid_t pid = _native_in_isr ? KERNEL_PID_ISR : thread_getpid();
+    const char *name = NULL;
+
+    if (pid == KERNEL_PID_ISR) {
+        name = "isr";
+    }
+    else if (pid_is_valid(pid)) {
+        name = thread_getname(pid);
+    }
+
+    _record(pid, name, &frames[first], n - first);
+}
+
+static void _set_interval(unsigned usec)
+{
+    struct itimerval itv = {
+        .it_interval = { .tv_sec = usec / US_PER_SEC, .tv_usec = usec % US_PER_SEC },
+        .it_value = { .tv_sec = usec / US_PER_SEC, .tv_usec = usec % US_PER_SEC },
+    };
+
+    _native_syscall_enter();
+    if (setitimer(ITIMER_PROF, &itv, NULL) == -1) {
+        err(EXIT_FAILURE, "native_prof: setitimer");
+    }
+    _native_syscall_leave();
+}
+
+void native_prof_init(void)
+{
+    struct sigaction sa = {
+        .sa_sigaction = _sample,
+        .sa_flags = SA_RESTART | SA_SIGINFO | SA_ONSTACK,
+    };
+    void *warmup[1];
+
+    /* the first call loads the unwinder, which must not happen in the
+     * signal handler */
+    backtrace(warmup, ARRAY_SIZE(warmup));
+
+    sigfillset(&sa.sa_mask);
+    if (sigaction(SIGPROF, &sa, NULL) == -1) {
+        err(EXIT_FAILURE, "native_prof: sigaction");
+    }
+
+    if (_path) {
+        native_prof_start();
+    }
+}
+
+void native_prof_start(void)
+{
+    _running = true;
+    _set_interval(CONFIG_NATIVE_PROF_INTERVAL_US);
+}
+
+void native_prof_stop(void)
+{
+    _set_interval(0);
+    _running = false;
+}
+
+void native_prof_reset(void)
+{
+    bool running = _running;
+
+    native_prof_stop();
+    memset(_stacks, 0, sizeof(_stacks));
+    memset(&_stats, 0, sizeof(_stats));
+    if (running) {
+        native_prof_start();
+    }
+}
+
+void native_prof_get_stats(native_prof_stats_t *stats)
+{
+    bool running = _running;
+
+    native_prof_stop();
+    *stats = _stats;
+    if (running) {
+        native_prof_start();
+    }
+}
+
+static void _print(native_prof_write_t write, void *arg, const char *fmt, ...)
+{
+    char buf[64];
+    va_list args;
+
+    va_start(args, fmt);
+    int len = vsnprintf(buf, sizeof(buf), fmt, args);
+    va_end(args);
+
+    if (len > 0) {
+        write(arg, buf, (size_t)len < sizeof(buf) ? (size_t)len : sizeof(buf) - 1);
+    }
+}
+
+/* addresses of RIOT are left to the host tools, which have the debug info
+ * of the ELF file, functions of shared libraries are named right here */
+static void _print_frame(native_prof_write_t write, void *arg,
+                         void *addr, bool leaf)
+{
+    static void *_elf_base;
+    Dl_info info;
+
+    if (!_elf_base && dladdr((void *)native_prof_export, &info)) {
+        _elf_base = info.dli_fbase;
+    }
+
+    /* return addresses may already belong to the next function */
+    if (!dladdr((uint8_t *)addr - (leaf ? 0 : 1), &info) ||
+        (info.dli_fbase == _elf_base)) {
+        _print(write, arg, ";%p", addr);
+    }
+    else if (info.dli_sname) {
+        _print(write, arg, ";%s", info.dli_sname);
+    }
+    else {
+        char fname[64];
+
+        strncpy(fname, info.dli_fname, sizeof(fname) - 1);
+        fname[sizeof(fname) - 1] = '\0';
+        _print(write, arg, ";[%s]", basename(fname));
+    }
+}
+
+void native_prof_export(native_prof_write_t write, void *arg)
+{
+    bool running = _running;
+
+    native_prof_stop();
+    for (unsigned i = 0; i < CONFIG_NATIVE_PROF_STACKS; i++) {
+        const _stack_t *s = &_stacks[i];
+
+        if (s->count == 0) {
+            continue;
+        }
+        if (s->name) {
+            _print(write, arg, "%s", s->name);
+        }
+        else {
+            _print(write, arg, "pid%d", (int)s->pid);
+        }
+        for (unsigned j = s->depth; j > 0; j--) {
+            _print_frame(write, arg, s->frames[j - 1], j == 1);
+        }
+        _print(write, arg, " %" PRIu32 "\n", s->count);
+    }
+    if (running) {
+        native_prof_start();
+    }
+}
+
+static void _write_stdio(void *arg, const void *data, size_t len)
+{
+    (void)arg;
+    fwrite(data, 1, len, stdout);
+}
+
+void native_prof_export_stdio(void)
+{
+    native_prof_export(_write_stdio, NULL);
+    fflush(stdout);
+}
+
+static void _write_file(void *arg, const void *data, size_t len)
+{
+    int *fd = arg;
+
+    if ((*fd >= 0) && (real_write(*fd, data, len) != (ssize_t)len)) {
+        real_close(*fd);
+        *fd = -EIO;
+    }
+}
+
+int native_prof_export_file(const char *path)
+{
+    _native_syscall_enter();
+    int fd = real_open(path, O_CREAT | O_TRUNC | O_WRONLY | O_CLOEXEC, 0644);
+
+    if (fd < 0) {
+        fd = -errno;
+        _native_syscall_leave();
+        return fd;
+    }
+    native_prof_export(_write_file, &fd);
+    if ((fd >= 0) && (real_close(fd) < 0)) {
+        fd = -errno;
+    }
+    _native_syscall_leave();
+
+    return fd < 0 ? fd : 0;
+}
+
+void native_prof_exit(void)
+{
+    if (!_path) {
+        return;
+    }
+
+    native_prof_stop();
+    int res = native_prof_export_file(_path);
+
+    if (res < 0) {
+        warnx("native_prof: unable to write %s: %s", _path, strerror(-res));
+    }
+    else {
+        real_printf("native_prof: %" PRIu32 " samples written to %s\n",
+                    _stats.samples, _path);
+    }
+}
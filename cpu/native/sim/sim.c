@@ -0,0 +1,202 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser General
+ * Public License v2.1. See the file LICENSE in the top level directory for
+ * more details.
+ */
+
+/**
+ * @ingroup     cpu_native_sim
+ * @{
+ *
+ * @file
+ * @brief       Virtual time simulation
+ *
+ * @}
+ */
+
+#include <err.h>
+#include <errno.h>
+#include <inttypes.h>
+#include <netdb.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <poll.h>
+#include <signal.h>
+#include <stdlib.h>
+#include <sys/socket.h>
+
+#include "kernel_defines.h"
+#include "native_internal.h"
+#include "native_sim.h"
+#include "periph/pm.h"
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+static const char *_addr;
+static const char *_port;
+static int _sock = -1;
+
+static uint64_t _now;
+static uint64_t _alarm = NATIVE_SIM_NEVER;
+
+void native_sim_setup(const char *addr, const char *port)
+{
+    _addr = addr;
+    _port = port;
+}
+
+static void _send(uint8_t type, uint64_t time)
+{
+    native_sim_msg_t msg = {
+        .type = type,
+        .id = _native_id,
+        .time = time,
+    };
+
+    if (real_send(_sock, &msg, sizeof(msg), MSG_NOSIGNAL) != sizeof(msg)) {
+        err(EXIT_FAILURE, "native_sim: unable to send to coordinator");
+    }
+}
+
+/* returns false if the coordinator closed the connection */
+static bool _recv(native_sim_msg_t *msg)
+{
+    size_t got = 0;
+
+    while (got < sizeof(*msg)) {
+        ssize_t res = real_recv(_sock, (uint8_t *)msg + got,
+                                sizeof(*msg) - got, 0);
+        if (res == 0) {
+            return false;
+        }
+        if (res < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            err(EXIT_FAILURE, "native_sim: unable to receive from coordinator");
+        }
+        got += res;
+    }
+
+    return true;
+}
+
+/* waits for the coordinator to let the instance run */
+static void _wait_run(void)
+{
+    native_sim_msg_t msg;
+
+    do {
+        if (!_recv(&msg)) {
+            /* simulation is over */
+            pm_off();
+        }
+    } while (msg.type != NATIVE_SIM_RUN);
+
+    DEBUG("native_sim: run at %" PRIu64 "\n", msg.time);
+    _now = msg.time;
+
+    if (_alarm <= _now) {
+        int sig = SIGALRM;
+
+        _alarm = NATIVE_SIM_NEVER;
+        if (real_write(_signal_pipe_fd[1], &sig, sizeof(sig)) == -1) {
+            err(EXIT_FAILURE, "native_sim: real_write()");
+        }
+        _native_pending_signals++;
+    }
+}
+
+void native_sim_init(void)
+{
+    static const struct addrinfo hints = { .ai_family = AF_UNSPEC,
+                                           .ai_socktype = SOCK_STREAM };
+    struct addrinfo *ai = NULL;
+    int res;
+
+    if (_addr == NULL) {
+        errx(EXIT_FAILURE, "native_sim: no coordinator given, use --sim");
+    }
+
+    if ((res = real_getaddrinfo(_addr, _port, &hints, &ai)) != 0) {
+        errx(EXIT_FAILURE, "native_sim: unable to get coordinator address: %s",
+             gai_strerror(res));
+    }
+
+    for (struct addrinfo *remote = ai; remote != NULL; remote = remote->ai_next) {
+        /* reboot uses execve(), the new instance connects again */
+        if ((_sock = real_socket(remote->ai_family,
+                                 remote->ai_socktype | SOCK_CLOEXEC,
+                                 remote->ai_protocol)) < 0) {
+            continue;
+        }
+        if (real_connect(_sock, remote->ai_addr, remote->ai_addrlen) == 0) {
+            break;
+        }
+        real_close(_sock);
+        _sock = -1;
+    }
+    real_freeaddrinfo(ai);
+
+    if (_sock < 0) {
+        err(EXIT_FAILURE, "native_sim: unable to connect to coordinator");
+    }
+
+    /* every message is a round trip, do not wait for more data */
+    int one = 1;
+    real_setsockopt(_sock, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+
+    _send(NATIVE_SIM_HELLO, 0);
+    _wait_run();
+}
+
+uint64_t native_sim_now(void)
+{
+    return _now;
+}
+
+void native_sim_set_alarm(uint64_t time)
+{
+    _alarm = time;
+}
+
+uint64_t native_sim_clear_alarm(void)
+{
+    uint64_t alarm = _alarm;
+
+    _alarm = NATIVE_SIM_NEVER;
+    return alarm;
+}
+
+void native_sim_idle(void)
+{
+    /* interrupts that are already pending are handled at the current time */
+    if (_native_pending_signals > 0) {
+        return;
+    }
+
+    _send(NATIVE_SIM_IDLE, _alarm);
+
+    /* I/O from outside of the simulation ends up in the signal pipe */
+    struct pollfd fds[] = {
+        { .fd = _sock, .events = POLLIN },
+        { .fd = _signal_pipe_fd[0], .events = POLLIN },
+    };
+
+    while (real_poll(fds, ARRAY_SIZE(fds), -1) < 0) {
+        if (errno != EINTR) {
+            err(EXIT_FAILURE, "native_sim: real_poll()");
+        }
+    }
+
+    if (!(fds[0].revents & (POLLIN | POLLHUP)) && (fds[1].revents & POLLIN)) {
+        /* ask to run now, the coordinator ignores this if the instance is
+         * about to run anyway */
+        _send(NATIVE_SIM_BUSY, _now);
+    }
+
+    _wait_run();
+}
@@ -84,6 +84,12 @@ netdev_tap_params_t netdev_tap_params[NETDEV_TAP_MAX];
 
 socket_zep_params_t socket_zep_params[SOCKET_ZEP_MAX];
 #endif
+#ifdef MODULE_NATIVE_PROF
+#include "native_prof.h"
+#endif
+#ifdef MODULE_NATIVE_SIM
+#include "native_sim.h"
+#endif
 #ifdef MODULE_PERIPH_EEPROM
 #include "eeprom_native.h"
 extern char eeprom_file[EEPROM_FILEPATH_MAX_LEN];
@@ -102,6 +108,12 @@ static const char short_opts[] = ":hi:s:deEoc:"
 #ifdef MODULE_SOCKET_ZEP
     "z:"
 #endif
+#ifdef MODULE_NATIVE_PROF
+    "P:"
+#endif
+#ifdef MODULE_NATIVE_SIM
+    "S:"
+#endif
 #ifdef MODULE_NATIVE_CLI_EUI_PROVIDER
     "U:"
 #endif
@@ -142,6 +154,12 @@ static const struct option long_opts[] = {
 #ifdef MODULE_SOCKET_ZEP
     { "zep", required_argument, NULL, 'z' },
 #endif
+#ifdef MODULE_NATIVE_PROF
+    { "prof", required_argument, NULL, 'P' },
+#endif
+#ifdef MODULE_NATIVE_SIM
+    { "sim", required_argument, NULL, 'S' },
+#endif
 #ifdef MODULE_NATIVE_CLI_EUI_PROVIDER
     { "eui64", required_argument, NULL, 'U' },
 #endif
@@ -293,6 +311,12 @@ void usage_exit(int status)
         real_printf(" -z <laddr>:<lport>,<raddr>:<rport>");
     }
 #endif
+#ifdef MODULE_NATIVE_PROF
+    real_printf(" [-P <file>]");
+#endif
+#ifdef MODULE_NATIVE_SIM
+    real_printf(" -S <addr>:<port>");
+#endif
 #ifdef MODULE_NATIVE_CLI_EUI_PROVIDER
     real_printf(" [--eui64 <eui64> …]");
 #endif
@@ -339,6 +363,16 @@ void usage_exit(int status)
 "        on a local address.\n"
 "        Required to be provided SOCKET_ZEP_MAX times\n"
 #endif
+#ifdef MODULE_NATIVE_PROF
+"    -P <file>, --prof=<file>\n"
+"        sample the CPU time used by each thread from boot and write the\n"
+"        profile as folded stacks to <file> on exit\n"
+#endif
+#ifdef MODULE_NATIVE_SIM
+"    -S <addr>:<port>, --sim=<addr>:<port>\n"
+"        connect to the simulation coordinator at <addr>:<port>, which\n"
+"        controls the virtual time of this instance. Required.\n"
+#endif
 #ifdef MODULE_NATIVE_CLI_EUI_PROVIDER
 "    -U <eui64>, --eui64=<eui64>\n"
 "        provide a ZEP interface with EUI-64 (MAC address)\n"
@@ -379,7 +413,7 @@ void usage_exit(int status)
     real_exit(status);
 }
 
-#ifdef MODULE_SOCKET_ZEP
+#if defined(MODULE_SOCKET_ZEP) || defined(MODULE_NATIVE_SIM)
 static void _parse_ep_str(char *ep_str, char **addr, char **port)
 {
     /* read endpoint string in reverse, the last chars are the port and decimal
@@ -414,7 +448,19 @@ static void _parse_ep_str(char *ep_str, char **addr, char **port)
         usage_exit(EXIT_FAILURE);
     }
 }
+#endif
+
+#ifdef MODULE_NATIVE_SIM
+static void _sim_setup(char *sim_str)
+{
+    char *addr = NULL, *port = NULL;
+
+    _parse_ep_str(strdup(sim_str), &addr, &port);
+    native_sim_setup(addr, port);
+}
+#endif
 
+#ifdef MODULE_SOCKET_ZEP
 static void _zep_params_setup(char *zep_str, int zep)
 {
     char *save_ptr, *first_ep, *second_ep;
@@ -528,6 +574,9 @@ __attribute__((constructor)) static void startup(int argc, char **argv, char **e
 #endif
 #ifdef MODULE_SOCKET_ZEP
     unsigned zeps = 0;
+#endif
+#ifdef MODULE_NATIVE_SIM
+    bool sim = false;
 #endif
     bool dmn = false, force_stderr = false;
     _stdiotype_t stderrtype = _STDIOTYPE_STDIO;
@@ -607,6 +656,17 @@ __attribute__((constructor)) static void startup(int argc, char **argv, char **e
                 _zep_params_setup(optarg, zeps++);
                 break;
 #endif
+#ifdef MODULE_NATIVE_PROF
+            case 'P':
+                native_prof_setup(optarg);
+                break;
+#endif
+#ifdef MODULE_NATIVE_SIM
+            case 'S':
+                _sim_setup(optarg);
+                sim = true;
+                break;
+#endif
 #ifdef MODULE_NATIVE_CLI_EUI_PROVIDER
             case 'U':
                 native_cli_add_eui64(optarg);
@@ -652,6 +712,11 @@ __attribute__((constructor)) static void startup(int argc, char **argv, char **e
         usage_exit(EXIT_FAILURE);
     }
 #endif
+#ifdef MODULE_NATIVE_SIM
+    if (!sim) {
+        usage_exit(EXIT_FAILURE);
+    }
+#endif
 
     if (dmn) {
         filter_daemonize_argv(_native_argv);
@@ -709,6 +774,13 @@ __attribute__((constructor)) static void startup(int argc, char **argv, char **e
 
     native_cpu_init();
     native_interrupt_init();
+#ifdef MODULE_NATIVE_PROF
+    native_prof_init();
+#endif
+#ifdef MODULE_NATIVE_SIM
+    /* virtual time starts when the coordinator lets this instance run */
+    native_sim_init();
+#endif
 #ifdef MODULE_NETDEV_TAP
     for (unsigned i = 0; taps < NETDEV_TAP_MAX; ++taps, ++i) {
         if (argv[optind + i] == NULL) {
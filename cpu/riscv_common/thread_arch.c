@@ -178,6 +178,8 @@ void cpu_switch_context_exit(void)
     UNREACHABLE();
 }
 
+/* tlsf-malloc manages the heap and prints its own statistics */
+#if !IS_USED(MODULE_TLSF_MALLOC)
 /**
  * @brief Print heap statistics
  */
@@ -193,3 +195,4 @@ void heap_stats(void)
     printf("heap: %ld (used %u, free %ld) [bytes]\n",
            heap_size, minfo.uordblks, heap_size - minfo.uordblks);
 }
+#endif
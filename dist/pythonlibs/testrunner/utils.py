@@ -6,6 +6,9 @@
 
 """Utility functions for writing tests."""
 
+import json
+import re
+
 import pexpect
 
 
@@ -39,3 +42,18 @@ def test_utils_interactive_sync_shell(child, retries, delay):
     Interacts through input to wait for node being ready.
     """
     _test_utils_interactive_sync(child, retries, delay, '\n', '>')
+
+
+def expect_benchmark(child, name, timeout=-1):
+    """Wait for a result of the benchmark module in JSON format
+
+    Returns the result as dict, after checking that its statistics are
+    consistent.
+    """
+    child.expect(r'(\{{"name":"{}",[^\r\n]*\}})\r\n'.format(re.escape(name)),
+                 timeout=timeout)
+    res = json.loads(child.match.group(1))
+    for stats in (res, res.get("cycles")):
+        if stats is not None:
+            assert stats["min"] <= stats["median"] <= stats["p99"] <= stats["max"], res
+    return res
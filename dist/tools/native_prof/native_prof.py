@@ -0,0 +1,108 @@
+#! /usr/bin/env python3
+
+# Copyright (C) 2026 Freie Universität Berlin
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+"""
+Symbolize a profile written by the native_prof module of native.
+
+Reads folded stacks with addresses, as written with `-P <file>` or
+native_prof_export(), and writes them with function names instead, ready for
+flamegraph.pl or speedscope.
+"""
+
+import argparse
+import collections
+import os
+import re
+import subprocess
+import sys
+
+
+# other output, e.g. of the shell, is skipped
+STACK = re.compile(r"^(?P<thread>[^;\s]+)(?P<frames>(;[^;\s]+)+) (?P<count>\d+)$")
+
+
+def parse(lines):
+    """Yield (thread, [frames, outermost first], count) per stack.
+
+    Frames are addresses, or names of functions in shared libraries.
+    """
+    for line in lines:
+        match = STACK.match(line.strip())
+        if match:
+            frames = [int(f, 16) if f.startswith("0x") else f
+                      for f in match["frames"][1:].split(";")]
+            yield match["thread"], frames, int(match["count"])
+
+
+def symbolize(elf, addrs, addr2line, lines):
+    """Map addresses to lists of function names, outermost inlined first."""
+    addrs = sorted(addrs)
+    cmd = [addr2line, "-a", "-f", "-i", "-C", "-e", elf]
+    out = subprocess.run(cmd, input="".join("0x%x\n" % a for a in addrs),
+                         capture_output=True, text=True, check=True).stdout
+    symbols = {}
+    funcs = None
+    output = iter(out.splitlines())
+    for line in output:
+        if line.startswith("0x"):
+            funcs = symbols.setdefault(int(line, 16), [])
+            continue
+        location = next(output, "??:0")
+        if line == "??":
+            continue
+        if lines:
+            line = "%s:%s" % (line, os.path.basename(location.split(" ")[0]))
+        funcs.insert(0, line)
+    return symbols
+
+
+def _addr(frames, i):
+    """Address to look up for frame i, None if it is already named."""
+    if not isinstance(frames[i], int):
+        return None
+    # all but the innermost frame are return addresses, which point behind
+    # the call
+    return frames[i] if i == len(frames) - 1 else frames[i] - 1
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument("elf", help="ELF file of the native instance")
+    parser.add_argument("profile", nargs="?", type=argparse.FileType("r"),
+                        default=sys.stdin, help="profile (default: stdin)")
+    parser.add_argument("-l", "--lines", action="store_true",
+                        help="add file and line to the function names")
+    parser.add_argument("--addr2line", default=os.environ.get("ADDR2LINE",
+                                                              "addr2line"),
+                        help="addr2line binary (default: %(default)s)")
+    args = parser.parse_args()
+
+    stacks = list(parse(args.profile))
+    addrs = set()
+    for _, frames, _ in stacks:
+        addrs.update(_addr(frames, i) for i in range(len(frames)))
+    addrs.discard(None)
+    symbols = symbolize(args.elf, addrs, args.addr2line, args.lines)
+
+    folded = collections.Counter()
+    for thread, frames, count in stacks:
+        names = [thread]
+        for i, frame in enumerate(frames):
+            addr = _addr(frames, i)
+            if addr is None:
+                names.append(frame)
+            else:
+                names += symbols.get(addr) or ["0x%x" % addr]
+        folded[";".join(names)] += count
+
+    for stack, count in sorted(folded.items()):
+        print("%s %d" % (stack, count))
+
+
+if __name__ == "__main__":
+    main()
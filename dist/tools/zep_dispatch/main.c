@@ -24,6 +24,7 @@
 #include <sys/ioctl.h>
 
 #include "kernel_defines.h"
+#include "sim.h"
 #include "topology.h"
 #include "zep_parser.h"
 
@@ -37,6 +38,13 @@ typedef struct {
 typedef void (*dispatch_cb_t)(void *ctx, void *buffer, size_t len,
                               int sock, struct sockaddr_in6 *src_addr);
 
+typedef struct {
+    int sock;
+    int tap;
+    dispatch_cb_t dispatch;
+    void *ctx;
+} dispatcher_t;
+
 /* all nodes are directly connected */
 static void _send_flat(void *ctx, void *buffer, size_t len,
                        int sock, struct sockaddr_in6 *src_addr)
@@ -56,7 +64,7 @@ static void _send_flat(void *ctx, void *buffer, size_t len,
             known_node = true;
             /* remove client if sending fails */
         }
-        else if (sendto(sock, buffer, len, 0, (struct sockaddr *)addr, sizeof(*addr)) < 0) {
+        else if (sim_sendto(sock, buffer, len, addr) < 0) {
             inet_ntop(src_addr->sin6_family, &addr->sin6_addr, addr_str, INET6_ADDRSTRLEN);
             printf("removing [%s]:%d\n", addr_str, ntohs(addr->sin6_port));
             prev->next = n->next;
@@ -95,37 +103,51 @@ static void _send_topology(void *ctx, void *buffer, size_t len,
     topology_send(ctx, sock, src_addr, buffer, len);
 }
 
-static void dispatch_loop(int sock, int tap, dispatch_cb_t dispatch, void *ctx)
+static bool _recv_packet(dispatcher_t *d, int flags)
 {
-    puts("entering loop…");
-    while (1) {
-        uint8_t buffer[ZEP_DISPATCH_PDU];
-        struct sockaddr_in6 src_addr;
-        socklen_t addr_len = sizeof(src_addr);
+    uint8_t buffer[ZEP_DISPATCH_PDU];
+    /* IPv4 addresses are shorter, addresses are compared as a whole */
+    struct sockaddr_in6 src_addr = { 0 };
+    socklen_t addr_len = sizeof(src_addr);
 
-        /* receive incoming packet */
-        ssize_t bytes_in = recvfrom(sock, buffer, sizeof(buffer), 0,
-                                    (struct sockaddr *)&src_addr, &addr_len);
+    /* receive incoming packet */
+    ssize_t bytes_in = recvfrom(d->sock, buffer, sizeof(buffer), flags,
+                                (struct sockaddr *)&src_addr, &addr_len);
 
-        if (bytes_in <= 0) {
-            continue;
-        }
+    if (bytes_in <= 0) {
+        return false;
+    }
 
-        /* send packet to virtual 802.15.4 interface */
-        if (tap) {
-            size_t len = bytes_in;
-            const void *payload = zep_get_payload(buffer, &len);
-            if (payload) {
-                if (write(tap, payload, len) < 0) {
-                    puts("Can't write to virtual 802.15.4 device");
-                    close(tap);
-                    tap = 0;
-                }
+    /* send packet to virtual 802.15.4 interface */
+    if (d->tap) {
+        size_t len = bytes_in;
+        const void *payload = zep_get_payload(buffer, &len);
+        if (payload) {
+            if (write(d->tap, payload, len) < 0) {
+                puts("Can't write to virtual 802.15.4 device");
+                close(d->tap);
+                d->tap = 0;
             }
         }
+    }
+
+    /* send packet to the topology */
+    sim_set_sender(&src_addr);
+    d->dispatch(d->ctx, buffer, bytes_in, d->sock, &src_addr);
 
-        /* send packet to the topology */
-        dispatch(ctx, buffer, bytes_in, sock, &src_addr);
+    return true;
+}
+
+static bool _recv_packet_nonblock(void *arg)
+{
+    return _recv_packet(arg, MSG_DONTWAIT);
+}
+
+static void dispatch_loop(dispatcher_t *d)
+{
+    puts("entering loop…");
+    while (1) {
+        _recv_packet(d, 0);
     }
 }
 
@@ -192,7 +214,8 @@ error:
 static void _print_help(const char *progname)
 {
     fprintf(stderr, "usage: %s [-t topology] [-s seed] "
-                    "[-g graphviz_out] [-w interface] <address> <port>\n",
+                    "[-g graphviz_out] [-w interface] [-S sim_port [-n nodes] "
+                    "[-l latency] [-L loss] [-T end]] <address> <port>\n",
             progname);
 
     fprintf(stderr, "\npositional arguments:\n");
@@ -206,6 +229,17 @@ static void _print_help(const char *progname)
     fprintf(stderr, "\t-g <file>\tFile to dump topology as Graphviz visualisation on SIGUSR1\n");
     fprintf(stderr, "\t-w <interface>\tSend frames to virtual 802.15.4 "
                     "interface (mac802154_hwsim)\n");
+
+    fprintf(stderr, "\nsimulation (virtual time) arguments:\n");
+    fprintf(stderr, "\t-S <port>\tAccept nodes with the native_sim module "
+                    "on this TCP port\n");
+    fprintf(stderr, "\t-n <nodes>\tNumber of nodes to wait for before time "
+                    "starts (default 1)\n");
+    fprintf(stderr, "\t-l <µs>\t\tLatency of every frame\n");
+    fprintf(stderr, "\t-L <loss>\tProbability of a frame to get lost "
+                    "(0 to 1)\n");
+    fprintf(stderr, "\t-T <seconds>\tVirtual time to end the simulation "
+                    "at\n");
 }
 
 int main(int argc, char **argv)
@@ -214,6 +248,10 @@ int main(int argc, char **argv)
     unsigned int seed = time(NULL);
     const char *topo_file = NULL;
     const char *progname = argv[0];
+    static sim_params_t sim = {
+        .nodes = 1,
+        .end = UINT64_MAX,
+    };
 
     const struct addrinfo hint = {
         .ai_family   = AF_UNSPEC,
@@ -222,7 +260,7 @@ int main(int argc, char **argv)
         .ai_flags    = AI_NUMERICHOST,
     };
 
-    while ((c = getopt(argc, argv, "t:s:g:w:p:")) != -1) {
+    while ((c = getopt(argc, argv, "t:s:g:w:p:S:n:l:L:T:")) != -1) {
         switch (c) {
         case 't':
             topo_file = optarg;
@@ -242,6 +280,21 @@ int main(int argc, char **argv)
         case 'p':
             pidfile = optarg;
             break;
+        case 'S':
+            sim.port = optarg;
+            break;
+        case 'n':
+            sim.nodes = atoi(optarg);
+            break;
+        case 'l':
+            sim.latency = strtoul(optarg, NULL, 0);
+            break;
+        case 'L':
+            sim.loss = atof(optarg);
+            break;
+        case 'T':
+            sim.end = atof(optarg) * 1000000;
+            break;
         default:
             _print_help(progname);
             exit(1);
@@ -300,6 +353,14 @@ int main(int argc, char **argv)
 
     freeaddrinfo(server_addr);
 
+    if (sim.port) {
+        sim.addr = argv[0];
+        if (sim_init(&sim)) {
+            perror("can't listen for simulated nodes");
+            exit(1);
+        }
+    }
+
     if (pidfile) {
          FILE *pf = fopen(pidfile, "w");
         if (pf) {
@@ -308,11 +369,25 @@ int main(int argc, char **argv)
         }
     }
 
+    dispatcher_t dispatcher = {
+        .sock = sock,
+        .tap = tap_fd,
+    };
+
     if (topology.flat) {
-        dispatch_loop(sock, tap_fd, _send_flat, &topology.nodes);
+        dispatcher.dispatch = _send_flat;
+        dispatcher.ctx = &topology.nodes;
+    }
+    else {
+        dispatcher.dispatch = _send_topology;
+        dispatcher.ctx = &topology;
+    }
+
+    if (sim.port) {
+        sim_loop(sock, _recv_packet_nonblock, &dispatcher);
     }
     else {
-        dispatch_loop(sock, tap_fd, _send_topology, &topology);
+        dispatch_loop(&dispatcher);
     }
 
     close(sock);
@@ -0,0 +1,501 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU General Public
+ * License v2. See the file LICENSE for more details.
+ */
+
+#include <errno.h>
+#include <inttypes.h>
+#include <netdb.h>
+#include <netinet/tcp.h>
+#include <poll.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "kernel_defines.h"
+#include "native_sim.h"
+#include "sim.h"
+
+#ifndef SIM_NODES_MAX
+#define SIM_NODES_MAX   64
+#endif
+
+/* id of a node that did not send hello yet, sorted last */
+#define ID_UNKNOWN      UINT32_MAX
+
+typedef struct {
+    int fd;
+    uint32_t id;
+    bool running;
+    bool has_addr;
+    uint64_t alarm;
+    struct sockaddr_in6 addr;
+} sim_node_t;
+
+typedef struct sim_frame {
+    struct sim_frame *next;
+    uint64_t time;
+    uint32_t id;
+    size_t len;
+    uint8_t data[];
+} sim_frame_t;
+
+static const sim_params_t *_params;
+static int _listen = -1;
+static int _sock = -1;
+static sim_recv_cb_t _recv;
+static void *_recv_arg;
+
+/* sorted by id, this is the order in which nodes run at the same time */
+static sim_node_t _nodes[SIM_NODES_MAX];
+static unsigned _numof;
+static unsigned _joined;
+static uint64_t _now;
+
+/* sorted by time, as all frames have the same latency */
+static sim_frame_t *_head;
+static sim_frame_t *_tail;
+
+static uint64_t _runs;
+static uint64_t _delivered;
+static uint64_t _lost;
+
+static int _cmp_id(const void *a, const void *b)
+{
+    const sim_node_t *na = a;
+    const sim_node_t *nb = b;
+
+    return (na->id > nb->id) - (na->id < nb->id);
+}
+
+static sim_node_t *_node_by_fd(int fd)
+{
+    for (unsigned i = 0; i < _numof; i++) {
+        if (_nodes[i].fd == fd) {
+            return &_nodes[i];
+        }
+    }
+    return NULL;
+}
+
+static sim_node_t *_node_by_addr(const struct sockaddr_in6 *addr)
+{
+    for (unsigned i = 0; i < _numof; i++) {
+        if (_nodes[i].has_addr &&
+            memcmp(&_nodes[i].addr, addr, sizeof(*addr)) == 0) {
+            return &_nodes[i];
+        }
+    }
+    return NULL;
+}
+
+static sim_node_t *_node_by_id(uint32_t id)
+{
+    for (unsigned i = 0; i < _numof; i++) {
+        if (_nodes[i].id == id) {
+            return &_nodes[i];
+        }
+    }
+    return NULL;
+}
+
+static bool _running(void)
+{
+    for (unsigned i = 0; i < _numof; i++) {
+        if (_nodes[i].running) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static bool _frame_due(uint32_t id)
+{
+    for (sim_frame_t *f = _head; f && f->time <= _now; f = f->next) {
+        if (f->id == id) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/* earliest time at which a node has to run */
+static uint64_t _next(void)
+{
+    uint64_t next = _head ? _head->time : NATIVE_SIM_NEVER;
+
+    for (unsigned i = 0; i < _numof; i++) {
+        if (_nodes[i].id != ID_UNKNOWN && _nodes[i].alarm < next) {
+            next = _nodes[i].alarm;
+        }
+    }
+    return next;
+}
+
+static sim_node_t *_first_due(void)
+{
+    for (unsigned i = 0; i < _numof; i++) {
+        sim_node_t *node = &_nodes[i];
+
+        if (node->id == ID_UNKNOWN) {
+            continue;
+        }
+        if (node->alarm <= _now || _frame_due(node->id)) {
+            return node;
+        }
+    }
+    return NULL;
+}
+
+static void _update_tail(void)
+{
+    _tail = _head;
+    while (_tail && _tail->next) {
+        _tail = _tail->next;
+    }
+}
+
+static void _drop_frames(uint32_t id)
+{
+    sim_frame_t **prev = &_head;
+
+    while (*prev) {
+        sim_frame_t *f = *prev;
+
+        if (f->id == id) {
+            *prev = f->next;
+            free(f);
+        }
+        else {
+            prev = &f->next;
+        }
+    }
+    _update_tail();
+}
+
+static void _send_msg(sim_node_t *node, uint8_t type)
+{
+    native_sim_msg_t msg = {
+        .type = type,
+        .id = node->id,
+        .time = _now,
+    };
+
+    /* a node that is gone is removed when reading from it fails */
+    send(node->fd, &msg, sizeof(msg), MSG_NOSIGNAL);
+}
+
+static void _run(sim_node_t *node)
+{
+    sim_frame_t **prev = &_head;
+
+    node->running = true;
+    node->alarm = NATIVE_SIM_NEVER;
+
+    /* frames are received before the node runs */
+    while (*prev && (*prev)->time <= _now) {
+        sim_frame_t *f = *prev;
+
+        if (f->id == node->id) {
+            sendto(_sock, f->data, f->len, 0,
+                   (struct sockaddr *)&node->addr, sizeof(node->addr));
+            _delivered++;
+            *prev = f->next;
+            free(f);
+        }
+        else {
+            prev = &f->next;
+        }
+    }
+    _update_tail();
+
+    _send_msg(node, NATIVE_SIM_RUN);
+    _runs++;
+}
+
+static void _remove(sim_node_t *node)
+{
+    if (node->id != ID_UNKNOWN) {
+        printf("sim: node %" PRIu32 " left\n", node->id);
+        _drop_frames(node->id);
+    }
+    close(node->fd);
+
+    unsigned i = node - _nodes;
+    memmove(&_nodes[i], &_nodes[i + 1], (--_numof - i) * sizeof(*node));
+}
+
+static void _accept(void)
+{
+    int fd = accept(_listen, NULL, NULL);
+
+    if (fd < 0) {
+        return;
+    }
+    if (_numof == ARRAY_SIZE(_nodes)) {
+        fprintf(stderr, "sim: too many nodes\n");
+        close(fd);
+        return;
+    }
+
+    /* every message is a round trip, do not wait for more data */
+    int one = 1;
+    setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+
+    _nodes[_numof++] = (sim_node_t) {
+        .fd = fd,
+        .id = ID_UNKNOWN,
+        .alarm = NATIVE_SIM_NEVER,
+    };
+}
+
+static void _handle_msg(sim_node_t *node)
+{
+    native_sim_msg_t msg;
+
+    if (recv(node->fd, &msg, sizeof(msg), MSG_WAITALL) != sizeof(msg)) {
+        _remove(node);
+        return;
+    }
+
+    switch (msg.type) {
+    case NATIVE_SIM_HELLO:
+        if (node->id != ID_UNKNOWN || msg.id == ID_UNKNOWN ||
+            _node_by_id(msg.id)) {
+            fprintf(stderr, "sim: duplicate node id %" PRIu32 "\n", msg.id);
+            _remove(node);
+            return;
+        }
+        printf("sim: node %" PRIu32 " joined at %" PRIu64 " µs\n", msg.id, _now);
+        node->id = msg.id;
+        /* boot the node at the current time */
+        node->alarm = _now;
+        _joined++;
+        qsort(_nodes, _numof, sizeof(_nodes[0]), _cmp_id);
+        break;
+    case NATIVE_SIM_IDLE:
+        node->running = false;
+        node->alarm = msg.time;
+        break;
+    case NATIVE_SIM_BUSY:
+        /* input from outside, unless the node is about to run anyway */
+        if (!node->running && node->id != ID_UNKNOWN) {
+            _run(node);
+        }
+        break;
+    default:
+        fprintf(stderr, "sim: unknown message %u from node %" PRIu32 "\n",
+                msg.type, node->id);
+        break;
+    }
+}
+
+static void _handle_io(void)
+{
+    struct pollfd fds[SIM_NODES_MAX + 2] = {
+        { .fd = _sock, .events = POLLIN },
+        { .fd = _listen, .events = POLLIN },
+    };
+    unsigned numof = _numof;
+
+    for (unsigned i = 0; i < numof; i++) {
+        fds[i + 2] = (struct pollfd) { .fd = _nodes[i].fd, .events = POLLIN };
+    }
+
+    if (poll(fds, numof + 2, -1) < 0) {
+        if (errno != EINTR) {
+            perror("poll()");
+            exit(1);
+        }
+        return;
+    }
+
+    /* a node sends its frames before it goes idle, the frames need to be
+     * dispatched first to get their time right */
+    while (_recv(_recv_arg)) {}
+
+    if (fds[1].revents & POLLIN) {
+        _accept();
+    }
+
+    for (unsigned i = 0; i < numof; i++) {
+        if (fds[i + 2].revents) {
+            /* nodes move around when they join or leave */
+            sim_node_t *node = _node_by_fd(fds[i + 2].fd);
+            if (node) {
+                _handle_msg(node);
+            }
+        }
+    }
+}
+
+void sim_set_sender(const struct sockaddr_in6 *src_addr)
+{
+    sim_node_t *sender = NULL;
+
+    if (_params == NULL || _node_by_addr(src_addr)) {
+        return;
+    }
+
+    /* the frame belongs to the node that is running */
+    for (unsigned i = 0; i < _numof; i++) {
+        if (!_nodes[i].running) {
+            continue;
+        }
+        if (sender) {
+            /* can't tell which one */
+            return;
+        }
+        sender = &_nodes[i];
+    }
+
+    if (sender && !sender->has_addr) {
+        sender->addr = *src_addr;
+        sender->has_addr = true;
+    }
+}
+
+ssize_t sim_sendto(int sock, const void *buffer, size_t len,
+                   const struct sockaddr_in6 *dst_addr)
+{
+    sim_node_t *node = _params ? _node_by_addr(dst_addr) : NULL;
+
+    if (node == NULL) {
+        return sendto(sock, buffer, len, 0,
+                      (const struct sockaddr *)dst_addr, sizeof(*dst_addr));
+    }
+
+    /* packet loss */
+    if (_params->loss > 0 && random() < _params->loss * RAND_MAX) {
+        _lost++;
+        return len;
+    }
+
+    sim_frame_t *f = malloc(sizeof(*f) + len);
+    if (f == NULL) {
+        return -1;
+    }
+
+    f->next = NULL;
+    f->time = _now + _params->latency;
+    f->id = node->id;
+    f->len = len;
+    memcpy(f->data, buffer, len);
+
+    if (_tail) {
+        _tail->next = f;
+    }
+    else {
+        _head = f;
+    }
+    _tail = f;
+
+    return len;
+}
+
+int sim_init(const sim_params_t *params)
+{
+    const struct addrinfo hint = {
+        .ai_family   = AF_UNSPEC,
+        .ai_socktype = SOCK_STREAM,
+        .ai_flags    = AI_NUMERICHOST,
+    };
+    struct addrinfo *addr;
+    int one = 1;
+
+    if (getaddrinfo(params->addr, params->port, &hint, &addr) != 0) {
+        return -1;
+    }
+
+    _listen = socket(addr->ai_family, addr->ai_socktype, addr->ai_protocol);
+    if (_listen < 0) {
+        freeaddrinfo(addr);
+        return -1;
+    }
+
+    setsockopt(_listen, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+    if (bind(_listen, addr->ai_addr, addr->ai_addrlen) < 0 ||
+        listen(_listen, SIM_NODES_MAX) < 0) {
+        freeaddrinfo(addr);
+        close(_listen);
+        return -1;
+    }
+    freeaddrinfo(addr);
+
+    _params = params;
+
+    return 0;
+}
+
+void sim_loop(int sock, sim_recv_cb_t recv, void *arg)
+{
+    struct timespec start = { 0 }, stop;
+    bool started = false;
+
+    _sock = sock;
+    _recv = recv;
+    _recv_arg = arg;
+
+    printf("sim: waiting for %u nodes on port %s…\n", _params->nodes,
+           _params->port);
+    fflush(stdout);
+
+    while (1) {
+        uint64_t next = _next();
+
+        /* all nodes are idle before time advances */
+        if (_running() || _joined < _params->nodes) {
+            _handle_io();
+            continue;
+        }
+
+        if (!started) {
+            /* wall time is measured once all nodes are there */
+            clock_gettime(CLOCK_MONOTONIC, &start);
+            started = true;
+        }
+
+        if (next == NATIVE_SIM_NEVER) {
+            if (_numof == 0 && _params->end != NATIVE_SIM_NEVER) {
+                /* all nodes left */
+                break;
+            }
+            /* only input from outside can wake up a node */
+            _handle_io();
+            continue;
+        }
+
+        if (next > _params->end) {
+            _now = _params->end;
+            break;
+        }
+
+        _now = next;
+        _run(_first_due());
+    }
+
+    clock_gettime(CLOCK_MONOTONIC, &stop);
+    double wall = started ? (stop.tv_sec - start.tv_sec)
+                          + (stop.tv_nsec - start.tv_nsec) / 1e9 : 0;
+
+    printf("sim: simulated %" PRIu64 ".%06" PRIu64 " s in %.3f s, "
+           "%" PRIu64 " runs, %" PRIu64 " frames delivered, %" PRIu64 " lost\n",
+           _now / 1000000, _now % 1000000, wall, _runs, _delivered, _lost);
+
+    /* nodes exit when the coordinator goes away */
+    while (_numof) {
+        _remove(&_nodes[_numof - 1]);
+    }
+    while (_head) {
+        sim_frame_t *f = _head;
+        _head = f->next;
+        free(f);
+    }
+    _tail = NULL;
+    fflush(stdout);
+}
@@ -0,0 +1,92 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU General Public
+ * License v2. See the file LICENSE for more details.
+ */
+
+#ifndef SIM_H
+#define SIM_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <sys/types.h>
+#include <netinet/in.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Simulation parameters
+ */
+typedef struct {
+    const char *addr;       /**< address to accept nodes on */
+    const char *port;       /**< TCP port to accept nodes on */
+    unsigned nodes;         /**< number of nodes to wait for before starting */
+    uint32_t latency;       /**< delay of every frame in µs */
+    float loss;             /**< probability of a frame to get lost */
+    uint64_t end;           /**< virtual time in µs to end the simulation at */
+} sim_params_t;
+
+/**
+ * @brief   Callback to receive a frame from the ZEP socket
+ *
+ * @param[in] arg       argument given to @ref sim_loop
+ *
+ * @return true if a frame was received
+ */
+typedef bool (*sim_recv_cb_t)(void *arg);
+
+/**
+ * @brief   Start listening for nodes that run in virtual time
+ *
+ * @param[in] params    simulation parameters, must stay valid
+ *
+ * @return 0 on success, error otherwise
+ */
+int sim_init(const sim_params_t *params);
+
+/**
+ * @brief   Run the simulation until it ends
+ *
+ * Frames are read with @p recv, which must call @ref sim_set_sender before
+ * dispatching a frame.
+ *
+ * @param[in] sock      ZEP socket
+ * @param[in] recv      function to read one frame from the ZEP socket
+ *                      without blocking
+ * @param[in] arg       argument for @p recv
+ */
+void sim_loop(int sock, sim_recv_cb_t recv, void *arg);
+
+/**
+ * @brief   Tell the simulation the source of the frame that is dispatched
+ *
+ * No-op if the simulation is not used.
+ *
+ * @param[in] src_addr  source address of the frame
+ */
+void sim_set_sender(const struct sockaddr_in6 *src_addr);
+
+/**
+ * @brief   Send a frame to a node
+ *
+ * If the destination is a simulated node, the frame is delivered with the
+ * configured latency and loss, otherwise it is sent right away.
+ *
+ * @param[in] sock      ZEP socket
+ * @param[in] buffer    ZEP frame
+ * @param[in] len       ZEP frame length
+ * @param[in] dst_addr  destination address
+ *
+ * @return @p len on success, negative if the frame could not be sent
+ */
+ssize_t sim_sendto(int sock, const void *buffer, size_t len,
+                   const struct sockaddr_in6 *dst_addr);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SIM_H */
@@ -15,6 +15,7 @@
 #include <limits.h>
 
 #include "kernel_defines.h"
+#include "sim.h"
 #include "topology.h"
 #include "zep_parser.h"
 
@@ -247,8 +248,7 @@ void topology_send(const topology_t *t, int sock,
     struct node *sender = NULL;
 
     if (t->has_sniffer) {
-        sendto(sock, buffer, len, 0,
-               (struct sockaddr *)&t->sniffer_addr, sizeof(t->sniffer_addr));
+        sim_sendto(sock, buffer, len, &t->sniffer_addr);
     }
 
     for (list_node_t *edge = t->edges.next; edge; edge = edge->next) {
@@ -269,9 +269,7 @@ void topology_send(const topology_t *t, int sock,
                 continue;
             }
             zep_set_lqi(buffer, super->weight_a_b * 0xFF);
-            sendto(sock, buffer, len, 0,
-                   (struct sockaddr *)&super->b->addr,
-                   sizeof(super->b->addr));
+            sim_sendto(sock, buffer, len, &super->b->addr);
             super->b->num_rx++;
         }
         else if (memcmp(&super->b->addr, src_addr, sizeof(*src_addr)) == 0) {
@@ -285,9 +283,7 @@ void topology_send(const topology_t *t, int sock,
                 continue;
             }
             zep_set_lqi(buffer, super->weight_b_a * 0xFF);
-            sendto(sock, buffer, len, 0,
-                   (struct sockaddr *)&super->a->addr,
-                   sizeof(super->a->addr));
+            sim_sendto(sock, buffer, len, &super->a->addr);
             super->a->num_rx++;
         }
     }
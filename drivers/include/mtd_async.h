@@ -0,0 +1,267 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+#ifndef MTD_ASYNC_H
+#define MTD_ASYNC_H
+
+/**
+ * @defgroup    drivers_mtd_async  Asynchronous MTD requests
+ * @ingroup     drivers_storage
+ * @brief       Queue MTD operations and get notified on completion
+ *
+ * All MTD operations block the calling thread until the device is done. An
+ * erase of a single sector can take tens of milliseconds. This module queues
+ * read, write and erase requests for an MTD device and processes them in the
+ * background, so that the thread submitting them can continue e.g. with
+ * networking. When a request is done, its callback is called.
+ *
+ * Requests are processed by a dedicated I/O thread per device, or, if no stack
+ * is given to @ref mtd_async_init, by calling @ref mtd_async_process from a
+ * thread of the application, e.g. from an event handler.
+ *
+ * Requests are processed in order of submission, with the following
+ * exceptions:
+ *
+ * - A read is moved ahead of pending writes and erases, unless it overlaps
+ *   with one of them.
+ * - Erase requests are split into single sectors while reads are pending, so
+ *   that a read has to wait for one sector erase at most.
+ * - Otherwise, queued erase requests for consecutive sectors are merged into
+ *   a single call to @ref mtd_erase_sector, allowing the driver to use block
+ *   erase commands. Long erases are split into chunks of
+ *   @ref CONFIG_MTD_ASYNC_ERASE_SECTORS_MAX sectors, so that reads submitted
+ *   in the meantime can be served between them.
+ *
+ * The buffers of requests are passed to the MTD driver as they are and must
+ * stay valid until the callback is called. No data is copied, so drivers can
+ * use DMA on them.
+ *
+ * ## Usage
+ *
+ * ```
+ * USEMODULE += mtd_async
+ * ```
+ *
+ * ```
+ * static char stack[THREAD_STACKSIZE_DEFAULT];
+ * static mtd_async_t async;
+ * static mtd_async_req_t req;
+ *
+ * static void _done(mtd_async_req_t *req, int res)
+ * {
+ *     event_post(EVENT_PRIO_MEDIUM, req->arg);
+ * }
+ *
+ * mtd_async_init(&async, MTD_0, stack, sizeof(stack),
+ *                THREAD_PRIORITY_MAIN + 1, "mtd_async");
+ * mtd_async_erase_sector(&async, &req, 0, 1, _done, &erase_done_event);
+ * ```
+ *
+ * @{
+ *
+ * @file
+ * @brief       Interface definitions for asynchronous MTD requests
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "clist.h"
+#include "mtd.h"
+#include "mutex.h"
+#include "sched.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup drivers_mtd_async_config     Asynchronous MTD compile configuration
+ * @ingroup config_drivers_storage
+ * @{
+ */
+/**
+ * @brief   Maximum number of sectors erased at once
+ *
+ * Consecutive erase requests are merged up to this number of sectors. A read
+ * submitted while the erase is running has to wait for all of them.
+ */
+#ifndef CONFIG_MTD_ASYNC_ERASE_SECTORS_MAX
+#define CONFIG_MTD_ASYNC_ERASE_SECTORS_MAX  16
+#endif
+/** @} */
+
+/**
+ * @brief   Thread flag used to wake up the I/O thread
+ */
+#ifndef THREAD_FLAG_MTD_ASYNC
+#define THREAD_FLAG_MTD_ASYNC   (1u << 11)
+#endif
+
+/**
+ * @brief   Operations of asynchronous requests
+ */
+typedef enum {
+    MTD_ASYNC_READ,             /**< @ref mtd_read_page */
+    MTD_ASYNC_WRITE,            /**< @ref mtd_write_page_raw */
+    MTD_ASYNC_WRITE_PAGE,       /**< @ref mtd_write_page */
+    MTD_ASYNC_ERASE,            /**< @ref mtd_erase_sector */
+} mtd_async_op_t;
+
+/**
+ * @brief   Forward declaration of an asynchronous request
+ */
+typedef struct mtd_async_req mtd_async_req_t;
+
+/**
+ * @brief   Signature of the completion callback
+ *
+ * The callback is called from the thread processing the request. The
+ * request may be reused or submitted again from within the callback.
+ *
+ * @param[in] req   the completed request
+ * @param[in] res   0 on success, result of the MTD operation on error
+ */
+typedef void (*mtd_async_cb_t)(mtd_async_req_t *req, int res);
+
+/**
+ * @brief   Asynchronous request
+ *
+ * The request must not be modified between submission and completion.
+ */
+struct mtd_async_req {
+    clist_node_t node;          /**< queue entry */
+    mtd_async_cb_t cb;          /**< completion callback */
+    void *arg;                  /**< argument for the callback */
+    void *buf;                  /**< data to write or buffer to read into */
+    uint32_t page;              /**< page, or first sector for erase */
+    uint32_t offset;            /**< offset within the page */
+    uint32_t len;               /**< bytes, or number of sectors for erase */
+    mtd_async_op_t op;          /**< operation */
+};
+
+/**
+ * @brief   Request queue of an MTD device
+ */
+typedef struct {
+    mtd_dev_t *mtd;             /**< MTD device to queue requests for */
+    clist_node_t queue;         /**< pending requests */
+    mutex_t lock;               /**< lock for the queue */
+    kernel_pid_t pid;           /**< I/O thread, if any */
+} mtd_async_t;
+
+/**
+ * @brief   Initializes the request queue of an MTD device
+ *
+ * The MTD device must be initialized already.
+ *
+ * @param[out] dev          request queue to initialize
+ * @param[in]  mtd          MTD device
+ * @param[in]  stack        stack for the I/O thread, NULL to process requests
+ *                          with @ref mtd_async_process instead
+ * @param[in]  stacksize    size of @p stack
+ * @param[in]  priority     priority of the I/O thread
+ * @param[in]  name         name of the I/O thread
+ *
+ * @retval  0 on success
+ * @retval  <0 if the I/O thread could not be created
+ */
+int mtd_async_init(mtd_async_t *dev, mtd_dev_t *mtd, char *stack,
+                   int stacksize, uint8_t priority, const char *name);
+
+/**
+ * @brief   Submits a prepared request
+ *
+ * Must not be called from interrupt context.
+ *
+ * @param[in] dev   request queue
+ * @param[in] req   request with all fields but @ref mtd_async_req_t::node set
+ */
+void mtd_async_submit(mtd_async_t *dev, mtd_async_req_t *req);
+
+/**
+ * @brief   Processes the next step of the pending requests
+ *
+ * Only needs to be called when @ref mtd_async_init was called without stack.
+ *
+ * @param[in] dev   request queue
+ *
+ * @return  true, if more requests are pending
+ */
+bool mtd_async_process(mtd_async_t *dev);
+
+/**
+ * @brief   Submits an asynchronous @ref mtd_read_page
+ *
+ * @param[in]  dev      request queue
+ * @param[out] req      request to use
+ * @param[out] dest     buffer to read into
+ * @param[in]  page     page to read from
+ * @param[in]  offset   offset within @p page
+ * @param[in]  size     number of bytes to read
+ * @param[in]  cb       completion callback
+ * @param[in]  arg      argument for @p cb
+ */
+void mtd_async_read_page(mtd_async_t *dev, mtd_async_req_t *req, void *dest,
+                         uint32_t page, uint32_t offset, uint32_t size,
+                         mtd_async_cb_t cb, void *arg);
+
+/**
+ * @brief   Submits an asynchronous @ref mtd_write_page_raw
+ *
+ * @param[in]  dev      request queue
+ * @param[out] req      request to use
+ * @param[in]  src      data to write
+ * @param[in]  page     page to write to
+ * @param[in]  offset   offset within @p page
+ * @param[in]  size     number of bytes to write
+ * @param[in]  cb       completion callback
+ * @param[in]  arg      argument for @p cb
+ */
+void mtd_async_write_page_raw(mtd_async_t *dev, mtd_async_req_t *req,
+                              const void *src, uint32_t page, uint32_t offset,
+                              uint32_t size, mtd_async_cb_t cb, void *arg);
+
+#if defined(MODULE_MTD_WRITE_PAGE) || DOXYGEN
+/**
+ * @brief   Submits an asynchronous @ref mtd_write_page
+ *
+ * @param[in]  dev      request queue
+ * @param[out] req      request to use
+ * @param[in]  src      data to write
+ * @param[in]  page     page to write to
+ * @param[in]  offset   offset within @p page
+ * @param[in]  size     number of bytes to write
+ * @param[in]  cb       completion callback
+ * @param[in]  arg      argument for @p cb
+ */
+void mtd_async_write_page(mtd_async_t *dev, mtd_async_req_t *req,
+                          const void *src, uint32_t page, uint32_t offset,
+                          uint32_t size, mtd_async_cb_t cb, void *arg);
+#endif
+
+/**
+ * @brief   Submits an asynchronous @ref mtd_erase_sector
+ *
+ * @param[in]  dev      request queue
+ * @param[out] req      request to use
+ * @param[in]  sector   first sector to erase
+ * @param[in]  count    number of sectors to erase
+ * @param[in]  cb       completion callback
+ * @param[in]  arg      argument for @p cb
+ */
+void mtd_async_erase_sector(mtd_async_t *dev, mtd_async_req_t *req,
+                            uint32_t sector, uint32_t count,
+                            mtd_async_cb_t cb, void *arg);
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
+#endif /* MTD_ASYNC_H */
@@ -0,0 +1,135 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+#ifndef MTD_CACHE_H
+#define MTD_CACHE_H
+
+/**
+ * @defgroup    drivers_mtd_cache  MTD write-back cache
+ * @ingroup     drivers_storage
+ * @brief       Sector cache on top of another MTD device
+ *
+ * This MTD module keeps recently written sectors of another MTD device in RAM
+ * and presents the result as a separate MTD device, similar to
+ * @ref drivers_mtd_mapper.
+ *
+ * Writes to a cached sector are coalesced in RAM. Erasing a cached sector only
+ * marks the cached copy. When a sector is written back, it is erased at most
+ * once. If the cached data only clears bits compared to the content on the
+ * device, the sector is not erased at all and only the changed range is
+ * programmed.
+ *
+ * The cache device allows to overwrite data without erasing it first
+ * (@ref MTD_DRIVER_FLAG_DIRECT_WRITE) with a write size of one byte, so
+ * @ref mtd_write_page does not need a read-modify-write cycle of its own.
+ *
+ * Sectors are cached when they are written. Reads are served from the cache
+ * if the sector is cached and passed to the backing device otherwise. If all
+ * cache lines are in use, the least recently used one is written back.
+ *
+ * @warning Data is only guaranteed to be on the backing device after
+ *          @ref mtd_cache_flush or powering the cache device down with
+ *          @ref mtd_power.
+ *
+ * ## Usage
+ *
+ * To use this module include it in your makefile:
+ *
+ * ```
+ * USEMODULE += mtd_cache
+ * ```
+ *
+ * Each cache line needs a buffer of the sector size of the backing device:
+ *
+ * ```
+ * static mtd_cache_line_t lines[2];
+ * static uint8_t buf[2 * SECTOR_SIZE];
+ *
+ * static mtd_cache_t cache = MTD_CACHE_INIT(MTD_0, lines, buf);
+ *
+ * mtd_dev_t *dev = &cache.mtd;
+ * ```
+ *
+ * @{
+ *
+ * @file
+ * @brief       Interface definitions for the MTD write-back cache
+ */
+
+#include <stdint.h>
+
+#include "container.h"
+#include "mtd.h"
+#include "mutex.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Shortcut macro for initializing a @ref mtd_cache_t
+ *
+ * @param   _parent     backing MTD device
+ * @param   _lines      array of @ref mtd_cache_line_t
+ * @param   _buf        buffer of `ARRAY_SIZE(_lines)` sectors
+ */
+#define MTD_CACHE_INIT(_parent, _lines, _buf) \
+{ \
+    .mtd = { .driver = &mtd_cache_driver }, \
+    .parent = _parent, \
+    .lines = _lines, \
+    .buf = _buf, \
+    .lines_numof = ARRAY_SIZE(_lines), \
+    .lock = MUTEX_INIT, \
+}
+
+/**
+ * @brief   State of a cache line
+ */
+typedef struct {
+    uint32_t sector;            /**< cached sector */
+    uint32_t last_used;         /**< time stamp of last access */
+    uint32_t dirty_start;       /**< first changed byte in the sector */
+    uint32_t dirty_end;         /**< end of changed bytes in the sector */
+    uint8_t flags;              /**< internal flags */
+} mtd_cache_line_t;
+
+/**
+ * @brief   MTD write-back cache device
+ */
+typedef struct {
+    mtd_dev_t mtd;              /**< MTD context */
+    mtd_dev_t *parent;          /**< backing MTD device */
+    mtd_cache_line_t *lines;    /**< cache lines */
+    uint8_t *buf;               /**< one sector per cache line */
+    uint8_t lines_numof;        /**< number of cache lines */
+    uint32_t clock;             /**< time stamp of last access */
+    mutex_t lock;               /**< lock for the cache */
+} mtd_cache_t;
+
+/**
+ * @brief   MTD cache device operations table
+ */
+extern const mtd_desc_t mtd_cache_driver;
+
+/**
+ * @brief   Writes all changed sectors back to the backing device
+ *
+ * @param[in] cache The cache device
+ *
+ * @retval 0 on success
+ * @retval <0 error of the backing device
+ */
+int mtd_cache_flush(mtd_cache_t *cache);
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
+#endif /* MTD_CACHE_H */
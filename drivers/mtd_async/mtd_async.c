@@ -0,0 +1,287 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     drivers_mtd_async
+ * @{
+ *
+ * @file
+ * @brief       Asynchronous MTD request queue implementation
+ *
+ * @}
+ */
+
+#include <errno.h>
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "container.h"
+#include "mtd.h"
+#include "mtd_async.h"
+#include "mutex.h"
+#include "thread.h"
+#include "thread_flags.h"
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+static uint64_t _start(const mtd_async_t *dev, const mtd_async_req_t *req)
+{
+    const mtd_dev_t *mtd = dev->mtd;
+
+    if (req->op == MTD_ASYNC_ERASE) {
+        return (uint64_t)req->page * mtd->pages_per_sector * mtd->page_size;
+    }
+    return (uint64_t)req->page * mtd->page_size + req->offset;
+}
+
+static uint64_t _end(const mtd_async_t *dev, const mtd_async_req_t *req)
+{
+    const mtd_dev_t *mtd = dev->mtd;
+
+    if (req->op == MTD_ASYNC_ERASE) {
+        return _start(dev, req) +
+               (uint64_t)req->len * mtd->pages_per_sector * mtd->page_size;
+    }
+    return _start(dev, req) + req->len;
+}
+
+static bool _overlaps(const mtd_async_t *dev, const mtd_async_req_t *a,
+                      const mtd_async_req_t *b)
+{
+    return (_start(dev, a) < _end(dev, b)) && (_start(dev, b) < _end(dev, a));
+}
+
+/* picks the request to process next, must be called with the lock held */
+static mtd_async_req_t *_next(mtd_async_t *dev, bool *reads_pending)
+{
+    clist_node_t *head = dev->queue.next->next;
+    clist_node_t *node = head;
+
+    *reads_pending = false;
+    do {
+        mtd_async_req_t *req = container_of(node, mtd_async_req_t, node);
+        bool blocked = false;
+
+        if (req->op != MTD_ASYNC_READ) {
+            node = node->next;
+            continue;
+        }
+        *reads_pending = true;
+        /* reads may only pass requests that do not change their range */
+        for (clist_node_t *prev = head; prev != node; prev = prev->next) {
+            const mtd_async_req_t *tmp = container_of(prev, mtd_async_req_t, node);
+
+            if ((tmp->op != MTD_ASYNC_READ) && _overlaps(dev, tmp, req)) {
+                blocked = true;
+                break;
+            }
+        }
+        if (!blocked) {
+            return req;
+        }
+        node = node->next;
+    } while (node != head);
+    return container_of(head, mtd_async_req_t, node);
+}
+
+static int _execute(mtd_async_t *dev, mtd_async_req_t *req)
+{
+    switch (req->op) {
+    case MTD_ASYNC_READ:
+        return mtd_read_page(dev->mtd, req->buf, req->page, req->offset,
+                             req->len);
+    case MTD_ASYNC_WRITE:
+        return mtd_write_page_raw(dev->mtd, req->buf, req->page, req->offset,
+                                  req->len);
+#ifdef MODULE_MTD_WRITE_PAGE
+    case MTD_ASYNC_WRITE_PAGE:
+        return mtd_write_page(dev->mtd, req->buf, req->page, req->offset,
+                              req->len);
+#endif
+    default:
+        return -ENOTSUP;
+    }
+}
+
+static void _erase(mtd_async_t *dev, mtd_async_req_t *req, bool reads_pending)
+{
+    clist_node_t done = { .next = NULL };
+    uint32_t sector = req->page;
+    uint32_t count = req->len;
+    int res;
+
+    if (reads_pending) {
+        /* erase one sector at a time to serve reads in between */
+        count = 1;
+    }
+    else if (count > CONFIG_MTD_ASYNC_ERASE_SECTORS_MAX) {
+        /* keep the time a new read has to wait bounded */
+        count = CONFIG_MTD_ASYNC_ERASE_SECTORS_MAX;
+    }
+    if (count < req->len) {
+        /* the request stays at the head of the queue until it is done */
+        mutex_unlock(&dev->lock);
+        res = mtd_erase_sector(dev->mtd, sector, count);
+        mutex_lock(&dev->lock);
+        req->page += count;
+        req->len -= count;
+        if (res == 0) {
+            mutex_unlock(&dev->lock);
+            return;
+        }
+        clist_remove(&dev->queue, &req->node);
+        mutex_unlock(&dev->lock);
+        req->cb(req, res);
+        return;
+    }
+
+    /* merge with directly following erase requests of the next sectors */
+    clist_remove(&dev->queue, &req->node);
+    clist_rpush(&done, &req->node);
+    while (!reads_pending && !clist_is_empty(&dev->queue)) {
+        mtd_async_req_t *next = container_of(clist_lpeek(&dev->queue),
+                                             mtd_async_req_t, node);
+
+        if ((next->op != MTD_ASYNC_ERASE) || (next->page != sector + count) ||
+            (count + next->len > CONFIG_MTD_ASYNC_ERASE_SECTORS_MAX)) {
+            break;
+        }
+        count += next->len;
+        clist_lpop(&dev->queue);
+        clist_rpush(&done, &next->node);
+    }
+    mutex_unlock(&dev->lock);
+
+    DEBUG("mtd_async: erase %" PRIu32 " sectors from %" PRIu32 "\n",
+          count, sector);
+    res = mtd_erase_sector(dev->mtd, sector, count);
+
+    clist_node_t *node;
+    while ((node = clist_lpop(&done))) {
+        req = container_of(node, mtd_async_req_t, node);
+        req->cb(req, res);
+    }
+}
+
+bool mtd_async_process(mtd_async_t *dev)
+{
+    mtd_async_req_t *req;
+    bool reads_pending;
+    bool pending;
+
+    mutex_lock(&dev->lock);
+    if (clist_is_empty(&dev->queue)) {
+        mutex_unlock(&dev->lock);
+        return false;
+    }
+    req = _next(dev, &reads_pending);
+    if (req->op == MTD_ASYNC_ERASE) {
+        /* only a read that is not blocked by the erase would have been
+         * picked before, so all pending reads wait for this one */
+        _erase(dev, req, reads_pending);
+    }
+    else {
+        clist_remove(&dev->queue, &req->node);
+        mutex_unlock(&dev->lock);
+        req->cb(req, _execute(dev, req));
+    }
+
+    mutex_lock(&dev->lock);
+    pending = !clist_is_empty(&dev->queue);
+    mutex_unlock(&dev->lock);
+    return pending;
+}
+
+static void *_thread(void *arg)
+{
+    mtd_async_t *dev = arg;
+
+    while (1) {
+        thread_flags_wait_any(THREAD_FLAG_MTD_ASYNC);
+        while (mtd_async_process(dev)) {}
+    }
+    return NULL;
+}
+
+int mtd_async_init(mtd_async_t *dev, mtd_dev_t *mtd, char *stack,
+                   int stacksize, uint8_t priority, const char *name)
+{
+    dev->mtd = mtd;
+    dev->queue.next = NULL;
+    mutex_init(&dev->lock);
+    dev->pid = KERNEL_PID_UNDEF;
+
+    if (stack == NULL) {
+        return 0;
+    }
+
+    int res = thread_create(stack, stacksize, priority, 0, _thread, dev, name);
+
+    if (res < 0) {
+        return res;
+    }
+    dev->pid = res;
+    return 0;
+}
+
+void mtd_async_submit(mtd_async_t *dev, mtd_async_req_t *req)
+{
+    mutex_lock(&dev->lock);
+    clist_rpush(&dev->queue, &req->node);
+    mutex_unlock(&dev->lock);
+    if (pid_is_valid(dev->pid)) {
+        thread_flags_set(thread_get(dev->pid), THREAD_FLAG_MTD_ASYNC);
+    }
+}
+
+static void _submit(mtd_async_t *dev, mtd_async_req_t *req, mtd_async_op_t op,
+                    void *buf, uint32_t page, uint32_t offset, uint32_t len,
+                    mtd_async_cb_t cb, void *arg)
+{
+    req->op = op;
+    req->buf = buf;
+    req->page = page;
+    req->offset = offset;
+    req->len = len;
+    req->cb = cb;
+    req->arg = arg;
+    mtd_async_submit(dev, req);
+}
+
+void mtd_async_read_page(mtd_async_t *dev, mtd_async_req_t *req, void *dest,
+                         uint32_t page, uint32_t offset, uint32_t size,
+                         mtd_async_cb_t cb, void *arg)
+{
+    _submit(dev, req, MTD_ASYNC_READ, dest, page, offset, size, cb, arg);
+}
+
+void mtd_async_write_page_raw(mtd_async_t *dev, mtd_async_req_t *req,
+                              const void *src, uint32_t page, uint32_t offset,
+                              uint32_t size, mtd_async_cb_t cb, void *arg)
+{
+    _submit(dev, req, MTD_ASYNC_WRITE, (void *)src, page, offset, size, cb, arg);
+}
+
+#ifdef MODULE_MTD_WRITE_PAGE
+void mtd_async_write_page(mtd_async_t *dev, mtd_async_req_t *req,
+                          const void *src, uint32_t page, uint32_t offset,
+                          uint32_t size, mtd_async_cb_t cb, void *arg)
+{
+    _submit(dev, req, MTD_ASYNC_WRITE_PAGE, (void *)src, page, offset, size,
+            cb, arg);
+}
+#endif
+
+void mtd_async_erase_sector(mtd_async_t *dev, mtd_async_req_t *req,
+                            uint32_t sector, uint32_t count,
+                            mtd_async_cb_t cb, void *arg)
+{
+    _submit(dev, req, MTD_ASYNC_ERASE, NULL, sector, 0, count, cb, arg);
+}
@@ -0,0 +1,328 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     drivers_mtd_cache
+ * @{
+ *
+ * @file
+ * @brief       MTD write-back cache implementation
+ *
+ * @}
+ */
+
+#include <assert.h>
+#include <errno.h>
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "macros/math.h"
+#include "macros/utils.h"
+#include "mtd.h"
+#include "mtd_cache.h"
+#include "mutex.h"
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+#define _VALID              (0x01U) /**< line holds a sector */
+#define _ERASED             (0x02U) /**< sector needs to be erased on write back */
+
+/* chunk size to compare cached data with the backing device */
+#define _CMP_CHUNK_SIZE     (32U)
+
+static uint32_t _sector_size(const mtd_cache_t *cache)
+{
+    return cache->mtd.pages_per_sector * cache->mtd.page_size;
+}
+
+static uint8_t *_line_buf(const mtd_cache_t *cache, const mtd_cache_line_t *line)
+{
+    return &cache->buf[(line - cache->lines) * _sector_size(cache)];
+}
+
+static bool _is_dirty(const mtd_cache_line_t *line)
+{
+    return (line->dirty_end > line->dirty_start) || (line->flags & _ERASED);
+}
+
+static void _touch(mtd_cache_t *cache, mtd_cache_line_t *line)
+{
+    line->last_used = ++cache->clock;
+}
+
+static mtd_cache_line_t *_find(mtd_cache_t *cache, uint32_t sector)
+{
+    for (unsigned i = 0; i < cache->lines_numof; i++) {
+        mtd_cache_line_t *line = &cache->lines[i];
+
+        if ((line->flags & _VALID) && (line->sector == sector)) {
+            return line;
+        }
+    }
+    return NULL;
+}
+
+/* checks if the changed range of a line can be programmed without erasing
+ * the sector first */
+static int _programmable(mtd_cache_t *cache, const mtd_cache_line_t *line,
+                         uint32_t start, uint32_t end)
+{
+    const bool overwrite = cache->parent->driver->flags &
+                           MTD_DRIVER_FLAG_CLEARING_OVERWRITE;
+    const uint8_t *data = _line_buf(cache, line);
+    const uint32_t page = line->sector * cache->mtd.pages_per_sector;
+
+    if (cache->parent->driver->flags & MTD_DRIVER_FLAG_DIRECT_WRITE) {
+        return 1;
+    }
+    for (uint32_t pos = start; pos < end; pos += _CMP_CHUNK_SIZE) {
+        uint8_t flash[_CMP_CHUNK_SIZE];
+        uint32_t len = MIN(_CMP_CHUNK_SIZE, end - pos);
+        int res = mtd_read_page(cache->parent, flash, page, pos, len);
+
+        if (res < 0) {
+            return res;
+        }
+        for (unsigned i = 0; i < len; i++) {
+            /* programming can only clear bits, and without
+             * MTD_DRIVER_FLAG_CLEARING_OVERWRITE only once */
+            if (overwrite ? (data[pos + i] & ~flash[i]) : (flash[i] != 0xff)) {
+                return 0;
+            }
+        }
+    }
+    return 1;
+}
+
+static int _write_back(mtd_cache_t *cache, mtd_cache_line_t *line)
+{
+    const uint8_t *data = _line_buf(cache, line);
+    const uint32_t write_size = cache->parent->write_size;
+    uint32_t start = line->dirty_start;
+    uint32_t end = line->dirty_end;
+    int res = 0;
+
+    if (!_is_dirty(line)) {
+        return 0;
+    }
+    start = (start / write_size) * write_size;
+    end = DIV_ROUND_UP(end, write_size) * write_size;
+    if (!(line->flags & _ERASED)) {
+        res = _programmable(cache, line, start, end);
+        if (res < 0) {
+            return res;
+        }
+    }
+    if (res == 0) {
+        /* erase and program everything that is not erased */
+        const uint32_t sector_size = _sector_size(cache);
+
+        DEBUG("mtd_cache: erase sector %" PRIu32 "\n", line->sector);
+        res = mtd_erase_sector(cache->parent, line->sector, 1);
+        if (res < 0) {
+            return res;
+        }
+        for (start = 0; (start < sector_size) && (data[start] == 0xff); start++) {}
+        for (end = sector_size; (end > start) && (data[end - 1] == 0xff); end--) {}
+        start = (start / write_size) * write_size;
+        end = DIV_ROUND_UP(end, write_size) * write_size;
+    }
+    if (end > start) {
+        DEBUG("mtd_cache: program sector %" PRIu32 " [%" PRIu32 ", %" PRIu32 ")\n",
+              line->sector, start, end);
+        res = mtd_write_page_raw(cache->parent, data + start,
+                                 line->sector * cache->mtd.pages_per_sector,
+                                 start, end - start);
+        if (res < 0) {
+            return res;
+        }
+    }
+    line->flags &= ~_ERASED;
+    line->dirty_start = 0;
+    line->dirty_end = 0;
+    return 0;
+}
+
+static int _alloc(mtd_cache_t *cache, uint32_t sector, bool load,
+                  mtd_cache_line_t **res_line)
+{
+    mtd_cache_line_t *line = &cache->lines[0];
+    int res;
+
+    for (unsigned i = 0; i < cache->lines_numof; i++) {
+        mtd_cache_line_t *tmp = &cache->lines[i];
+
+        if (!(tmp->flags & _VALID)) {
+            line = tmp;
+            break;
+        }
+        /* evict the least recently used line */
+        if ((int32_t)(tmp->last_used - line->last_used) < 0) {
+            line = tmp;
+        }
+    }
+    if ((line->flags & _VALID) && ((res = _write_back(cache, line)) < 0)) {
+        return res;
+    }
+    line->flags = 0;
+    if (load) {
+        res = mtd_read_page(cache->parent, _line_buf(cache, line),
+                            sector * cache->mtd.pages_per_sector, 0,
+                            _sector_size(cache));
+        if (res < 0) {
+            return res;
+        }
+    }
+    line->flags = _VALID;
+    line->sector = sector;
+    line->dirty_start = 0;
+    line->dirty_end = 0;
+    *res_line = line;
+    return 0;
+}
+
+static int _init(mtd_dev_t *mtd)
+{
+    mtd_cache_t *cache = container_of(mtd, mtd_cache_t, mtd);
+    mtd_dev_t *parent = cache->parent;
+    int res;
+
+    assert(cache->lines && cache->buf && (cache->lines_numof > 0));
+
+    mutex_lock(&cache->lock);
+    res = mtd_init(parent);
+    if (res == 0) {
+        /* inherit physical properties */
+        mtd->sector_count = parent->sector_count;
+        mtd->pages_per_sector = parent->pages_per_sector;
+        mtd->page_size = parent->page_size;
+        /* alignment is taken care of on write back */
+        mtd->write_size = 1;
+        memset(cache->lines, 0, cache->lines_numof * sizeof(*cache->lines));
+    }
+    mutex_unlock(&cache->lock);
+    return res;
+}
+
+static int _read_page(mtd_dev_t *mtd, void *dest, uint32_t page,
+                      uint32_t offset, uint32_t size)
+{
+    mtd_cache_t *cache = container_of(mtd, mtd_cache_t, mtd);
+    const uint32_t sector = page / mtd->pages_per_sector;
+    const uint32_t pos = (page % mtd->pages_per_sector) * mtd->page_size + offset;
+    mtd_cache_line_t *line;
+    int res = 0;
+
+    /* do not read beyond the sector, the next one might be cached */
+    size = MIN(size, _sector_size(cache) - pos);
+    mutex_lock(&cache->lock);
+    if ((line = _find(cache, sector))) {
+        _touch(cache, line);
+        memcpy(dest, _line_buf(cache, line) + pos, size);
+    }
+    else {
+        res = mtd_read_page(cache->parent, dest, page, offset, size);
+    }
+    mutex_unlock(&cache->lock);
+    return (res < 0) ? res : (int)size;
+}
+
+static int _write_page(mtd_dev_t *mtd, const void *src, uint32_t page,
+                       uint32_t offset, uint32_t size)
+{
+    mtd_cache_t *cache = container_of(mtd, mtd_cache_t, mtd);
+    const uint32_t sector = page / mtd->pages_per_sector;
+    const uint32_t pos = (page % mtd->pages_per_sector) * mtd->page_size + offset;
+    mtd_cache_line_t *line;
+    int res = 0;
+
+    size = MIN(size, _sector_size(cache) - pos);
+    mutex_lock(&cache->lock);
+    if (!(line = _find(cache, sector))) {
+        /* no need to load what is overwritten completely */
+        res = _alloc(cache, sector, size < _sector_size(cache), &line);
+    }
+    if (res == 0) {
+        _touch(cache, line);
+        memcpy(_line_buf(cache, line) + pos, src, size);
+        if (line->dirty_end > line->dirty_start) {
+            line->dirty_start = MIN(line->dirty_start, pos);
+            line->dirty_end = MAX(line->dirty_end, pos + size);
+        }
+        else {
+            line->dirty_start = pos;
+            line->dirty_end = pos + size;
+        }
+    }
+    mutex_unlock(&cache->lock);
+    return (res < 0) ? res : (int)size;
+}
+
+static int _erase_sector(mtd_dev_t *mtd, uint32_t sector, uint32_t count)
+{
+    mtd_cache_t *cache = container_of(mtd, mtd_cache_t, mtd);
+    int res = 0;
+
+    mutex_lock(&cache->lock);
+    for (uint32_t i = sector; (i < sector + count) && (res == 0); i++) {
+        mtd_cache_line_t *line = _find(cache, i);
+
+        if (line == NULL) {
+            res = mtd_erase_sector(cache->parent, i, 1);
+            continue;
+        }
+        /* defer erasing the device until the line is written back */
+        _touch(cache, line);
+        memset(_line_buf(cache, line), 0xff, _sector_size(cache));
+        line->flags |= _ERASED;
+        line->dirty_start = 0;
+        line->dirty_end = 0;
+    }
+    mutex_unlock(&cache->lock);
+    return res;
+}
+
+static int _power(mtd_dev_t *mtd, enum mtd_power_state power)
+{
+    mtd_cache_t *cache = container_of(mtd, mtd_cache_t, mtd);
+
+    if (power == MTD_POWER_DOWN) {
+        int res = mtd_cache_flush(cache);
+
+        if (res < 0) {
+            return res;
+        }
+    }
+    return mtd_power(cache->parent, power);
+}
+
+int mtd_cache_flush(mtd_cache_t *cache)
+{
+    int res = 0;
+
+    mutex_lock(&cache->lock);
+    for (unsigned i = 0; (i < cache->lines_numof) && (res == 0); i++) {
+        if (cache->lines[i].flags & _VALID) {
+            res = _write_back(cache, &cache->lines[i]);
+        }
+    }
+    mutex_unlock(&cache->lock);
+    return res;
+}
+
+const mtd_desc_t mtd_cache_driver = {
+    .init = _init,
+    .read_page = _read_page,
+    .write_page = _write_page,
+    .erase_sector = _erase_sector,
+    .power = _power,
+    .flags = MTD_DRIVER_FLAG_DIRECT_WRITE,
+};
@@ -14,6 +14,7 @@ endif
 export VALGRIND ?= valgrind
 export CGANNOTATE ?= cg_annotate
 export GPROF ?= gprof
+export NATIVE_PROF ?= prof.txt
 
 # basic cflags:
 CFLAGS += -Wall -Wextra $(CFLAGS_DBG) $(CFLAGS_OPT)
@@ -166,5 +167,8 @@ term-gprof: term
 eval-gprof:
 	$(GPROF) $(ELFFILE) $(shell ls -rt gmon.out* | tail -1)
 
+eval-prof:
+	$(RIOTTOOLS)/native_prof/native_prof.py $(ELFFILE) $(NATIVE_PROF)
+
 eval-cachegrind:
 	$(CGANNOTATE) $(shell ls -rt cachegrind.out* | tail -1)
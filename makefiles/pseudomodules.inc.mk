@@ -22,6 +22,8 @@
 
 PSEUDOMODULES += atomic_utils
 PSEUDOMODULES += base64url
+PSEUDOMODULES += benchmark_csv
+PSEUDOMODULES += benchmark_json
 
 ## @defgroup pseudomodule_board_software_reset board_software_reset
 ## @brief Use any software-only reset button on the board to reboot
@@ -57,9 +59,13 @@ PSEUDOMODULES += core_%
 PSEUDOMODULES += cortexm_fpu
 PSEUDOMODULES += cortexm_svc
 PSEUDOMODULES += cpp
+PSEUDOMODULES += cpp_gnrc
 PSEUDOMODULES += cpu_check_address
 PSEUDOMODULES += crc16_fast
 PSEUDOMODULES += crc32_fast
+PSEUDOMODULES += crc32_hw
+PSEUDOMODULES += crc32_slice4
+PSEUDOMODULES += crc32_slice8
 PSEUDOMODULES += credman_load
 PSEUDOMODULES += dbgpin
 PSEUDOMODULES += devfs_%
@@ -113,6 +119,16 @@ PSEUDOMODULES += gnrc_ipv6_auto_subnets_simple
 PSEUDOMODULES += gnrc_ipv6_classic
 PSEUDOMODULES += gnrc_ipv6_default
 PSEUDOMODULES += gnrc_ipv6_ext_frag_stats
+## @defgroup net_gnrc_ipv6_prio_lane gnrc_ipv6_prio_lane: Prioritize IPv6 control traffic
+## @ingroup  net_gnrc_ipv6
+## @brief    Handle ICMPv6 messages of the IPv6 thread ahead of bulk data
+##
+## The IPv6 thread holds back data packets of either direction while ICMPv6
+## packets (including NDP and RPL) or NIB events are pending. Up to
+## `GNRC_IPV6_BULK_QUEUE_SIZE` data packets are held back, their order is kept.
+## @{
+PSEUDOMODULES += gnrc_ipv6_prio_lane
+## @}
 PSEUDOMODULES += gnrc_ipv6_router
 PSEUDOMODULES += gnrc_ipv6_router_default
 PSEUDOMODULES += gnrc_ipv6_nib_6lbr
@@ -130,6 +146,15 @@ PSEUDOMODULES += gnrc_netif_bus
 PSEUDOMODULES += gnrc_netif_timestamp
 PSEUDOMODULES += gnrc_netif_6lo
 PSEUDOMODULES += gnrc_netif_ipv6
+## @defgroup net_gnrc_netif_ipv6_fastfwd gnrc_netif_ipv6_fastfwd: IPv6 fast-forwarding
+## @ingroup  net_gnrc_netif
+## @brief    Forward IPv6 packets with a resolved next hop directly from the receiving interface
+##
+## Plain unicast packets to a neighbor already known to be reachable bypass
+## the IPv6 thread. All other packets still take the regular forwarding path.
+## @{
+PSEUDOMODULES += gnrc_netif_ipv6_fastfwd
+## @}
 PSEUDOMODULES += gnrc_netif_mac
 PSEUDOMODULES += gnrc_netif_single
 PSEUDOMODULES += gnrc_netif_dedup
@@ -214,6 +239,14 @@ PSEUDOMODULES += gnrc_sixloenc
 PSEUDOMODULES += gnrc_sixlowpan_border_router_default
 PSEUDOMODULES += gnrc_sixlowpan_default
 PSEUDOMODULES += gnrc_sixlowpan_frag_hint
+## @defgroup net_gnrc_sixlowpan_frag_rb_hash gnrc_sixlowpan_frag_rb_hash: Hashed reassembly buffer look-up
+## @ingroup  net_gnrc_sixlowpan_frag_rb
+## @brief    Look up reassembly buffer entries through a hash over (source, destination, tag)
+##
+## See @ref CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_HASH_SIZE for the number of buckets.
+## @{
+PSEUDOMODULES += gnrc_sixlowpan_frag_rb_hash
+## @}
 PSEUDOMODULES += gnrc_sixlowpan_frag_sfr_ecn
 PSEUDOMODULES += gnrc_sixlowpan_frag_sfr_ecn_if_in
 PSEUDOMODULES += gnrc_sixlowpan_frag_sfr_ecn_if_out
@@ -336,6 +369,8 @@ PSEUDOMODULES += newlib
 PSEUDOMODULES += newlib_gnu_source
 PSEUDOMODULES += newlib_nano
 PSEUDOMODULES += nrf24l01p_ng_diagnostics
+PSEUDOMODULES += objpool_cache
+PSEUDOMODULES += objpool_stats
 PSEUDOMODULES += opendsme
 PSEUDOMODULES += openthread
 PSEUDOMODULES += picolibc
@@ -402,6 +437,16 @@ PSEUDOMODULES += servo_timer
 PSEUDOMODULES += servo_saul
 ## @}
 
+## @defgroup pseudomodule_sha256_fast sha256_fast
+## @ingroup sys_hashes_sha256
+## @brief Unrolled SHA-224/SHA-256 compression function, larger but faster
+PSEUDOMODULES += sha256_fast
+## @defgroup pseudomodule_sha256_hw sha256_hw
+## @ingroup sys_hashes_sha256
+## @brief Use the x86 SHA extensions or the ARMv8 cryptographic extension
+##        for SHA-224/SHA-256, if available
+PSEUDOMODULES += sha256_hw
+
 PSEUDOMODULES += shell_builtin_cmd_help_json
 PSEUDOMODULES += shell_cmd_app_metadata
 PSEUDOMODULES += shell_cmd_at30tse75x
@@ -434,6 +479,7 @@ PSEUDOMODULES += shell_cmd_iw
 PSEUDOMODULES += shell_cmd_lwip_netif
 PSEUDOMODULES += shell_cmd_mci
 PSEUDOMODULES += shell_cmd_md5sum
+PSEUDOMODULES += shell_cmd_mutex_profiling
 PSEUDOMODULES += shell_cmd_nanocoap_vfs
 PSEUDOMODULES += shell_cmd_netstats_neighbor
 PSEUDOMODULES += shell_cmd_nice
@@ -508,6 +554,11 @@ PSEUDOMODULES += suit_storage_%
 PSEUDOMODULES += sys_bus_%
 PSEUDOMODULES += tiny_strerror_as_strerror
 PSEUDOMODULES += tiny_strerror_minimal
+PSEUDOMODULES += trace_msg
+PSEUDOMODULES += trace_netif
+PSEUDOMODULES += trace_pktbuf
+PSEUDOMODULES += trace_sched
+PSEUDOMODULES += trace_ztimer
 PSEUDOMODULES += usbus_urb
 PSEUDOMODULES += vdd_lc_filter_%
 ## @defgroup pseudomodule_vfs_auto_format vfs_auto_format
@@ -601,6 +652,9 @@ PSEUDOMODULES += crypto_aes_256
 PSEUDOMODULES += crypto_aes_precalculated
 # This pseudomodule causes a loop in AES to be unrolled (more flash, less CPU)
 PSEUDOMODULES += crypto_aes_unroll
+# Use the AES instructions of the CPU (AES-NI, ARMv8 crypto) for multi-block
+# encryption if available
+PSEUDOMODULES += crypto_aes_hw
 
 # declare shell version of test_utils_interactive_sync
 PSEUDOMODULES += test_utils_interactive_sync_shell
@@ -17,12 +17,40 @@
  * block. This implementation replaces the system malloc
  *
  * Additionally, the calls to TLSF are wrapped in irq_disable()/irq_restore(),
- * to make it thread-safe.
+ * to make it thread-safe. As all TLSF operations take constant time, the
+ * time interrupts are disabled is bounded.
  *
- * If this module is used as the system memory allocator, then the global memory
- * control block should be initialized as the first thing before the stdlib is
- * used. Boards should use tlsf_add_global_pool() at startup to add all the memory
- * regions they want to make available for dynamic allocation via malloc().
+ * If no memory was added with tlsf_add_global_pool() when the first
+ * allocation takes place, the heap of the platform is added: the memory
+ * between `_sheap` and `_eheap` (and the further heaps of `NUM_HEAPS`) with
+ * newlib, a static array of @ref CONFIG_TLSF_MALLOC_NATIVE_HEAP_SIZE bytes
+ * on native. Boards may also use tlsf_add_global_pool() at startup to add all
+ * the memory regions they want to make available for dynamic allocation via
+ * malloc().
+ *
+ * # Fragmentation
+ *
+ * tlsf_malloc_get_stats() reports the used and free memory, the largest free
+ * block and a histogram of the sizes of the free blocks. An allocation fails
+ * if no free block is large enough, even if the total free memory is. A
+ * largest free block much smaller than the free memory thus warns of failures
+ * to come. The statistics are printed by the `heap` shell command.
+ *
+ * # Per-thread arenas
+ *
+ * With the `tlsf-malloc_arena` module, a thread can be given its own heap,
+ * an arena, with tlsf_malloc_arena_set(). Its allocations are taken from
+ * the arena only, so a thread allocating and freeing a lot can not fragment
+ * the heap of the other threads, nor use up all of it. Memory can be freed by
+ * any thread.
+ *
+ * # Allocation sites
+ *
+ * With the `tlsf-malloc_tag` module, which is intended for debug builds,
+ * every allocation is tagged with the address it was called from and the
+ * thread calling it. tlsf_malloc_print_allocs() lists all allocations with
+ * their tags, also available as `heap allocs` in the shell. The tag takes
+ * `sizeof(tlsf_malloc_tag_t)` bytes of every allocation.
  *
  * @{
  * @file
@@ -37,13 +65,47 @@
 #define TLSF_MALLOC_H
 
 #include <stddef.h>
+#include <stdint.h>
 
+#include "sched.h"
 #include "tlsf.h"
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+/**
+ * @brief   Maximum number of memory areas added with tlsf_add_global_pool()
+ */
+#ifndef CONFIG_TLSF_MALLOC_POOLS_NUMOF
+#define CONFIG_TLSF_MALLOC_POOLS_NUMOF      (4U)
+#endif
+
+/**
+ * @brief   Size of the heap on native
+ */
+#ifndef CONFIG_TLSF_MALLOC_NATIVE_HEAP_SIZE
+#define CONFIG_TLSF_MALLOC_NATIVE_HEAP_SIZE (8UL * 1024 * 1024)
+#endif
+
+/**
+ * @brief   Number of bins of the histogram of free block sizes
+ *
+ * Bin 0 counts the blocks smaller than @ref CONFIG_TLSF_MALLOC_HIST_MIN,
+ * every further bin blocks up to twice the size, the last bin all larger
+ * ones.
+ */
+#ifndef CONFIG_TLSF_MALLOC_HIST_BINS
+#define CONFIG_TLSF_MALLOC_HIST_BINS        (8U)
+#endif
+
+/**
+ * @brief   Upper limit of bin 0 of the histogram of free block sizes
+ */
+#ifndef CONFIG_TLSF_MALLOC_HIST_MIN
+#define CONFIG_TLSF_MALLOC_HIST_MIN         (32U)
+#endif
+
 /**
  * @brief Struct to hold the total sizes of free and used blocks
  * Used for @ref tlsf_size_walker()
@@ -53,6 +115,40 @@ typedef struct {
     unsigned used;          /**< total used size */
 } tlsf_size_container_t;
 
+/**
+ * @brief   Usage and fragmentation of a heap
+ */
+typedef struct {
+    size_t used;            /**< bytes in used blocks */
+    size_t free;            /**< bytes in free blocks */
+    size_t largest_free;    /**< size of the largest free block */
+    unsigned used_blocks;   /**< number of used blocks */
+    unsigned free_blocks;   /**< number of free blocks */
+    unsigned failures;      /**< allocations that failed */
+    /** number of free blocks per size, see @ref CONFIG_TLSF_MALLOC_HIST_BINS */
+    unsigned hist[CONFIG_TLSF_MALLOC_HIST_BINS];
+} tlsf_malloc_stats_t;
+
+/**
+ * @brief   Arena, a heap of its own for some threads
+ */
+typedef struct tlsf_malloc_arena {
+    struct tlsf_malloc_arena *next; /**< next arena */
+    tlsf_t tlsf;                    /**< TLSF control block of the arena */
+    uintptr_t start;                /**< start of the memory of the arena */
+    uintptr_t end;                  /**< end of the memory of the arena */
+    const char *name;               /**< name of the arena */
+    unsigned failures;              /**< allocations that failed */
+} tlsf_malloc_arena_t;
+
+/**
+ * @brief   Tag of an allocation, see module `tlsf-malloc_tag`
+ */
+typedef struct {
+    uintptr_t pc;           /**< address malloc() and friends were called from */
+    kernel_pid_t pid;       /**< thread that called malloc() and friends */
+} tlsf_malloc_tag_t;
+
 /**
  * Walk the memory pool to print all block sizes and to calculate
  * the total amount of free and used block sizes.
@@ -72,13 +168,14 @@ void tlsf_size_walker(void* ptr, size_t size, int used, void* user);
  * The first time this function is called, it will automatically perform a
  * tlsf_create() on the global tlsf_control block.
  *
- * @warning If this module is used, then this function MUST be called at least
- *          once, before any allocations take place.
+ * @note    If this function is not called before the first allocation, the
+ *          heap of the platform is added then.
  *
  * @param   mem        Pointer to memory area. Should be aligned to 4 bytes.
  * @param   bytes      Size in bytes of the memory area.
  *
- * @return  0 on success, nonzero on failure.
+ * @return  0 on success, nonzero on failure, also if
+ *          @ref CONFIG_TLSF_MALLOC_POOLS_NUMOF areas were added already.
  */
 int tlsf_add_global_pool(void *mem, size_t bytes);
 
@@ -89,6 +186,84 @@ int tlsf_add_global_pool(void *mem, size_t bytes);
  */
 tlsf_t _tlsf_get_global_control(void);
 
+/**
+ * @brief   Get the usage and fragmentation of a heap
+ *
+ * All blocks of the heap are walked with interrupts disabled, which takes
+ * time proportional to the number of blocks.
+ *
+ * @param[in]   arena   arena, NULL for the global heap
+ * @param[out]  stats   usage and fragmentation of the heap
+ */
+void tlsf_malloc_get_stats(const tlsf_malloc_arena_t *arena,
+                           tlsf_malloc_stats_t *stats);
+
+/**
+ * @brief   Print the usage and fragmentation of the global heap and of all
+ *          arenas
+ */
+void tlsf_malloc_print_stats(void);
+
+/**
+ * @brief   Initialize an arena
+ *
+ * @note    Only available with module `tlsf-malloc_arena`
+ *
+ * @param[out]  arena   arena to initialize
+ * @param[in]   name    name of the arena, printed with the statistics
+ * @param[in]   mem     memory of the arena, including the TLSF control block
+ * @param[in]   bytes   size of @p mem
+ *
+ * @return  0 on success
+ * @return  -1 if @p mem is too small
+ */
+int tlsf_malloc_arena_init(tlsf_malloc_arena_t *arena, const char *name,
+                           void *mem, size_t bytes);
+
+/**
+ * @brief   Let a thread allocate from an arena
+ *
+ * Allocations of the thread fail if the arena is full, they are not taken
+ * from the global heap. The assignment is kept until it is changed, also
+ * when the thread exits, so the next thread with the same PID uses the arena,
+ * too.
+ *
+ * @note    Only available with module `tlsf-malloc_arena`
+ *
+ * @param[in]   pid     thread
+ * @param[in]   arena   arena, NULL for the global heap
+ */
+void tlsf_malloc_arena_set(kernel_pid_t pid, tlsf_malloc_arena_t *arena);
+
+/**
+ * @brief   Set the caller of the next allocation of the calling thread
+ *
+ * For wrappers of malloc() and friends, like @ref sys_malloc_ts, so that the
+ * allocation is tagged with their caller instead of themselves.
+ *
+ * @note    Only available with module `tlsf-malloc_tag`
+ *
+ * @param[in]   pc      address the wrapper was called from
+ */
+void tlsf_malloc_set_caller(uintptr_t pc);
+
+/**
+ * @brief   Get the tag of an allocation
+ *
+ * @note    Only available with module `tlsf-malloc_tag`
+ *
+ * @param[in]   ptr     block returned by malloc() and friends
+ * @param[out]  tag     tag of @p ptr
+ */
+void tlsf_malloc_get_tag(void *ptr, tlsf_malloc_tag_t *tag);
+
+/**
+ * @brief   Print all allocations with their tags
+ *
+ * @note    Only available with module `tlsf-malloc_tag`
+ */
+void tlsf_malloc_print_allocs(void);
+
 #ifdef __cplusplus
 }
 #endif
@@ -20,10 +20,11 @@
  *
  */
 
-#include <string.h>
 #include <errno.h>
+#include <stdint.h>
+#include <string.h>
 
-#include "irq.h"
+#include "cpu.h"
 #include "tlsf.h"
 #include "tlsf-malloc.h"
 #include "tlsf-malloc-internal.h"
@@ -47,21 +48,24 @@
 
 #endif /* __GNUC__ */
 
-extern tlsf_t tlsf_malloc_gheap;
+static uint8_t _heap[CONFIG_TLSF_MALLOC_NATIVE_HEAP_SIZE] __attribute__((aligned(8)));
+
+void tlsf_malloc_add_default_pool(void)
+{
+    tlsf_add_global_pool(_heap, sizeof(_heap));
+}
 
 /**
  * Allocate a block of size "bytes"
  */
 ATTR_MALLOC void *malloc(size_t bytes)
 {
-    unsigned old_state = irq_disable();
-    void *result = tlsf_malloc(tlsf_malloc_gheap, bytes);
+    void *result = tlsf_malloc_alloc(0, bytes, cpu_get_caller_pc());
 
     if (result == NULL) {
         errno = ENOMEM;
     }
 
-    irq_restore(old_state);
     return result;
 }
 
@@ -70,10 +74,18 @@ ATTR_MALLOC void *malloc(size_t bytes)
  */
 ATTR_CALLOC void *calloc(size_t count, size_t bytes)
 {
-    void *result = malloc(count * bytes);
+    size_t size_total;
+    if (__builtin_mul_overflow(count, bytes, &size_total)) {
+        errno = ENOMEM;
+        return NULL;
+    }
+    void *result = tlsf_malloc_alloc(0, size_total, cpu_get_caller_pc());
 
     if (result != NULL) {
-        memset(result, 0, count * bytes);
+        memset(result, 0, size_total);
+    }
+    else {
+        errno = ENOMEM;
     }
     return result;
 }
@@ -83,14 +95,12 @@ ATTR_CALLOC void *calloc(size_t count, size_t bytes)
  */
 ATTR_MALIGN void *memalign(size_t align, size_t bytes)
 {
-    unsigned old_state = irq_disable();
-    void *result = tlsf_memalign(tlsf_malloc_gheap, align, bytes);
+    void *result = tlsf_malloc_alloc(align, bytes, cpu_get_caller_pc());
 
     if (result == NULL) {
         errno = ENOMEM;
     }
 
-    irq_restore(old_state);
     return result;
 }
 
@@ -99,14 +109,12 @@ ATTR_MALIGN void *memalign(size_t align, size_t bytes)
  */
 ATTR_REALLOC void *realloc(void *ptr, size_t size)
 {
-    unsigned old_state = irq_disable();
-    void *result = tlsf_realloc(tlsf_malloc_gheap, ptr, size);
+    void *result = tlsf_malloc_realloc(ptr, size, cpu_get_caller_pc());
 
     if (result == NULL) {
         errno = ENOMEM;
     }
 
-    irq_restore(old_state);
     return result;
 }
 
@@ -115,8 +123,5 @@ ATTR_REALLOC void *realloc(void *ptr, size_t size)
  */
 void free(void *ptr)
 {
-    unsigned old_state = irq_disable();
-
-    tlsf_free(tlsf_malloc_gheap, ptr);
-    irq_restore(old_state);
+    tlsf_malloc_free(ptr);
 }
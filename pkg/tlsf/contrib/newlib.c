@@ -21,11 +21,11 @@
  *
  */
 
-#include <string.h>
-#include <reent.h>
 #include <errno.h>
+#include <reent.h>
+#include <string.h>
 
-#include "irq.h"
+#include "cpu.h"
 #include "tlsf.h"
 #include "tlsf-malloc.h"
 #include "tlsf-malloc-internal.h"
@@ -49,19 +49,45 @@
 
 #endif /* __GNUC__ */
 
+#ifndef NUM_HEAPS
+#define NUM_HEAPS 1
+#endif
+
+/* heaps defined by the linker script, see newlib_syscalls_default */
+extern char _sheap;
+extern char _eheap;
+extern char _sheap1;
+extern char _eheap1;
+extern char _sheap2;
+extern char _eheap2;
+extern char _sheap3;
+extern char _eheap3;
+
+void tlsf_malloc_add_default_pool(void)
+{
+    tlsf_add_global_pool(&_sheap, &_eheap - &_sheap);
+#if NUM_HEAPS > 1
+    tlsf_add_global_pool(&_sheap1, &_eheap1 - &_sheap1);
+#endif
+#if NUM_HEAPS > 2
+    tlsf_add_global_pool(&_sheap2, &_eheap2 - &_sheap2);
+#endif
+#if NUM_HEAPS > 3
+    tlsf_add_global_pool(&_sheap3, &_eheap3 - &_sheap3);
+#endif
+}
+
 /**
  * Allocate a block of size "bytes"
  */
 ATTR_MALLOCR void *_malloc_r(struct _reent *reent_ptr, size_t bytes)
 {
-    unsigned old_state = irq_disable();
-    void *result = tlsf_malloc(tlsf_malloc_gheap, bytes);
+    void *result = tlsf_malloc_alloc(0, bytes, cpu_get_caller_pc());
 
     if (result == NULL) {
         reent_ptr->_errno = ENOMEM;
     }
 
-    irq_restore(old_state);
     return result;
 }
 
@@ -74,11 +100,14 @@ ATTR_CALLOCR void *_calloc_r(struct _reent *reent_ptr, size_t count, size_t byte
     if (__builtin_mul_overflow(count, bytes, &size_total)) {
         return NULL;
     }
-    void *result = _malloc_r(reent_ptr, size_total);
+    void *result = tlsf_malloc_alloc(0, size_total, cpu_get_caller_pc());
 
     if (result != NULL) {
         memset(result, 0, size_total);
     }
+    else {
+        reent_ptr->_errno = ENOMEM;
+    }
     return result;
 }
 
@@ -87,14 +116,12 @@ ATTR_CALLOCR void *_calloc_r(struct _reent *reent_ptr, size_t count, size_t byte
  */
 ATTR_MALIGNR void *_memalign_r(struct _reent *reent_ptr, size_t align, size_t bytes)
 {
-    unsigned old_state = irq_disable();
-    void *result = tlsf_memalign(tlsf_malloc_gheap, align, bytes);
+    void *result = tlsf_malloc_alloc(align, bytes, cpu_get_caller_pc());
 
     if (result == NULL) {
         reent_ptr->_errno = ENOMEM;
     }
 
-    irq_restore(old_state);
     return result;
 }
 
@@ -103,14 +130,12 @@ ATTR_MALIGNR void *_memalign_r(struct _reent *reent_ptr, size_t align, size_t by
  */
 ATTR_REALLOCR void *_realloc_r(struct _reent *reent_ptr, void *ptr, size_t size)
 {
-    unsigned old_state = irq_disable();
-    void *result = tlsf_realloc(tlsf_malloc_gheap, ptr, size);
+    void *result = tlsf_malloc_realloc(ptr, size, cpu_get_caller_pc());
 
     if (result == NULL) {
         reent_ptr->_errno = ENOMEM;
     }
 
-    irq_restore(old_state);
     return result;
 }
 
@@ -119,11 +144,9 @@ ATTR_REALLOCR void *_realloc_r(struct _reent *reent_ptr, void *ptr, size_t size)
  */
 void _free_r(struct _reent *reent_ptr, void *ptr)
 {
-    unsigned old_state = irq_disable();
     (void)reent_ptr;
 
-    tlsf_free(tlsf_malloc_gheap, ptr);
-    irq_restore(old_state);
+    tlsf_malloc_free(ptr);
 }
 
 /**
@@ -19,6 +19,9 @@
 #ifndef TLSF_MALLOC_INTERNAL_H
 #define TLSF_MALLOC_INTERNAL_H
 
+#include <stddef.h>
+#include <stdint.h>
+
 #include "tlsf.h"
 
 #ifdef __cplusplus
@@ -27,6 +30,43 @@ extern "C" {
 
 extern tlsf_t tlsf_malloc_gheap;
 
+/**
+ * @brief   Add the heap of the platform to the global heap
+ *
+ * Called on the first allocation if no memory was added before, implemented
+ * per platform.
+ */
+void tlsf_malloc_add_default_pool(void);
+
+/**
+ * @brief   Allocate a block from the heap of the calling thread
+ *
+ * @param[in]   align   alignment, 0 for the default alignment
+ * @param[in]   bytes   size of the block
+ * @param[in]   pc      caller, for the tag of the allocation
+ *
+ * @return  the block, NULL if there is not enough memory
+ */
+void *tlsf_malloc_alloc(size_t align, size_t bytes, uintptr_t pc);
+
+/**
+ * @brief   Resize a block within its heap
+ *
+ * @param[in]   ptr     block to resize, may be NULL
+ * @param[in]   bytes   new size of the block
+ * @param[in]   pc      caller, for the tag of the allocation
+ *
+ * @return  the resized block, NULL if there is not enough memory
+ */
+void *tlsf_malloc_realloc(void *ptr, size_t bytes, uintptr_t pc);
+
+/**
+ * @brief   Free a block of any heap
+ *
+ * @param[in]   ptr     block to free, may be NULL
+ */
+void tlsf_malloc_free(void *ptr);
+
 #ifdef __cplusplus
 }
 #endif
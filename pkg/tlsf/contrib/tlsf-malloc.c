@@ -17,26 +17,82 @@
  *
  */
 
+#include <assert.h>
+#include <inttypes.h>
+#include <stdbool.h>
 #include <stdio.h>
+#include <string.h>
 
+#include "architecture.h"
+#include "irq.h"
+#include "modules.h"
+#include "thread.h"
 #include "tlsf.h"
 #include "tlsf-malloc.h"
 #include "tlsf-malloc-internal.h"
 
+#if IS_USED(MODULE_TLSF_MALLOC_TAG)
+/* the tag is stored in the last bytes of the block */
+#define TAG_SIZE    sizeof(tlsf_malloc_tag_t)
+#else
+#define TAG_SIZE    0
+#endif
+
 /**
  * Global memory heap (really a collection of pools, or areas)
  **/
 tlsf_t tlsf_malloc_gheap = NULL;
 
+/* the pools of the global heap, to walk them */
+static pool_t _pools[CONFIG_TLSF_MALLOC_POOLS_NUMOF];
+static unsigned _pools_numof;
+static unsigned _failures;
+
+#if IS_USED(MODULE_TLSF_MALLOC_ARENA)
+static tlsf_malloc_arena_t *_arenas;
+static tlsf_malloc_arena_t *_thread_arenas[MAXTHREADS];
+#endif
+
+#if IS_USED(MODULE_TLSF_MALLOC_TAG)
+/* caller set by a wrapper for its next allocation */
+static uintptr_t _caller;
+static kernel_pid_t _caller_pid;
+#endif
+
+/* tlsf_create_with_pool() does not check the size, and on a region smaller
+ * than this it overflows or adds a pool with an underflowed size */
+static bool _fits_tlsf(size_t bytes)
+{
+    return bytes >= tlsf_size() + tlsf_pool_overhead() + tlsf_block_size_min();
+}
+
 int tlsf_add_global_pool(void *mem, size_t bytes)
 {
+    pool_t pool;
+
+    if (_pools_numof == CONFIG_TLSF_MALLOC_POOLS_NUMOF) {
+        return 1;
+    }
+
     if (tlsf_malloc_gheap == NULL) {
+        if (!_fits_tlsf(bytes)) {
+            return 1;
+        }
         tlsf_malloc_gheap = tlsf_create_with_pool(mem, bytes);
-        return tlsf_malloc_gheap == NULL;
+        if (tlsf_malloc_gheap == NULL) {
+            return 1;
+        }
+        pool = tlsf_get_pool(tlsf_malloc_gheap);
     }
     else {
-        return tlsf_add_pool(tlsf_malloc_gheap, mem, bytes) == NULL;
+        pool = tlsf_add_pool(tlsf_malloc_gheap, mem, bytes);
+        if (pool == NULL) {
+            return 1;
+        }
     }
+    _pools[_pools_numof++] = pool;
+
+    return 0;
 }
 
 tlsf_t _tlsf_get_global_control(void)
@@ -57,6 +113,306 @@ void tlsf_size_walker(void* ptr, size_t size, int used, void* user)
     }
 }
 
+/* heap of the calling thread, NULL if the default pool could not be added,
+ * called with interrupts disabled */
+static tlsf_t _heap(unsigned **failures)
+{
+#if IS_USED(MODULE_TLSF_MALLOC_ARENA)
+    kernel_pid_t pid = thread_getpid();
+
+    if (pid_is_valid(pid) && _thread_arenas[pid - KERNEL_PID_FIRST]) {
+        tlsf_malloc_arena_t *arena = _thread_arenas[pid - KERNEL_PID_FIRST];
+
+        *failures = &arena->failures;
+        return arena->tlsf;
+    }
+#endif
+    if (tlsf_malloc_gheap == NULL) {
+        tlsf_malloc_add_default_pool();
+    }
+    *failures = &_failures;
+    return tlsf_malloc_gheap;
+}
+
+/* heap a block was allocated from, called with interrupts disabled */
+static tlsf_t _heap_of(const void *ptr, unsigned **failures)
+{
+#if IS_USED(MODULE_TLSF_MALLOC_ARENA)
+    for (tlsf_malloc_arena_t *arena = _arenas; arena; arena = arena->next) {
+        if (((uintptr_t)ptr >= arena->start) && ((uintptr_t)ptr < arena->end)) {
+            *failures = &arena->failures;
+            return arena->tlsf;
+        }
+    }
+#else
+    (void)ptr;
+#endif
+    *failures = &_failures;
+    return tlsf_malloc_gheap;
+}
+
+/* called with interrupts disabled */
+static void _tag(void *ptr, uintptr_t pc)
+{
+#if IS_USED(MODULE_TLSF_MALLOC_TAG)
+    tlsf_malloc_tag_t tag = { .pc = pc, .pid = thread_getpid() };
+
+    if (_caller && (_caller_pid == tag.pid)) {
+        tag.pc = _caller;
+        _caller = 0;
+    }
+    memcpy((uint8_t *)ptr + tlsf_block_size(ptr) - TAG_SIZE, &tag, TAG_SIZE);
+#else
+    (void)ptr;
+    (void)pc;
+#endif
+}
+
+void *tlsf_malloc_alloc(size_t align, size_t bytes, uintptr_t pc)
+{
+    unsigned *failures;
+    void *ptr = NULL;
+    size_t size;
+
+    if (__builtin_add_overflow(bytes, TAG_SIZE, &size)) {
+        return NULL;
+    }
+
+    unsigned state = irq_disable();
+    tlsf_t heap = _heap(&failures);
+
+    if (heap == NULL) {
+        /* counted as a failed allocation below */
+    }
+    else if (align) {
+        ptr = tlsf_memalign(heap, align, size);
+    }
+    else {
+        ptr = tlsf_malloc(heap, size);
+    }
+    if (ptr) {
+        _tag(ptr, pc);
+    }
+    else if (bytes) {
+        (*failures)++;
+    }
+    irq_restore(state);
+
+    return ptr;
+}
+
+void *tlsf_malloc_realloc(void *ptr, size_t bytes, uintptr_t pc)
+{
+    unsigned *failures;
+    size_t size;
+
+    if (ptr == NULL) {
+        return tlsf_malloc_alloc(0, bytes, pc);
+    }
+    if (bytes == 0) {
+        tlsf_malloc_free(ptr);
+        return NULL;
+    }
+    if (__builtin_add_overflow(bytes, TAG_SIZE, &size)) {
+        return NULL;
+    }
+
+    unsigned state = irq_disable();
+    void *result = tlsf_realloc(_heap_of(ptr, &failures), ptr, size);
+
+    if (result) {
+        _tag(result, pc);
+    }
+    else {
+        (*failures)++;
+    }
+    irq_restore(state);
+
+    return result;
+}
+
+void tlsf_malloc_free(void *ptr)
+{
+    unsigned *failures;
+
+    if (ptr == NULL) {
+        return;
+    }
+
+    unsigned state = irq_disable();
+
+    tlsf_free(_heap_of(ptr, &failures), ptr);
+    irq_restore(state);
+}
+
+static void _stats_walker(void *ptr, size_t size, int used, void *user)
+{
+    tlsf_malloc_stats_t *stats = user;
+    unsigned bin = 0;
+
+    (void)ptr;
+
+    if (used) {
+        stats->used += size;
+        stats->used_blocks++;
+        return;
+    }
+
+    stats->free += size;
+    stats->free_blocks++;
+    if (size > stats->largest_free) {
+        stats->largest_free = size;
+    }
+    for (size_t limit = CONFIG_TLSF_MALLOC_HIST_MIN;
+         (size >= limit) && (bin < CONFIG_TLSF_MALLOC_HIST_BINS - 1);
+         limit *= 2) {
+        bin++;
+    }
+    stats->hist[bin]++;
+}
+
+void tlsf_malloc_get_stats(const tlsf_malloc_arena_t *arena,
+                           tlsf_malloc_stats_t *stats)
+{
+    memset(stats, 0, sizeof(*stats));
+
+    unsigned state = irq_disable();
+
+#if IS_USED(MODULE_TLSF_MALLOC_ARENA)
+    if (arena) {
+        tlsf_walk_pool(tlsf_get_pool(arena->tlsf), _stats_walker, stats);
+        stats->failures = arena->failures;
+        irq_restore(state);
+        return;
+    }
+#else
+    assert(arena == NULL);
+    (void)arena;
+#endif
+    for (unsigned i = 0; i < _pools_numof; i++) {
+        tlsf_walk_pool(_pools[i], _stats_walker, stats);
+    }
+    stats->failures = _failures;
+    irq_restore(state);
+}
+
+static void _print_stats(const char *name, const tlsf_malloc_stats_t *stats)
+{
+    size_t limit = CONFIG_TLSF_MALLOC_HIST_MIN;
+
+    printf("%s: %" PRIuSIZE " (used %" PRIuSIZE ", free %" PRIuSIZE ") [bytes]\n",
+           name, stats->used + stats->free, stats->used, stats->free);
+    printf("  blocks: %u used, %u free, largest free %" PRIuSIZE
+           ", failed allocations %u\n", stats->used_blocks, stats->free_blocks,
+           stats->largest_free, stats->failures);
+    printf("  free blocks by size:");
+    for (unsigned i = 0; i < CONFIG_TLSF_MALLOC_HIST_BINS - 1; i++) {
+        printf(" <%" PRIuSIZE ": %u", limit, stats->hist[i]);
+        limit *= 2;
+    }
+    printf(" >=%" PRIuSIZE ": %u\n", limit / 2,
+           stats->hist[CONFIG_TLSF_MALLOC_HIST_BINS - 1]);
+}
+
+void tlsf_malloc_print_stats(void)
+{
+    tlsf_malloc_stats_t stats;
+
+    tlsf_malloc_get_stats(NULL, &stats);
+    _print_stats("heap", &stats);
+#if IS_USED(MODULE_TLSF_MALLOC_ARENA)
+    for (tlsf_malloc_arena_t *arena = _arenas; arena; arena = arena->next) {
+        tlsf_malloc_get_stats(arena, &stats);
+        _print_stats(arena->name, &stats);
+    }
+#endif
+}
+
+/* replaces the one of newlib_syscalls_default, used by the heap command */
+void heap_stats(void)
+{
+    tlsf_malloc_print_stats();
+}
+
+#if IS_USED(MODULE_TLSF_MALLOC_ARENA)
+int tlsf_malloc_arena_init(tlsf_malloc_arena_t *arena, const char *name,
+                           void *mem, size_t bytes)
+{
+    if (!_fits_tlsf(bytes)) {
+        return -1;
+    }
+    arena->tlsf = tlsf_create_with_pool(mem, bytes);
+    if (arena->tlsf == NULL) {
+        return -1;
+    }
+    arena->start = (uintptr_t)mem;
+    arena->end = (uintptr_t)mem + bytes;
+    arena->name = name;
+    arena->failures = 0;
+
+    unsigned state = irq_disable();
+
+    arena->next = _arenas;
+    _arenas = arena;
+    irq_restore(state);
+
+    return 0;
+}
+
+void tlsf_malloc_arena_set(kernel_pid_t pid, tlsf_malloc_arena_t *arena)
+{
+    assert(pid_is_valid(pid));
+
+    _thread_arenas[pid - KERNEL_PID_FIRST] = arena;
+}
+#endif
+
+#if IS_USED(MODULE_TLSF_MALLOC_TAG)
+void tlsf_malloc_set_caller(uintptr_t pc)
+{
+    unsigned state = irq_disable();
+
+    _caller = pc;
+    _caller_pid = thread_getpid();
+    irq_restore(state);
+}
+
+void tlsf_malloc_get_tag(void *ptr, tlsf_malloc_tag_t *tag)
+{
+    memcpy(tag, (uint8_t *)ptr + tlsf_block_size(ptr) - TAG_SIZE, TAG_SIZE);
+}
+
+static void _allocs_walker(void *ptr, size_t size, int used, void *user)
+{
+    tlsf_malloc_tag_t tag;
+
+    (void)user;
+
+    if (!used) {
+        return;
+    }
+    tlsf_malloc_get_tag(ptr, &tag);
+    printf("  %p %6" PRIuSIZE " bytes  pc 0x%08" PRIxPTR "  pid %" PRIkernel_pid
+           "\n", ptr, size - TAG_SIZE, tag.pc, tag.pid);
+}
+
+/* Interrupts are not disabled while printing, as stdio may need them. The
+ * output may be inconsistent if other threads allocate at the same time. */
+void tlsf_malloc_print_allocs(void)
+{
+    puts("heap:");
+    for (unsigned i = 0; i < _pools_numof; i++) {
+        tlsf_walk_pool(_pools[i], _allocs_walker, NULL);
+    }
+#if IS_USED(MODULE_TLSF_MALLOC_ARENA)
+    for (tlsf_malloc_arena_t *arena = _arenas; arena; arena = arena->next) {
+        printf("%s:\n", arena->name);
+        tlsf_walk_pool(tlsf_get_pool(arena->tlsf), _allocs_walker, NULL);
+    }
+#endif
+}
+#endif
+
 /**
  * @}
  */
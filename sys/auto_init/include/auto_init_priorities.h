@@ -53,12 +53,24 @@ extern "C" {
  */
 #define AUTO_INIT_PRIO_MOD_RANDOM                       1040
 #endif
+#ifndef AUTO_INIT_PRIO_MOD_TRACE
+/**
+ * @brief   tracepoints priority
+ */
+#define AUTO_INIT_PRIO_MOD_TRACE                        1045
+#endif
 #ifndef AUTO_INIT_PRIO_MOD_SCHEDSTATISTICS
 /**
  * @brief   scheduling statistics priority
  */
 #define AUTO_INIT_PRIO_MOD_SCHEDSTATISTICS              1050
 #endif
+#ifndef AUTO_INIT_PRIO_MOD_MUTEX_PROFILING
+/**
+ * @brief   mutex contention profiling priority
+ */
+#define AUTO_INIT_PRIO_MOD_MUTEX_PROFILING              1055
+#endif
 #ifndef AUTO_INIT_PRIO_MOD_SCHED_ROUND_ROBIN
 /**
  * @brief   round robin scheduling priority
@@ -19,15 +19,108 @@
  */
 
 #include <stdio.h>
+
+#include "kernel_defines.h"
 #include "timex.h"
 
 #include "benchmark.h"
 
+/* time and cycles per call of the samples of BENCHMARK_RUN */
+static int32_t _time[CONFIG_BENCHMARK_SAMPLES];
+static int32_t _cycles[CONFIG_BENCHMARK_SAMPLES];
+
+static void _print_text(const benchmark_result_t *res)
+{
+    printf("%25s: min %6" PRIi32 " %s  ---  median %6" PRIi32 " %s"
+           "  ---  p99 %6" PRIi32 " %s  ---  max %6" PRIi32 " %s\n",
+           res->name, res->time.min, res->unit, res->time.median, res->unit,
+           res->time.p99, res->unit, res->time.max, res->unit);
+    if (res->has_cycles) {
+        printf("%25s  min %6" PRIi32 " cyc ---  median %6" PRIi32 " cyc"
+               " ---  p99 %6" PRIi32 " cyc ---  max %6" PRIi32 " cyc\n",
+               "", res->cycles.min, res->cycles.median, res->cycles.p99,
+               res->cycles.max);
+    }
+}
+
+static void _print_json_stats(const benchmark_stats_t *stats)
+{
+    printf("\"min\":%" PRIi32 ",\"median\":%" PRIi32 ",\"p99\":%" PRIi32
+           ",\"max\":%" PRIi32 ",\"mean\":%" PRIi32,
+           stats->min, stats->median, stats->p99, stats->max, stats->mean);
+}
+
+static void _print_json(const benchmark_result_t *res)
+{
+    printf("{\"name\":\"%s\",\"unit\":\"%s\",\"runs\":%lu,\"samples\":%u,",
+           res->name, res->unit, res->runs, res->samples);
+    _print_json_stats(&res->time);
+    if (res->has_cycles) {
+        printf(",\"cycles\":{");
+        _print_json_stats(&res->cycles);
+        printf("}");
+    }
+    puts("}");
+}
+
+static void _print_csv_stats(const benchmark_stats_t *stats)
+{
+    printf(",%" PRIi32 ",%" PRIi32 ",%" PRIi32 ",%" PRIi32 ",%" PRIi32,
+           stats->min, stats->median, stats->p99, stats->max, stats->mean);
+}
+
+static void _print_csv(const benchmark_result_t *res)
+{
+    static bool header;
+
+    if (!header) {
+        puts("name,unit,runs,samples,min,median,p99,max,mean,"
+             "cycles_min,cycles_median,cycles_p99,cycles_max,cycles_mean");
+        header = true;
+    }
+    printf("\"%s\",%s,%lu,%u", res->name, res->unit, res->runs, res->samples);
+    _print_csv_stats(&res->time);
+    if (res->has_cycles) {
+        _print_csv_stats(&res->cycles);
+    }
+    else {
+        printf(",,,,,");
+    }
+    puts("");
+}
+
+void benchmark_print_result(const benchmark_result_t *res)
+{
+    if (IS_USED(MODULE_BENCHMARK_JSON)) {
+        _print_json(res);
+    }
+    else if (IS_USED(MODULE_BENCHMARK_CSV)) {
+        _print_csv(res);
+    }
+    else {
+        _print_text(res);
+    }
+}
+
 void benchmark_print_time(uint32_t time, unsigned long runs, const char *name)
 {
     uint32_t full = (time / runs);
     uint32_t div  = (uint32_t)(((uint64_t)(time - (full * runs))) * 1000 / runs);
 
+    if (IS_USED(MODULE_BENCHMARK_JSON) || IS_USED(MODULE_BENCHMARK_CSV)) {
+        int32_t ns = (int32_t)((uint64_t)time * NS_PER_US / runs);
+        benchmark_result_t res = {
+            .name = name,
+            .unit = "ns",
+            .runs = runs,
+            .samples = 1,
+            .time = { ns, ns, ns, ns, ns },
+        };
+
+        benchmark_print_result(&res);
+        return;
+    }
+
     uint32_t per_sec = (uint32_t)(((uint64_t)US_PER_SEC * runs) / time);
 
     printf("%25s: %9" PRIu32 "us"
@@ -35,3 +128,87 @@ void benchmark_print_time(uint32_t time, unsigned long runs, const char *name)
            "  ---  %9" PRIu32 " calls per sec\n",
            name, time, full, div, per_sec);
 }
+
+void benchmark_print_value(const char *name, const char *unit, int32_t value)
+{
+    benchmark_result_t res = {
+        .name = name,
+        .unit = unit,
+        .runs = 1,
+        .samples = 1,
+        .time = { value, value, value, value, value },
+    };
+
+    benchmark_print_result(&res);
+}
+
+void benchmark_stats(benchmark_stats_t *stats, int32_t *values, unsigned n)
+{
+    int64_t sum = 0;
+
+    /* insertion sort, there are only a few values */
+    for (unsigned i = 1; i < n; i++) {
+        int32_t val = values[i];
+        unsigned j = i;
+
+        for (; (j > 0) && (values[j - 1] > val); j--) {
+            values[j] = values[j - 1];
+        }
+        values[j] = val;
+    }
+    for (unsigned i = 0; i < n; i++) {
+        sum += values[i];
+    }
+
+    stats->min = values[0];
+    stats->median = values[n / 2];
+    /* nearest rank */
+    stats->p99 = values[(99 * n + 99) / 100 - 1];
+    stats->max = values[n - 1];
+    stats->mean = (int32_t)(sum / n);
+}
+
+void benchmark_begin(void)
+{
+    ztimer_acquire(ZTIMER_USEC);
+#if BENCHMARK_HAS_CYCLES && !defined(CPU_NATIVE)
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+#endif
+}
+
+void benchmark_sample(unsigned rep, const benchmark_stamp_t *start)
+{
+    uint32_t cycles = benchmark_cycles();
+    uint32_t us = ztimer_now(ZTIMER_USEC);
+
+    if (rep >= CONFIG_BENCHMARK_WARMUP) {
+        _time[rep - CONFIG_BENCHMARK_WARMUP] = (int32_t)(us - start->us);
+        _cycles[rep - CONFIG_BENCHMARK_WARMUP] = (int32_t)(cycles - start->cycles);
+    }
+}
+
+void benchmark_end(const char *name, unsigned long runs)
+{
+    benchmark_result_t res = {
+        .name = name,
+        .unit = "ns",
+        .runs = runs,
+        .samples = CONFIG_BENCHMARK_SAMPLES,
+        .has_cycles = BENCHMARK_HAS_CYCLES,
+    };
+
+    ztimer_release(ZTIMER_USEC);
+
+    /* per call, the time of a sample is in µs */
+    for (unsigned i = 0; i < CONFIG_BENCHMARK_SAMPLES; i++) {
+        _time[i] = (int32_t)((int64_t)_time[i] * NS_PER_US / (int64_t)runs);
+        _cycles[i] = (int32_t)((int64_t)_cycles[i] / (int64_t)runs);
+    }
+    benchmark_stats(&res.time, _time, CONFIG_BENCHMARK_SAMPLES);
+    if (BENCHMARK_HAS_CYCLES) {
+        benchmark_stats(&res.cycles, _cycles, CONFIG_BENCHMARK_SAMPLES);
+    }
+
+    benchmark_print_result(&res);
+}
@@ -0,0 +1,140 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup cpp_coro
+ * @{
+ *
+ * @file
+ * @brief   Executor of C++20 coroutine tasks
+ *
+ * @}
+ */
+
+#include <cerrno>
+
+#include "thread.h"
+#include "riot/coro.hpp"
+
+namespace riot {
+namespace coro {
+namespace detail {
+
+/* owns a spawned task and frees itself when the task is done */
+struct spawner {
+  struct promise_type : promise_base {
+    resume_event start;
+
+    spawner get_return_object() noexcept {
+      return spawner{std::coroutine_handle<promise_type>::from_promise(*this)};
+    }
+
+    static spawner get_return_object_on_allocation_failure() noexcept {
+      return spawner{nullptr};
+    }
+
+    std::suspend_never final_suspend() noexcept { return {}; }
+
+    void return_void() noexcept {}
+  };
+
+  static spawner run(executor *exec, task<> t) {
+    co_await std::move(t);
+    exec->m_tasks--;
+  }
+
+  std::coroutine_handle<promise_type> handle;
+};
+
+} // namespace detail
+
+int executor::spawn(task<>&& t) noexcept {
+  if (!t.valid()) {
+    return -ENOMEM;
+  }
+
+  detail::spawner s = detail::spawner::run(this, std::move(t));
+  if (!s.handle) {
+    return -ENOMEM;
+  }
+
+  auto& promise = s.handle.promise();
+  promise.set_executor(this);
+  promise.start.handle = s.handle;
+  m_tasks++;
+  post(promise.start);
+
+  return 0;
+}
+
+void executor::run() noexcept {
+  assert(owns_queue());
+
+  if (!m_queue->waiter) {
+    event_queue_claim(m_queue);
+  }
+  assert(m_queue->waiter == thread_get_active());
+
+  while (m_tasks) {
+    event_t *event = event_get(m_queue);
+    if (event) {
+      event->handler(event);
+      continue;
+    }
+    thread_flags_t flags = thread_flags_wait_any(THREAD_FLAG_EVENT | m_flags);
+    flags &= ~THREAD_FLAG_EVENT;
+    if (flags) {
+      wake_flags_waiters(flags);
+    }
+  }
+}
+
+void executor::add_flags_waiter(detail::flags_waiter& waiter) noexcept {
+  assert(owns_queue());
+
+  waiter.next = nullptr;
+  detail::flags_waiter **tail = &m_flags_waiters;
+  while (*tail) {
+    tail = &(*tail)->next;
+  }
+  *tail = &waiter;
+  m_flags |= waiter.mask;
+}
+
+void executor::wake_flags_waiters(thread_flags_t flags) noexcept {
+  detail::flags_waiter *ready = nullptr;
+  detail::flags_waiter **ready_tail = &ready;
+
+  /* the first waiter for a flag gets it, the others keep waiting */
+  m_flags = 0;
+  for (detail::flags_waiter **w = &m_flags_waiters; *w;) {
+    detail::flags_waiter *cur = *w;
+    if (cur->mask & flags) {
+      cur->flags = cur->mask & flags;
+      flags &= ~cur->mask;
+      *w = cur->next;
+      cur->next = nullptr;
+      *ready_tail = cur;
+      ready_tail = &cur->next;
+    }
+    else {
+      m_flags |= cur->mask;
+      w = &cur->next;
+    }
+  }
+
+  /* the waiter is gone once its coroutine is resumed */
+  while (ready) {
+    detail::flags_waiter *next = ready->next;
+    ready->handle.resume();
+    ready = next;
+  }
+}
+
+} // namespace coro
+} // namespace riot
@@ -0,0 +1,752 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    cpp_coro  C++20 coroutines
+ * @ingroup     cpp
+ * @brief       Run many C++20 coroutines on a single thread
+ *
+ * A @ref riot::coro::task is a lazily started coroutine. Tasks are spawned on
+ * a @ref riot::coro::executor, which resumes them from an @ref event_queue_t.
+ * While a task waits, e.g. for a timeout, a mutex or a UDP packet, it does not
+ * occupy a thread: its state lives in a heap allocated coroutine frame, which
+ * is usually much smaller than a thread stack.
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~{.cpp}
+ * riot::coro::task<int> answer() {
+ *   co_await riot::coro::sleep(ZTIMER_MSEC, 100);
+ *   co_return 42;
+ * }
+ *
+ * riot::coro::task<> hello() {
+ *   printf("%d\n", co_await answer());
+ * }
+ *
+ * int main() {
+ *   riot::coro::executor exec;
+ *   exec.spawn(hello());
+ *   exec.run();
+ * }
+ * ~~~~~~~~~~~~~~~~~~~~~~~~
+ *
+ * The following can be awaited within a task:
+ *
+ * - another @ref riot::coro::task, which runs on the executor of the caller
+ * - @ref riot::coro::sleep, a timeout on a ztimer clock
+ * - @ref riot::coro::yield, which lets the other tasks run first
+ * - @ref riot::coro::wait_flags_any, for thread flags set on the thread that
+ *   runs the executor
+ * - @ref riot::coro::mutex::lock, which locks a mutex for tasks. A RIOT
+ *   `mutex_t` can not be awaited, as locking it blocks the whole thread.
+ * - @ref riot::coro::notification::wait, for a notification from another
+ *   task, thread or interrupt handler
+ * - @ref riot::coro::udp_sock::recv (`riot/coro/udp.hpp`), for UDP packets
+ *
+ * Coroutine frames are allocated with `malloc()`. If that fails, the task is
+ * not valid and @ref riot::coro::executor::spawn returns `-ENOMEM`. Exceptions
+ * thrown out of a task terminate the program.
+ *
+ * The module needs a compiler supporting C++20 and selects `-std=c++20`.
+ *
+ * @{
+ *
+ * @file
+ * @brief       C++20 coroutine tasks, executor and awaitables
+ */
+
+#ifndef RIOT_CORO_HPP
+#define RIOT_CORO_HPP
+
+#include <coroutine>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <exception>
+#include <optional>
+#include <utility>
+
+#include "assert.h"
+#include "event.h"
+#include "event/timeout.h"
+#include "irq.h"
+#include "thread_flags.h"
+#include "ztimer.h"
+
+namespace riot {
+namespace coro {
+
+class executor;
+
+namespace detail {
+
+struct spawner;
+
+/**
+ * @brief   Event that resumes a coroutine when it is handled
+ */
+struct resume_event {
+  event_t super;                    /**< event, must be the first member */
+  std::coroutine_handle<> handle;   /**< coroutine to resume */
+
+  resume_event() noexcept : super{}, handle{} {
+    super.handler = &resume_event::handle_event;
+  }
+
+  /**
+   * @brief   Event handler resuming the coroutine
+   */
+  static void handle_event(event_t *event) noexcept {
+    reinterpret_cast<resume_event *>(event)->handle.resume();
+  }
+};
+
+/**
+ * @brief   Coroutine waiting for thread flags
+ */
+struct flags_waiter {
+  flags_waiter *next;               /**< next waiter */
+  thread_flags_t mask;              /**< flags waited for */
+  thread_flags_t flags;             /**< flags received */
+  std::coroutine_handle<> handle;   /**< coroutine to resume */
+};
+
+/**
+ * @brief   Common part of all promise types
+ */
+class promise_base {
+public:
+  /**
+   * @brief   Allocate a coroutine frame
+   *
+   * Returns `nullptr` instead of throwing if out of memory.
+   */
+  static void *operator new(std::size_t size) noexcept {
+    return std::malloc(size);
+  }
+
+  /**
+   * @brief   Free a coroutine frame
+   */
+  static void operator delete(void *ptr) noexcept { std::free(ptr); }
+
+  /**
+   * @brief   Tasks start when they are awaited or spawned
+   */
+  std::suspend_always initial_suspend() noexcept { return {}; }
+
+  /**
+   * @brief   Exceptions leaving a task are fatal
+   */
+  void unhandled_exception() noexcept { std::terminate(); }
+
+  /**
+   * @brief   Get the executor the coroutine runs on
+   */
+  executor *get_executor() const noexcept { return m_exec; }
+
+  /**
+   * @brief   Set the executor the coroutine runs on
+   */
+  void set_executor(executor *exec) noexcept { m_exec = exec; }
+
+  /**
+   * @brief   Get the coroutine to resume when done
+   */
+  std::coroutine_handle<> continuation() const noexcept {
+    return m_continuation;
+  }
+
+  /**
+   * @brief   Set the coroutine to resume when done
+   */
+  void set_continuation(std::coroutine_handle<> handle) noexcept {
+    m_continuation = handle;
+  }
+
+  /**
+   * @brief   Check if the awaiting coroutine is still being suspended
+   */
+  bool is_inline() const noexcept { return m_inline; }
+
+  /**
+   * @brief   Mark the awaiting coroutine as being suspended or not
+   */
+  void set_inline(bool value) noexcept { m_inline = value; }
+
+private:
+  std::coroutine_handle<> m_continuation;
+  executor *m_exec = nullptr;
+  bool m_inline = false;
+};
+
+/**
+ * @brief   Transfers control to the awaiting coroutine when a task is done
+ *
+ * A task that is done before it suspended returns to the awaiter that started
+ * it instead. Symmetric transfer is not a tail call without optimization, so
+ * the stack would grow with every task awaited in a loop otherwise.
+ */
+struct final_awaiter {
+  bool await_ready() const noexcept { return false; }
+
+  template <class Promise>
+  std::coroutine_handle<>
+  await_suspend(std::coroutine_handle<Promise> handle) noexcept {
+    promise_base& promise = handle.promise();
+    if (promise.is_inline()) {
+      promise.set_inline(false);
+      return std::noop_coroutine();
+    }
+    std::coroutine_handle<> next = promise.continuation();
+    return next ? next : std::noop_coroutine();
+  }
+
+  void await_resume() const noexcept {}
+};
+
+/**
+ * @brief   Promise holding the result of a task
+ */
+template <class T>
+class promise : public promise_base {
+public:
+  template <class U>
+  void return_value(U&& value) {
+    m_value.emplace(std::forward<U>(value));
+  }
+
+  T result() { return std::move(*m_value); }
+
+private:
+  std::optional<T> m_value;
+};
+
+/**
+ * @brief   Promise of a task without result
+ */
+template <>
+class promise<void> : public promise_base {
+public:
+  void return_void() noexcept {}
+
+  void result() noexcept {}
+};
+
+} // namespace detail
+
+/**
+ * @brief   Lazily started coroutine with a result of type @p T
+ *
+ * A task starts running when it is awaited with `co_await std::move(t)` or
+ * spawned with @ref executor::spawn. The frame of the coroutine is freed with
+ * the task object.
+ */
+template <class T = void>
+class [[nodiscard]] task {
+public:
+  /**
+   * @brief   Promise type of the coroutine
+   */
+  struct promise_type : detail::promise<T> {
+    task get_return_object() noexcept {
+      return task{std::coroutine_handle<promise_type>::from_promise(*this)};
+    }
+
+    static task get_return_object_on_allocation_failure() noexcept {
+      return task{};
+    }
+
+    detail::final_awaiter final_suspend() noexcept { return {}; }
+  };
+
+  /**
+   * @brief   Handle of the coroutine
+   */
+  using handle_type = std::coroutine_handle<promise_type>;
+
+  /**
+   * @brief   Create an invalid task
+   */
+  task() noexcept = default;
+
+  task(task&& other) noexcept : m_handle{std::exchange(other.m_handle, {})} {}
+
+  task& operator=(task&& other) noexcept {
+    if (this != &other) {
+      reset();
+      m_handle = std::exchange(other.m_handle, {});
+    }
+    return *this;
+  }
+
+  task(const task&) = delete;
+  task& operator=(const task&) = delete;
+
+  ~task() { reset(); }
+
+  /**
+   * @brief   Check if the coroutine frame was allocated
+   */
+  bool valid() const noexcept { return static_cast<bool>(m_handle); }
+
+  /**
+   * @brief   Awaitable of a task
+   */
+  class awaiter {
+  public:
+    explicit awaiter(handle_type handle) noexcept : m_handle{handle} {}
+
+    bool await_ready() const noexcept { return false; }
+
+    template <class Promise>
+    bool await_suspend(std::coroutine_handle<Promise> caller) noexcept {
+      promise_type& promise = m_handle.promise();
+      promise.set_continuation(caller);
+      promise.set_executor(caller.promise().get_executor());
+      promise.set_inline(true);
+      m_handle.resume();
+      if (!promise.is_inline()) {
+        /* done already, continue the caller right away */
+        return false;
+      }
+      /* suspended, the caller is resumed when the task is done */
+      promise.set_inline(false);
+      return true;
+    }
+
+    T await_resume() { return m_handle.promise().result(); }
+
+  private:
+    handle_type m_handle;
+  };
+
+  /**
+   * @brief   Run the task on the executor of the caller and get its result
+   *
+   * @pre     The task is valid
+   */
+  awaiter operator co_await() && noexcept {
+    assert(valid());
+    return awaiter{m_handle};
+  }
+
+private:
+  friend struct detail::spawner;
+
+  explicit task(handle_type handle) noexcept : m_handle{handle} {}
+
+  void reset() noexcept {
+    if (m_handle) {
+      m_handle.destroy();
+      m_handle = nullptr;
+    }
+  }
+
+  handle_type m_handle;
+};
+
+/**
+ * @brief   Runs tasks from an event queue
+ *
+ * An executor either owns its event queue and is run by @ref run, or it posts
+ * to an event queue that is handled elsewhere, e.g. by an
+ * @ref sys_event_thread. Waiting for thread flags needs the former.
+ *
+ * All tasks of an executor run on the thread handling the event queue, which
+ * is also the only thread that may spawn tasks.
+ */
+class executor {
+public:
+  /**
+   * @brief   Create an executor with its own event queue
+   */
+  executor() noexcept : m_queue{&m_own_queue} {
+    event_queue_init_detached(&m_own_queue);
+  }
+
+  /**
+   * @brief   Create an executor on an event queue that is handled elsewhere
+   *
+   * @param[in] queue   event queue to post to
+   */
+  explicit executor(event_queue_t& queue) noexcept : m_queue{&queue} {}
+
+  executor(const executor&) = delete;
+  executor& operator=(const executor&) = delete;
+
+  /**
+   * @brief   Start a task
+   *
+   * The task is resumed from the event queue and its frame is freed when it
+   * is done.
+   *
+   * @param[in] t       task to start
+   *
+   * @return  0 on success
+   * @return  -ENOMEM if the task or the frame to run it could not be allocated
+   */
+  int spawn(task<>&& t) noexcept;
+
+  /**
+   * @brief   Run the tasks until all of them are done
+   *
+   * Claims the event queue for the calling thread.
+   *
+   * @pre     The executor owns its event queue
+   */
+  void run() noexcept;
+
+  /**
+   * @brief   Get the number of tasks that are not done
+   */
+  unsigned tasks() const noexcept { return m_tasks; }
+
+  /**
+   * @brief   Get the event queue of the executor
+   */
+  event_queue_t *queue() noexcept { return m_queue; }
+
+  /**
+   * @brief   Check if the executor owns its event queue
+   */
+  bool owns_queue() const noexcept { return m_queue == &m_own_queue; }
+
+  /**
+   * @brief   Resume a coroutine from the event queue
+   *
+   * May be called from any thread or interrupt handler.
+   *
+   * @param[in] event   event holding the coroutine handle
+   */
+  void post(detail::resume_event& event) noexcept {
+    event_post(m_queue, &event.super);
+  }
+
+  /**
+   * @brief   Wait for thread flags, used by @ref wait_flags_any
+   *
+   * @param[in] waiter  waiting coroutine
+   */
+  void add_flags_waiter(detail::flags_waiter& waiter) noexcept;
+
+private:
+  friend struct detail::spawner;
+
+  void wake_flags_waiters(thread_flags_t flags) noexcept;
+
+  event_queue_t m_own_queue;
+  event_queue_t *m_queue;
+  detail::flags_waiter *m_flags_waiters = nullptr;
+  thread_flags_t m_flags = 0;
+  unsigned m_tasks = 0;
+};
+
+/**
+ * @brief   Awaitable of @ref sleep
+ */
+class sleep_awaiter {
+public:
+  sleep_awaiter(ztimer_clock_t *clock, uint32_t duration) noexcept
+    : m_clock{clock}, m_duration{duration} {}
+
+  bool await_ready() const noexcept { return m_duration == 0; }
+
+  template <class Promise>
+  void await_suspend(std::coroutine_handle<Promise> handle) noexcept {
+    m_event.handle = handle;
+    event_timeout_ztimer_init(&m_timeout, m_clock,
+                              handle.promise().get_executor()->queue(),
+                              &m_event.super);
+    event_timeout_set(&m_timeout, m_duration);
+  }
+
+  void await_resume() const noexcept {}
+
+private:
+  ztimer_clock_t *m_clock;
+  uint32_t m_duration;
+  event_timeout_t m_timeout;
+  detail::resume_event m_event;
+};
+
+/**
+ * @brief   Suspend the calling task for a while
+ *
+ * The other tasks of the executor run in the meantime.
+ *
+ * @param[in] clock       ztimer clock
+ * @param[in] duration    time to sleep in ticks of @p clock
+ */
+inline sleep_awaiter sleep(ztimer_clock_t *clock, uint32_t duration) noexcept {
+  return {clock, duration};
+}
+
+/**
+ * @brief   Awaitable of @ref yield
+ */
+class yield_awaiter {
+public:
+  bool await_ready() const noexcept { return false; }
+
+  template <class Promise>
+  void await_suspend(std::coroutine_handle<Promise> handle) noexcept {
+    m_event.handle = handle;
+    handle.promise().get_executor()->post(m_event);
+  }
+
+  void await_resume() const noexcept {}
+
+private:
+  detail::resume_event m_event;
+};
+
+/**
+ * @brief   Let the tasks that are ready run before the calling task continues
+ */
+inline yield_awaiter yield() noexcept { return {}; }
+
+/**
+ * @brief   Awaitable of @ref wait_flags_any
+ */
+class flags_awaiter {
+public:
+  explicit flags_awaiter(thread_flags_t mask) noexcept
+    : m_waiter{nullptr, mask, 0, {}} {
+    assert(!(mask & THREAD_FLAG_EVENT));
+  }
+
+  bool await_ready() noexcept {
+    m_waiter.flags = thread_flags_clear(m_waiter.mask);
+    return m_waiter.flags != 0;
+  }
+
+  template <class Promise>
+  void await_suspend(std::coroutine_handle<Promise> handle) noexcept {
+    m_waiter.handle = handle;
+    handle.promise().get_executor()->add_flags_waiter(m_waiter);
+  }
+
+  thread_flags_t await_resume() const noexcept { return m_waiter.flags; }
+
+private:
+  detail::flags_waiter m_waiter;
+};
+
+/**
+ * @brief   Wait for any of the given thread flags
+ *
+ * The flags are set on the thread running @ref executor::run. If several
+ * tasks wait for the same flag, the task that waits longest gets it.
+ *
+ * @param[in] mask    flags to wait for, must not contain `THREAD_FLAG_EVENT`
+ *
+ * @return  (on `co_await`) the flags of @p mask that were set, they are
+ *          cleared
+ */
+inline flags_awaiter wait_flags_any(thread_flags_t mask) noexcept {
+  return flags_awaiter{mask};
+}
+
+/**
+ * @brief   Mutex for tasks
+ *
+ * Tasks waiting for the mutex are suspended, other tasks of the executor keep
+ * running. The mutex is handed to the waiting tasks in FIFO order.
+ */
+class mutex {
+  struct waiter {
+    waiter *next;
+    executor *exec;
+    detail::resume_event event;
+  };
+
+public:
+  /**
+   * @brief   Awaitable of @ref lock
+   */
+  class lock_awaiter {
+  public:
+    explicit lock_awaiter(mutex& mtx) noexcept : m_mtx{mtx}, m_waiter{} {}
+
+    bool await_ready() noexcept { return m_mtx.try_lock(); }
+
+    template <class Promise>
+    bool await_suspend(std::coroutine_handle<Promise> handle) noexcept {
+      m_waiter.exec = handle.promise().get_executor();
+      m_waiter.event.handle = handle;
+      return m_mtx.enqueue(m_waiter);
+    }
+
+    void await_resume() const noexcept {}
+
+  private:
+    mutex& m_mtx;
+    waiter m_waiter;
+  };
+
+  constexpr mutex() noexcept = default;
+
+  mutex(const mutex&) = delete;
+  mutex& operator=(const mutex&) = delete;
+
+  /**
+   * @brief   Lock the mutex, `co_await` returns when it is locked
+   */
+  [[nodiscard]] lock_awaiter lock() noexcept { return lock_awaiter{*this}; }
+
+  /**
+   * @brief   Lock the mutex if it is not locked
+   *
+   * @return  `true` if the mutex was locked
+   */
+  bool try_lock() noexcept {
+    unsigned state = irq_disable();
+    bool locked = !m_locked;
+    m_locked = true;
+    irq_restore(state);
+    return locked;
+  }
+
+  /**
+   * @brief   Unlock the mutex
+   *
+   * If tasks are waiting, the mutex stays locked and the first one of them
+   * is resumed.
+   */
+  void unlock() noexcept {
+    unsigned state = irq_disable();
+    waiter *next = m_head;
+    if (next) {
+      m_head = next->next;
+    }
+    else {
+      m_locked = false;
+    }
+    irq_restore(state);
+    if (next) {
+      next->exec->post(next->event);
+    }
+  }
+
+private:
+  /* returns false if the mutex got unlocked in the meantime */
+  bool enqueue(waiter& w) noexcept {
+    unsigned state = irq_disable();
+    if (!m_locked) {
+      m_locked = true;
+      irq_restore(state);
+      return false;
+    }
+    w.next = nullptr;
+    waiter **tail = &m_head;
+    while (*tail) {
+      tail = &(*tail)->next;
+    }
+    *tail = &w;
+    irq_restore(state);
+    return true;
+  }
+
+  waiter *m_head = nullptr;
+  bool m_locked = false;
+};
+
+/**
+ * @brief   Notification for a single waiting task
+ *
+ * A notification without a waiting task is kept until the next wait, several
+ * of them count as one.
+ */
+class notification {
+public:
+  /**
+   * @brief   Awaitable of @ref wait
+   */
+  class wait_awaiter {
+  public:
+    explicit wait_awaiter(notification& n) noexcept : m_notification{n} {}
+
+    bool await_ready() noexcept { return m_notification.try_wait(); }
+
+    template <class Promise>
+    bool await_suspend(std::coroutine_handle<Promise> handle) noexcept {
+      m_event.handle = handle;
+      return m_notification.enqueue(handle.promise().get_executor(), m_event);
+    }
+
+    void await_resume() const noexcept {}
+
+  private:
+    notification& m_notification;
+    detail::resume_event m_event;
+  };
+
+  constexpr notification() noexcept = default;
+
+  notification(const notification&) = delete;
+  notification& operator=(const notification&) = delete;
+
+  /**
+   * @brief   Wait for a notification
+   *
+   * @pre     No other task is waiting
+   */
+  [[nodiscard]] wait_awaiter wait() noexcept { return wait_awaiter{*this}; }
+
+  /**
+   * @brief   Notify the waiting task
+   *
+   * May be called from any thread or interrupt handler. The task is resumed
+   * from the event queue of its executor.
+   */
+  void notify() noexcept {
+    unsigned state = irq_disable();
+    detail::resume_event *event = m_event;
+    executor *exec = m_exec;
+    m_event = nullptr;
+    m_pending = !event;
+    irq_restore(state);
+    if (event) {
+      exec->post(*event);
+    }
+  }
+
+private:
+  bool try_wait() noexcept {
+    unsigned state = irq_disable();
+    bool pending = m_pending;
+    m_pending = false;
+    irq_restore(state);
+    return pending;
+  }
+
+  /* returns false if notified in the meantime */
+  bool enqueue(executor *exec, detail::resume_event& event) noexcept {
+    unsigned state = irq_disable();
+    if (m_pending) {
+      m_pending = false;
+      irq_restore(state);
+      return false;
+    }
+    assert(!m_event);
+    m_exec = exec;
+    m_event = &event;
+    irq_restore(state);
+    return true;
+  }
+
+  detail::resume_event *m_event = nullptr;
+  executor *m_exec = nullptr;
+  bool m_pending = false;
+};
+
+} // namespace coro
+} // namespace riot
+
+#endif // RIOT_CORO_HPP
+/** @} */
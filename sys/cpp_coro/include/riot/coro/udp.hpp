@@ -0,0 +1,171 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     cpp_coro
+ * @{
+ *
+ * @file
+ * @brief       Awaitable UDP sock
+ *
+ * Needs the `sock_udp` module of a network stack, `sock_async_event` is
+ * selected by `cpp_coro`.
+ */
+
+#ifndef RIOT_CORO_UDP_HPP
+#define RIOT_CORO_UDP_HPP
+
+#include <cerrno>
+#include <sys/types.h>
+
+#include "net/sock/async/event.h"
+#include "net/sock/udp.h"
+#include "riot/coro.hpp"
+
+namespace riot {
+namespace coro {
+
+/**
+ * @brief   UDP sock whose receive function can be awaited
+ *
+ * The asynchronous events of the sock are handled by the event queue of an
+ * executor. Only a single task may receive at a time.
+ */
+class udp_sock {
+public:
+  /**
+   * @brief   Awaitable of @ref recv
+   */
+  class recv_awaiter {
+  public:
+    recv_awaiter(udp_sock& sock, void *data, size_t max_len,
+                 sock_udp_ep_t *remote) noexcept
+      : m_sock{sock}, m_data{data}, m_max_len{max_len}, m_remote{remote} {}
+
+    bool await_ready() noexcept { return try_recv(); }
+
+    void await_suspend(std::coroutine_handle<> handle) noexcept {
+      assert(!m_sock.m_waiter);
+      m_handle = handle;
+      m_sock.m_waiter = this;
+    }
+
+    ssize_t await_resume() const noexcept { return m_res; }
+
+  private:
+    friend class udp_sock;
+
+    /* returns false if there is nothing to receive yet */
+    bool try_recv() noexcept {
+      m_res = sock_udp_recv(&m_sock.m_sock, m_data, m_max_len, 0, m_remote);
+      return m_res != -EAGAIN;
+    }
+
+    udp_sock& m_sock;
+    void *m_data;
+    size_t m_max_len;
+    sock_udp_ep_t *m_remote;
+    ssize_t m_res = 0;
+    std::coroutine_handle<> m_handle;
+  };
+
+  udp_sock() noexcept = default;
+
+  udp_sock(const udp_sock&) = delete;
+  udp_sock& operator=(const udp_sock&) = delete;
+
+  ~udp_sock() { close(); }
+
+  /**
+   * @brief   Create the sock
+   *
+   * @param[in] exec    executor of the tasks using the sock
+   * @param[in] local   local end point, see @ref sock_udp_create
+   * @param[in] remote  remote end point, see @ref sock_udp_create
+   * @param[in] flags   flags of the sock, see @ref sock_udp_create
+   *
+   * @return  0 on success
+   * @return  negative errno of @ref sock_udp_create on error
+   */
+  int create(executor& exec, const sock_udp_ep_t *local,
+             const sock_udp_ep_t *remote = nullptr,
+             uint16_t flags = 0) noexcept {
+    assert(!m_open);
+    int res = sock_udp_create(&m_sock, local, remote, flags);
+    if (res < 0) {
+      return res;
+    }
+    sock_udp_event_init(&m_sock, exec.queue(), &udp_sock::handle_async, this);
+    m_open = true;
+    return 0;
+  }
+
+  /**
+   * @brief   Close the sock
+   *
+   * @pre     No task is receiving
+   */
+  void close() noexcept {
+    if (m_open) {
+      assert(!m_waiter);
+      sock_udp_close(&m_sock);
+      m_open = false;
+    }
+  }
+
+  /**
+   * @brief   Receive a packet
+   *
+   * @param[out] data       buffer for the payload
+   * @param[in]  max_len    size of @p data
+   * @param[out] remote     remote end point of the packet, may be `nullptr`
+   *
+   * @return  (on `co_await`) result of @ref sock_udp_recv
+   */
+  [[nodiscard]] recv_awaiter recv(void *data, size_t max_len,
+                                  sock_udp_ep_t *remote = nullptr) noexcept {
+    return recv_awaiter{*this, data, max_len, remote};
+  }
+
+  /**
+   * @brief   Send a packet, see @ref sock_udp_send
+   */
+  ssize_t send(const void *data, size_t len,
+               const sock_udp_ep_t *remote = nullptr) noexcept {
+    return sock_udp_send(&m_sock, data, len, remote);
+  }
+
+  /**
+   * @brief   Get the underlying sock
+   */
+  sock_udp_t *native_handle() noexcept { return &m_sock; }
+
+private:
+  static void handle_async(sock_udp_t *sock, sock_async_flags_t flags,
+                           void *arg) {
+    (void)sock;
+    udp_sock *self = static_cast<udp_sock *>(arg);
+    recv_awaiter *waiter = self->m_waiter;
+
+    if (!(flags & SOCK_ASYNC_MSG_RECV) || !waiter || !waiter->try_recv()) {
+      return;
+    }
+    self->m_waiter = nullptr;
+    waiter->m_handle.resume();
+  }
+
+  sock_udp_t m_sock;
+  recv_awaiter *m_waiter = nullptr;
+  bool m_open = false;
+};
+
+} // namespace coro
+} // namespace riot
+
+#endif // RIOT_CORO_UDP_HPP
+/** @} */
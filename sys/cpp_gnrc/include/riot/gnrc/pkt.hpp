@@ -0,0 +1,503 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    cpp_gnrc  C++ packet views for GNRC
+ * @ingroup     cpp
+ * @brief       Header-only C++ wrappers for @ref net_gnrc_pkt
+ *
+ * @ref riot::gnrc::pkt owns a reference to a packet in the
+ * @ref net_gnrc_pktbuf: it is released when the object goes out of scope, can
+ * be moved but not copied, and @ref riot::gnrc::pkt::share takes an
+ * additional reference explicitly.
+ *
+ * @ref riot::gnrc::snip and @ref riot::gnrc::span are non-owning views of a
+ * snip and of its data. Headers are accessed in place, nothing is allocated
+ * or copied:
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~{.cpp}
+ * void handle_recv(gnrc_pktsnip_t *received) {
+ *   riot::gnrc::pkt p{received};
+ *   udp_hdr_t *udp = riot::gnrc::udp_hdr(p);
+ *   riot::gnrc::coap_view coap{p.payload()};
+ *
+ *   if (udp && coap.valid()) {
+ *     printf("%u: %u\n", byteorder_ntohs(udp->src_port), coap.msg_id());
+ *   }
+ * }   // the packet is released here
+ * ~~~~~~~~~~~~~~~~~~~~~~~~
+ *
+ * All functions are inline. Owning a packet and iterating over its snips
+ * compile to the same code as the equivalent use of the C API. Parsing
+ * headers with the views compiles to nearly the same code as well, but a
+ * packet passed by reference is loaded again after every call. Compare both
+ * with `tests/bench/cpp_gnrc_pkt`. The header works with C++14.
+ *
+ * @{
+ *
+ * @file
+ * @brief       Owning packet and non-owning views of its snips
+ */
+
+#ifndef RIOT_GNRC_PKT_HPP
+#define RIOT_GNRC_PKT_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <utility>
+
+#include "compiler_hints.h"
+#include "kernel_defines.h"
+#include "net/coap.h"
+#include "net/gnrc/pkt.h"
+#include "net/gnrc/pktbuf.h"
+#include "net/ipv6/hdr.h"
+#include "net/udp.h"
+
+namespace riot {
+namespace gnrc {
+
+/**
+ * @brief   Non-owning view of contiguous memory
+ */
+template <class T>
+class span {
+public:
+  constexpr span() noexcept : m_data{nullptr}, m_size{0} {}
+
+  constexpr span(T *data, std::size_t size) noexcept
+    : m_data{data}, m_size{size} {}
+
+  /**
+   * @brief   Convert a span of mutable elements to one of const elements
+   */
+  template <class U>
+  constexpr span(const span<U>& other) noexcept
+    : m_data{other.data()}, m_size{other.size()} {}
+
+  constexpr T *data() const noexcept { return m_data; }
+
+  constexpr std::size_t size() const noexcept { return m_size; }
+
+  constexpr bool empty() const noexcept { return m_size == 0; }
+
+  constexpr T *begin() const noexcept { return m_data; }
+
+  constexpr T *end() const noexcept { return m_data + m_size; }
+
+  /**
+   * @pre     @p idx < size()
+   */
+  constexpr T& operator[](std::size_t idx) const noexcept {
+    return m_data[idx];
+  }
+
+  /**
+   * @brief   Get a part of the span
+   *
+   * @p offset and @p count are clamped to the size of the span.
+   */
+  constexpr span subspan(std::size_t offset,
+                         std::size_t count = SIZE_MAX) const noexcept {
+    offset = (offset < m_size) ? offset : m_size;
+    count = (count < m_size - offset) ? count : m_size - offset;
+    return span{m_data + offset, count};
+  }
+
+  /**
+   * @brief   Access the start of the span as header @p H
+   *
+   * @return  pointer to the header, `nullptr` if the span is too small
+   */
+  template <class H>
+  H *as() const noexcept {
+    return (m_size >= sizeof(H)) ? reinterpret_cast<H *>(m_data) : nullptr;
+  }
+
+private:
+  T *m_data;
+  std::size_t m_size;
+};
+
+/**
+ * @brief   Non-owning view of a snip
+ */
+class snip {
+public:
+  constexpr snip() noexcept : m_snip{nullptr} {}
+
+  explicit constexpr snip(gnrc_pktsnip_t *s) noexcept : m_snip{s} {}
+
+  /**
+   * @brief   Check if the view refers to a snip
+   */
+  explicit constexpr operator bool() const noexcept {
+    return m_snip != nullptr;
+  }
+
+  gnrc_pktsnip_t *get() const noexcept { return m_snip; }
+
+  gnrc_nettype_t type() const noexcept { return m_snip->type; }
+
+  std::size_t size() const noexcept { return m_snip ? m_snip->size : 0; }
+
+  /**
+   * @brief   Get the data of the snip, empty if there is no snip
+   */
+  span<uint8_t> data() const noexcept {
+    return m_snip ? span<uint8_t>{static_cast<uint8_t *>(m_snip->data),
+                                  m_snip->size}
+                  : span<uint8_t>{};
+  }
+
+  /**
+   * @brief   Access the data as header @p H
+   *
+   * @return  pointer to the header, `nullptr` if there is no snip or it is
+   *          too small
+   */
+  template <class H>
+  H *header() const noexcept {
+    if (!m_snip || m_snip->size < sizeof(H)) {
+      return nullptr;
+    }
+    /* a snip with data has a buffer, this spares the caller's check of
+     * the result a second test */
+    if (!m_snip->data) {
+      UNREACHABLE();
+    }
+    return static_cast<H *>(m_snip->data);
+  }
+
+  /**
+   * @brief   Get the next snip of the packet
+   */
+  snip next() const noexcept { return snip{m_snip->next}; }
+
+  bool operator==(const snip& other) const noexcept {
+    return m_snip == other.m_snip;
+  }
+
+  bool operator!=(const snip& other) const noexcept {
+    return m_snip != other.m_snip;
+  }
+
+private:
+  gnrc_pktsnip_t *m_snip;
+};
+
+/**
+ * @brief   Iterator over the snips of a packet
+ */
+class snip_iterator {
+public:
+  using iterator_category = std::forward_iterator_tag; /**< forward only */
+  using value_type = snip;                             /**< snip view */
+  using difference_type = std::ptrdiff_t;              /**< unused */
+  using pointer = const snip *;                        /**< pointer */
+  using reference = const snip&;                       /**< reference */
+
+  explicit constexpr snip_iterator(gnrc_pktsnip_t *s = nullptr) noexcept
+    : m_snip{s} {}
+
+  reference operator*() const noexcept { return m_snip; }
+
+  pointer operator->() const noexcept { return &m_snip; }
+
+  snip_iterator& operator++() noexcept {
+    m_snip = m_snip.next();
+    return *this;
+  }
+
+  snip_iterator operator++(int) noexcept {
+    snip_iterator prev = *this;
+    ++*this;
+    return prev;
+  }
+
+  bool operator==(const snip_iterator& other) const noexcept {
+    return m_snip == other.m_snip;
+  }
+
+  bool operator!=(const snip_iterator& other) const noexcept {
+    return m_snip != other.m_snip;
+  }
+
+private:
+  snip m_snip;
+};
+
+/**
+ * @brief   Owning reference to a packet in the packet buffer
+ */
+class pkt {
+public:
+  constexpr pkt() noexcept : m_pkt{nullptr} {}
+
+  /**
+   * @brief   Take over a reference, e.g. one received from netapi
+   *
+   * @param[in] p   packet, may be `nullptr`
+   */
+  explicit constexpr pkt(gnrc_pktsnip_t *p) noexcept : m_pkt{p} {}
+
+  pkt(pkt&& other) noexcept : m_pkt{std::exchange(other.m_pkt, nullptr)} {}
+
+  pkt& operator=(pkt&& other) noexcept {
+    if (this != &other) {
+      reset(std::exchange(other.m_pkt, nullptr));
+    }
+    return *this;
+  }
+
+  pkt(const pkt&) = delete;
+  pkt& operator=(const pkt&) = delete;
+
+  ~pkt() { reset(); }
+
+  /**
+   * @brief   Check if there is a packet
+   */
+  explicit constexpr operator bool() const noexcept {
+    return m_pkt != nullptr;
+  }
+
+  gnrc_pktsnip_t *get() const noexcept { return m_pkt; }
+
+  /**
+   * @brief   Give up the reference without releasing it, e.g. to send it
+   */
+  gnrc_pktsnip_t *release() noexcept {
+    return std::exchange(m_pkt, nullptr);
+  }
+
+  /**
+   * @brief   Release the packet and take over another reference
+   *
+   * @param[in] p   packet, may be `nullptr`
+   */
+  void reset(gnrc_pktsnip_t *p = nullptr) noexcept {
+    if (m_pkt) {
+      gnrc_pktbuf_release(m_pkt);
+    }
+    m_pkt = p;
+  }
+
+  /**
+   * @brief   Take another reference to the packet
+   *
+   * @pre     There is a packet
+   */
+  pkt share() const noexcept {
+    gnrc_pktbuf_hold(m_pkt, 1);
+    return pkt{m_pkt};
+  }
+
+  /**
+   * @brief   Make the first snip writable, see @ref gnrc_pktbuf_start_write
+   *
+   * If the packet is shared, the first snip is copied and this object
+   * refers to the copy afterwards.
+   *
+   * @pre     There is a packet
+   *
+   * @return  true, if the first snip is writable
+   * @return  false, if there is no space for the copy. This object keeps its
+   *          reference to the shared packet then.
+   */
+  bool start_write() noexcept {
+    gnrc_pktsnip_t *p = gnrc_pktbuf_start_write(m_pkt);
+
+    if (!p) {
+      return false;
+    }
+    m_pkt = p;
+    return true;
+  }
+
+  /**
+   * @brief   Get the first snip, the payload of a received packet
+   */
+  snip front() const noexcept { return snip{m_pkt}; }
+
+  /**
+   * @brief   Get the data of the first snip
+   *
+   * @pre     There is a packet
+   */
+  span<uint8_t> payload() const noexcept {
+    return span<uint8_t>{static_cast<uint8_t *>(m_pkt->data), m_pkt->size};
+  }
+
+  /**
+   * @brief   Find the first snip of a type
+   *
+   * @return  the snip, an empty view if there is none
+   */
+  snip find(gnrc_nettype_t type) const noexcept {
+    return snip{gnrc_pktsnip_search_type(m_pkt, type)};
+  }
+
+  /**
+   * @brief   Access the first snip of a type as header @p H
+   *
+   * @return  pointer to the header, `nullptr` if there is no such snip or it
+   *          is too small
+   */
+  template <class H>
+  H *header(gnrc_nettype_t type) const noexcept {
+    return find(type).template header<H>();
+  }
+
+  /**
+   * @brief   Get the length of the packet, see @ref gnrc_pkt_len
+   */
+  std::size_t size() const noexcept { return gnrc_pkt_len(m_pkt); }
+
+  snip_iterator begin() const noexcept { return snip_iterator{m_pkt}; }
+
+  snip_iterator end() const noexcept { return snip_iterator{}; }
+
+private:
+  gnrc_pktsnip_t *m_pkt;
+};
+
+#if IS_USED(MODULE_GNRC_NETTYPE_IPV6) || defined(DOXYGEN)
+/**
+ * @brief   Get the IPv6 header of a packet
+ *
+ * @return  the header, `nullptr` if there is none
+ */
+inline ipv6_hdr_t *ipv6_hdr(const pkt& p) noexcept {
+  return p.header<ipv6_hdr_t>(GNRC_NETTYPE_IPV6);
+}
+#endif
+
+#if IS_USED(MODULE_GNRC_NETTYPE_UDP) || defined(DOXYGEN)
+/**
+ * @brief   Get the UDP header of a packet
+ *
+ * @return  the header, `nullptr` if there is none
+ */
+inline udp_hdr_t *udp_hdr(const pkt& p) noexcept {
+  return p.header<udp_hdr_t>(GNRC_NETTYPE_UDP);
+}
+#endif
+
+/**
+ * @brief   Non-owning view of a CoAP message
+ *
+ * Only the accessors of the fixed header need no parsing, @ref payload skips
+ * the options.
+ */
+class coap_view {
+public:
+  /**
+   * @brief   View a message, usually the payload of a UDP packet
+   *
+   * @param[in] msg     the message
+   */
+  explicit constexpr coap_view(span<const uint8_t> msg) noexcept
+    : m_msg{msg} {}
+
+  /**
+   * @brief   Check if the message has a CoAP version 1 header and token
+   */
+  bool valid() const noexcept {
+    return (m_msg.size() >= HDR_SIZE) && (version() == COAP_V1) &&
+           (token_len() <= COAP_TOKEN_LENGTH_MAX) &&
+           (m_msg.size() >= HDR_SIZE + token_len());
+  }
+
+  /**
+   * @pre     valid() for this and all other accessors
+   */
+  unsigned version() const noexcept { return m_msg[0] >> 6; }
+
+  /**
+   * @brief   Get the message type, e.g. @ref COAP_TYPE_CON
+   */
+  unsigned type() const noexcept { return (m_msg[0] >> 4) & 0x3; }
+
+  unsigned token_len() const noexcept { return m_msg[0] & 0xf; }
+
+  /**
+   * @brief   Get the code, e.g. @ref COAP_METHOD_GET
+   */
+  unsigned code() const noexcept { return m_msg[1]; }
+
+  unsigned msg_id() const noexcept { return (m_msg[2] << 8) | m_msg[3]; }
+
+  span<const uint8_t> token() const noexcept {
+    return m_msg.subspan(HDR_SIZE, token_len());
+  }
+
+  /**
+   * @brief   Get the options, up to the payload marker
+   */
+  span<const uint8_t> options() const noexcept {
+    std::size_t start = HDR_SIZE + token_len();
+    return m_msg.subspan(start, options_end() - start);
+  }
+
+  /**
+   * @brief   Get the payload
+   *
+   * @return  the payload, empty if there is none or the options are invalid
+   */
+  [[gnu::always_inline]] span<const uint8_t> payload() const noexcept {
+    std::size_t end = options_end();
+
+    /* options_end() only stops before the end at a payload marker */
+    if (end >= m_msg.size()) {
+      return span<const uint8_t>{};
+    }
+    end += COAP_PAYLOAD_MARKER_SIZE;
+    return span<const uint8_t>{m_msg.data() + end, m_msg.size() - end};
+  }
+
+private:
+  static constexpr std::size_t HDR_SIZE = 4;
+
+  /* offset of the payload marker, at or past the end of the message if there
+   * is none, always inlined as -Os would outline it and spill the view for
+   * the call */
+  [[gnu::always_inline]] std::size_t options_end() const noexcept {
+    std::size_t pos = HDR_SIZE + token_len();
+
+    while ((pos < m_msg.size()) && (m_msg[pos] != COAP_PAYLOAD_MARKER)) {
+      unsigned delta = m_msg[pos] >> 4;
+      std::size_t len = m_msg[pos] & 0xf;
+
+      pos++;
+      if (delta == 15 || len == 15) {
+        return m_msg.size();
+      }
+      pos += (delta == 13) ? 1 : (delta == 14) ? 2 : 0;
+      if (len >= 13) {
+        if (pos + len - 12 > m_msg.size()) {
+          return m_msg.size();
+        }
+        len = (len == 13) ? 13U + m_msg[pos]
+                          : 269U + ((m_msg[pos] << 8) | m_msg[pos + 1]);
+        pos += (len >= 269) ? 2 : 1;
+      }
+      pos += len;
+    }
+    return pos;
+  }
+
+  span<const uint8_t> m_msg;
+};
+
+} // namespace gnrc
+} // namespace riot
+
+#endif // RIOT_GNRC_PKT_HPP
+/** @} */
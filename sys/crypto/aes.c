@@ -32,6 +32,7 @@
  * @}
  */
 
+#include <stdbool.h>
 #include <string.h>
 #include <stdlib.h>
 #include <stdint.h>
@@ -39,6 +40,16 @@
 #include "crypto/ciphers.h"
 #include "kernel_defines.h"
 
+#if IS_USED(MODULE_CRYPTO_AES_HW) && defined(__GNUC__) && \
+    (defined(__x86_64__) || defined(__i386__))
+#  include <cpuid.h>
+#  include <immintrin.h>
+#  define AES_HW_X86    1
+#elif IS_USED(MODULE_CRYPTO_AES_HW) && defined(__ARM_FEATURE_AES)
+#  include <arm_neon.h>
+#  define AES_HW_ARM    1
+#endif
+
 #if !IS_USED(MODULE_CRYPTO_AES_128) && !IS_USED(MODULE_CRYPTO_AES_192) && \
     !IS_USED(MODULE_CRYPTO_AES_256)
     #error "sys/crypto/aes: No aes module used."
@@ -77,7 +88,8 @@ static const cipher_interface_t aes_interface = {
     AES_BLOCK_SIZE,
     aes_init,
     aes_encrypt,
-    aes_decrypt
+    aes_decrypt,
+    aes_encrypt_blocks,
 };
 
 const cipher_id_t CIPHER_AES = &aes_interface;
@@ -1065,20 +1077,9 @@ static int aes_set_decrypt_key(const unsigned char *userKey, const int bits,
  * Encrypt a single block
  * in and out can overlap
  */
-int aes_encrypt(const cipher_context_t *context, const uint8_t *plainBlock,
-                uint8_t *cipherBlock)
+static void _encrypt_block(const aes_key_t *key, const uint8_t *plainBlock,
+                           uint8_t *cipherBlock)
 {
-    /* setup AES_KEY */
-    int res;
-    aes_key_t aeskey;
-    const aes_key_t *key = &aeskey;
-
-    res = aes_set_encrypt_key((unsigned char *)context->context,
-                              AES_KEY_SIZE(context) * 8, &aeskey);
-    if (res < 0) {
-        return res;
-    }
-
     const u32 *rk;
     u32 s0, s1, s2, s3, t0, t1, t2, t3;
 
@@ -1327,6 +1328,128 @@ int aes_encrypt(const cipher_context_t *context, const uint8_t *plainBlock,
         (Te4((t2) & 0xff)       & 0x000000ff) ^
         rk[3];
     PUTU32(cipherBlock + 12, s3);
+}
+
+#if AES_HW_X86
+static bool _aes_ni_supported(void)
+{
+    /* native builds may run on any x86 CPU */
+    static int supported = -1;
+    unsigned eax, ebx, ecx, edx;
+
+    if (supported < 0) {
+        supported = __get_cpuid(1, &eax, &ebx, &ecx, &edx) && (ecx & bit_AES);
+    }
+    return supported;
+}
+
+__attribute__((target("aes,sse2")))
+static void _encrypt_blocks_hw(const aes_key_t *key, const uint8_t *in,
+                               uint8_t *out, size_t blocks)
+{
+    __m128i rk[AES_MAXNR + 1];
+    int rounds = key->rounds;
+
+    for (int i = 0; i <= rounds; i++) {
+        uint8_t tmp[AES_BLOCK_SIZE];
+
+        for (int j = 0; j < 4; j++) {
+            PUTU32(tmp + 4 * j, key->rd_key[4 * i + j]);
+        }
+        rk[i] = _mm_loadu_si128((const __m128i *)tmp);
+    }
+
+    /* interleave four blocks to hide the latency of the AES instructions */
+    for (; blocks >= 4; blocks -= 4, in += 64, out += 64) {
+        __m128i b[4];
+
+        for (int j = 0; j < 4; j++) {
+            b[j] = _mm_xor_si128(_mm_loadu_si128((const __m128i *)in + j), rk[0]);
+        }
+        for (int r = 1; r < rounds; r++) {
+            for (int j = 0; j < 4; j++) {
+                b[j] = _mm_aesenc_si128(b[j], rk[r]);
+            }
+        }
+        for (int j = 0; j < 4; j++) {
+            b[j] = _mm_aesenclast_si128(b[j], rk[rounds]);
+            _mm_storeu_si128((__m128i *)out + j, b[j]);
+        }
+    }
+
+    for (; blocks; blocks--, in += 16, out += 16) {
+        __m128i b = _mm_xor_si128(_mm_loadu_si128((const __m128i *)in), rk[0]);
+
+        for (int r = 1; r < rounds; r++) {
+            b = _mm_aesenc_si128(b, rk[r]);
+        }
+        _mm_storeu_si128((__m128i *)out, _mm_aesenclast_si128(b, rk[rounds]));
+    }
+}
+#endif
+
+#if AES_HW_ARM
+static void _encrypt_blocks_hw(const aes_key_t *key, const uint8_t *in,
+                               uint8_t *out, size_t blocks)
+{
+    uint8x16_t rk[AES_MAXNR + 1];
+    int rounds = key->rounds;
+
+    for (int i = 0; i <= rounds; i++) {
+        uint8_t tmp[AES_BLOCK_SIZE];
+
+        for (int j = 0; j < 4; j++) {
+            PUTU32(tmp + 4 * j, key->rd_key[4 * i + j]);
+        }
+        rk[i] = vld1q_u8(tmp);
+    }
+
+    for (; blocks; blocks--, in += 16, out += 16) {
+        uint8x16_t b = vld1q_u8(in);
+
+        for (int r = 0; r < rounds - 1; r++) {
+            b = vaesmcq_u8(vaeseq_u8(b, rk[r]));
+        }
+        b = veorq_u8(vaeseq_u8(b, rk[rounds - 1]), rk[rounds]);
+        vst1q_u8(out, b);
+    }
+}
+#endif
+
+int aes_encrypt(const cipher_context_t *context, const uint8_t *plainBlock,
+                uint8_t *cipherBlock)
+{
+    return aes_encrypt_blocks(context, plainBlock, cipherBlock, 1);
+}
+
+int aes_encrypt_blocks(const cipher_context_t *context, const uint8_t *plain,
+                       uint8_t *cipher, size_t blocks)
+{
+    /* setup AES_KEY once for all blocks */
+    int res;
+    aes_key_t aeskey;
+
+    res = aes_set_encrypt_key((unsigned char *)context->context,
+                              AES_KEY_SIZE(context) * 8, &aeskey);
+    if (res < 0) {
+        return res;
+    }
+
+#if AES_HW_X86
+    if (_aes_ni_supported()) {
+        _encrypt_blocks_hw(&aeskey, plain, cipher, blocks);
+        return 1;
+    }
+#elif AES_HW_ARM
+    _encrypt_blocks_hw(&aeskey, plain, cipher, blocks);
+    return 1;
+#endif
+
+    for (; blocks; blocks--) {
+        _encrypt_block(&aeskey, plain, cipher);
+        plain += AES_BLOCK_SIZE;
+        cipher += AES_BLOCK_SIZE;
+    }
     return 1;
 }
 
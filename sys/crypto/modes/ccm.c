@@ -19,6 +19,7 @@
  */
 
 #include <assert.h>
+#include <stdbool.h>
 #include <string.h>
 #include "debug.h"
 #include "crypto/helper.h"
@@ -70,6 +71,58 @@ static int ccm_compute_cbc_mac(const cipher_t *cipher, const uint8_t iv[16],
     return offset;
 }
 
+/*
+ * Counter mode en-/decryption with the CBC-MAC computed over the plaintext on
+ * the fly. The MAC of each block is calculated together with the key stream
+ * of the following one, so that the cipher can process both in one go.
+ */
+static int ccm_crypt_cbc_mac(const cipher_t *cipher, uint8_t nonce_counter[16],
+                             uint8_t nonce_len, const uint8_t *input,
+                             size_t length, uint8_t *output, bool decrypt,
+                             uint8_t mac[16])
+{
+    uint8_t blocks[2 * CCM_BLOCK_SIZE];
+    uint8_t *mac_block = &blocks[0];
+    uint8_t *stream_block = &blocks[CCM_BLOCK_SIZE];
+    bool mac_pending = false;
+    size_t offset;
+
+    for (offset = 0; offset < length; offset += CCM_BLOCK_SIZE) {
+        size_t block_len = (length - offset > CCM_BLOCK_SIZE) ?
+                           CCM_BLOCK_SIZE : length - offset;
+
+        memcpy(stream_block, nonce_counter, CCM_BLOCK_SIZE);
+        if (mac_pending) {
+            if (cipher_encrypt_blocks(cipher, blocks, blocks, 2) != 1) {
+                return CIPHER_ERR_ENC_FAILED;
+            }
+            memcpy(mac, mac_block, CCM_BLOCK_SIZE);
+        }
+        else if (cipher_encrypt(cipher, stream_block, stream_block) != 1) {
+            return CIPHER_ERR_ENC_FAILED;
+        }
+
+        /* input and output may overlap, so feed the MAC with the plaintext
+         * before it is overwritten when encrypting */
+        memcpy(mac_block, mac, CCM_BLOCK_SIZE);
+        for (size_t i = 0; i < block_len; ++i) {
+            uint8_t in = input[offset + i];
+
+            output[offset + i] = in ^ stream_block[i];
+            mac_block[i] ^= decrypt ? output[offset + i] : in;
+        }
+        mac_pending = true;
+
+        crypto_block_inc_ctr(nonce_counter, CCM_BLOCK_SIZE - nonce_len);
+    }
+
+    if (mac_pending && (cipher_encrypt(cipher, mac_block, mac) != 1)) {
+        return CIPHER_ERR_ENC_FAILED;
+    }
+
+    return length;
+}
+
 static int ccm_create_mac_iv(const cipher_t *cipher, uint8_t auth_data_len, uint8_t M,
                              uint8_t L, const uint8_t *nonce, uint8_t nonce_len,
                              size_t plaintext_len, uint8_t X1[16])
@@ -200,17 +253,12 @@ int cipher_encrypt_ccm(const cipher_t *cipher,
         return CCM_ERR_INVALID_DATA_LENGTH;
     }
 
-    /* MAC calculation (T) with additional data and plaintext */
+    /* MAC calculation (T) with additional data */
     len = ccm_compute_adata_mac(cipher, auth_data, auth_data_len, mac_iv);
     if (len < 0) {
         return len;
     }
 
-    len = ccm_compute_cbc_mac(cipher, mac_iv, input, input_len, mac);
-    if (len < 0) {
-        return len;
-    }
-
     /* Compute first stream block */
     nonce_counter[0] = length_encoding - 1;
     memcpy(&nonce_counter[1], nonce,
@@ -221,10 +269,12 @@ int cipher_encrypt_ccm(const cipher_t *cipher,
         return len;
     }
 
-    /* Encrypt message in counter mode  */
+    /* Encrypt message in counter mode and compute the MAC (T) over the
+     * plaintext */
+    memcpy(mac, mac_iv, sizeof(mac));
     crypto_block_inc_ctr(nonce_counter, block_size - nonce_len);
-    len = cipher_encrypt_ctr(cipher, nonce_counter, nonce_len, input,
-                             input_len, output);
+    len = ccm_crypt_cbc_mac(cipher, nonce_counter, nonce_len, input,
+                            input_len, output, false, mac);
     if (len < 0) {
         return len;
     }
@@ -260,39 +310,37 @@ int cipher_decrypt_ccm(const cipher_t *cipher,
         return CCM_ERR_INVALID_LENGTH_ENCODING;
     }
 
-    /* Compute first stream block */
-    nonce_counter[0] = length_encoding - 1;
+    /* Create B0, encrypt it (X1) and use it as mac_iv */
+    plain_len = input_len - mac_length;
     block_size = cipher_get_block_size(cipher);
     assert(block_size == CCM_BLOCK_SIZE);
-    memcpy(&nonce_counter[1], nonce, min(nonce_len,
-                                         (size_t)15 - length_encoding));
-    len = cipher_encrypt_ctr(cipher, nonce_counter, block_size, zero_block,
-                             block_size, stream_block);
-    if (len < 0) {
-        return len;
-    }
-
-    /* Decrypt message in counter mode */
-    plain_len = input_len - mac_length;
-    crypto_block_inc_ctr(nonce_counter, block_size - nonce_len);
-    len = cipher_encrypt_ctr(cipher, nonce_counter, nonce_len, input,
-                             plain_len, plain);
-    if (len < 0) {
-        return len;
-    }
-
-    /* Create B0, encrypt it (X1) and use it as mac_iv */
     if (ccm_create_mac_iv(cipher, auth_data_len, mac_length, length_encoding,
                           nonce, nonce_len, plain_len, mac_iv) < 0) {
         return CCM_ERR_INVALID_DATA_LENGTH;
     }
 
-    /* MAC calculation (T) with additional data and plaintext */
+    /* MAC calculation (T) with additional data */
     len = ccm_compute_adata_mac(cipher, auth_data, auth_data_len, mac_iv);
     if (len < 0) {
         return len;
     }
-    len = ccm_compute_cbc_mac(cipher, mac_iv, plain, plain_len, mac);
+
+    /* Compute first stream block */
+    nonce_counter[0] = length_encoding - 1;
+    memcpy(&nonce_counter[1], nonce, min(nonce_len,
+                                         (size_t)15 - length_encoding));
+    len = cipher_encrypt_ctr(cipher, nonce_counter, block_size, zero_block,
+                             block_size, stream_block);
+    if (len < 0) {
+        return len;
+    }
+
+    /* Decrypt message in counter mode and compute the MAC (T) over the
+     * decrypted plaintext */
+    memcpy(mac, mac_iv, sizeof(mac));
+    crypto_block_inc_ctr(nonce_counter, block_size - nonce_len);
+    len = ccm_crypt_cbc_mac(cipher, nonce_counter, nonce_len, input,
+                            plain_len, plain, true, mac);
     if (len < 0) {
         return len;
     }
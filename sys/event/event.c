@@ -22,7 +22,9 @@
  */
 
 #include <assert.h>
+#include <inttypes.h>
 #include <stdbool.h>
+#include <stdio.h>
 #include <string.h>
 
 #include "event.h"
@@ -34,6 +36,23 @@
 #include "xtimer.h"
 #endif
 
+#if IS_USED(MODULE_EVENT_STATS)
+static inline void _stats_queued(event_queue_t *queue)
+{
+    if (++queue->stats.depth > queue->stats.depth_max) {
+        queue->stats.depth_max = queue->stats.depth;
+    }
+}
+
+static inline void _stats_dequeued(event_queue_t *queue)
+{
+    queue->stats.depth--;
+}
+#else
+static inline void _stats_queued(event_queue_t *queue) { (void)queue; }
+static inline void _stats_dequeued(event_queue_t *queue) { (void)queue; }
+#endif
+
 void event_post(event_queue_t *queue, event_t *event)
 {
     assert(queue && event);
@@ -42,6 +61,7 @@ void event_post(event_queue_t *queue, event_t *event)
     unsigned state = irq_disable();
     if (!event->list_node.next) {
         clist_rpush(&queue->event_list, &event->list_node);
+        _stats_queued(queue);
     }
     thread_t *waiter = queue->waiter;
     irq_restore(state);
@@ -57,7 +77,9 @@ void event_cancel(event_queue_t *queue, event_t *event)
     assert(event);
 
     unsigned state = irq_disable();
-    clist_remove(&queue->event_list, &event->list_node);
+    if (clist_remove(&queue->event_list, &event->list_node)) {
+        _stats_dequeued(queue);
+    }
     event->list_node.next = NULL;
     irq_restore(state);
 }
@@ -77,6 +99,9 @@ event_t *event_get(event_queue_t *queue)
 {
     unsigned state = irq_disable();
     event_t *result = (event_t *) clist_lpop(&queue->event_list);
+    if (result) {
+        _stats_dequeued(queue);
+    }
     irq_restore(state);
 
     if (result) {
@@ -85,7 +110,8 @@ event_t *event_get(event_queue_t *queue)
     return result;
 }
 
-event_t *event_wait_multi(event_queue_t *queues, size_t n_queues)
+static event_t *_wait_multi(event_queue_t *queues, size_t n_queues,
+                            size_t *idx)
 {
     assert(queues && n_queues);
     event_t *result = NULL;
@@ -97,6 +123,8 @@ event_t *event_wait_multi(event_queue_t *queues, size_t n_queues)
             result = container_of(clist_lpop(&queues[i].event_list),
                                   event_t, list_node);
             if (result) {
+                _stats_dequeued(&queues[i]);
+                *idx = i;
                 break;
             }
         }
@@ -112,6 +140,65 @@ event_t *event_wait_multi(event_queue_t *queues, size_t n_queues)
     }
 }
 
+event_t *event_wait_multi(event_queue_t *queues, size_t n_queues)
+{
+    size_t idx;
+
+    return _wait_multi(queues, n_queues, &idx);
+}
+
+static void _handle(event_queue_t *queue, event_t *event)
+{
+    (void)queue;
+
+    if (IS_USED(MODULE_EVENT_LOOP_DEBUG) || IS_USED(MODULE_EVENT_STATS)) {
+        /* the handler may free or repost the event */
+        event_handler_t handler = event->handler;
+        uint32_t now;
+
+        ztimer_acquire(ZTIMER_USEC);
+        if (IS_USED(MODULE_EVENT_LOOP_DEBUG)) {
+            printf("event: executing %p->%p\n",
+                   (void *)event, (void *)(uintptr_t)handler);
+        }
+        now = ztimer_now(ZTIMER_USEC);
+
+        handler(event);
+
+        now = ztimer_now(ZTIMER_USEC) - now;
+        if (IS_USED(MODULE_EVENT_LOOP_DEBUG)) {
+            printf("event: %p took %" PRIu32 " µs\n", (void *)event, now);
+        }
+        ztimer_release(ZTIMER_USEC);
+
+#if IS_USED(MODULE_EVENT_STATS)
+        queue->stats.handled++;
+        queue->stats.runtime_us += now;
+        if (now >= queue->stats.runtime_max_us) {
+            queue->stats.runtime_max_us = now;
+            queue->stats.slowest = handler;
+        }
+#endif
+    }
+    else {
+        event->handler(event);
+    }
+}
+
+void event_loop_multi(event_queue_t *queues, size_t n_queues)
+{
+    while (1) {
+        size_t idx;
+        event_t *event = _wait_multi(queues, n_queues, &idx);
+        unsigned budget = CONFIG_EVENT_LOOP_BATCH_BUDGET;
+
+        /* drain the queue the event came from before checking the others */
+        do {
+            _handle(&queues[idx], event);
+        } while (--budget && (event = event_get(&queues[idx])));
+    }
+}
+
 #if IS_USED(MODULE_XTIMER) || IS_USED(MODULE_ZTIMER)
 static event_t *_wait_timeout(event_queue_t *queue)
 {
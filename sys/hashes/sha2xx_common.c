@@ -46,10 +46,22 @@
  * @}
  */
 
-#include <stdint.h>
 #include <assert.h>
+#include <stdbool.h>
+#include <stdint.h>
 
 #include "hashes/sha2xx_common.h"
+#include "modules.h"
+
+#if IS_USED(MODULE_SHA256_HW) && defined(__GNUC__) && \
+    (defined(__x86_64__) || defined(__i386__))
+#  include <cpuid.h>
+#  include <immintrin.h>
+#  define SHA256_HW_X86     1
+#elif IS_USED(MODULE_SHA256_HW) && defined(__ARM_FEATURE_SHA2)
+#  include <arm_neon.h>
+#  define SHA256_HW_ARM     1
+#endif
 
 #ifdef __BIG_ENDIAN__
 /* Copy a vector of big-endian uint32_t into a vector of bytes */
@@ -134,6 +146,59 @@ static const uint32_t K[64] = {
  * SHA256 block compression function.  The 256-bit state is transformed via
  * the 512-bit input block to produce a new state.
  */
+#if IS_USED(MODULE_SHA256_FAST)
+/* one round on rotating working variables, adds t0 to d and sets h to t0 + t1 */
+#define ROUND(a, b, c, d, e, f, g, h, k, w) do {                   \
+        uint32_t t0 = h + S1(e) + Ch(e, f, g) + (w) + (k);          \
+        d += t0;                                                    \
+        h = t0 + S0(a) + Maj(a, b, c);                              \
+    } while (0)
+
+/* expand the message schedule in a ring buffer of 16 words */
+#define W16(j)  (W[j] += s1(W[((j) + 14) & 15]) + W[((j) + 9) & 15] + \
+                         s0(W[((j) + 1) & 15]))
+
+/* round i + j, the message schedule is only expanded after round 15 */
+#define R(a, b, c, d, e, f, g, h, j) \
+    ROUND(a, b, c, d, e, f, g, h, K[i + (j)], i ? W16(j) : W[j])
+
+static void sha2xx_transform(uint32_t *state, const unsigned char block[64])
+{
+    uint32_t W[16];
+    uint32_t a = state[0], b = state[1], c = state[2], d = state[3];
+    uint32_t e = state[4], f = state[5], g = state[6], h = state[7];
+
+    be32dec_vect(W, block, 64);
+
+    for (unsigned i = 0; i < 64; i += 16) {
+        R(a, b, c, d, e, f, g, h, 0);
+        R(h, a, b, c, d, e, f, g, 1);
+        R(g, h, a, b, c, d, e, f, 2);
+        R(f, g, h, a, b, c, d, e, 3);
+        R(e, f, g, h, a, b, c, d, 4);
+        R(d, e, f, g, h, a, b, c, 5);
+        R(c, d, e, f, g, h, a, b, 6);
+        R(b, c, d, e, f, g, h, a, 7);
+        R(a, b, c, d, e, f, g, h, 8);
+        R(h, a, b, c, d, e, f, g, 9);
+        R(g, h, a, b, c, d, e, f, 10);
+        R(f, g, h, a, b, c, d, e, 11);
+        R(e, f, g, h, a, b, c, d, 12);
+        R(d, e, f, g, h, a, b, c, 13);
+        R(c, d, e, f, g, h, a, b, 14);
+        R(b, c, d, e, f, g, h, a, 15);
+    }
+
+    state[0] += a;
+    state[1] += b;
+    state[2] += c;
+    state[3] += d;
+    state[4] += e;
+    state[5] += f;
+    state[6] += g;
+    state[7] += h;
+}
+#else
 static void sha2xx_transform(uint32_t *state, const unsigned char block[64])
 {
     uint32_t W[64];
@@ -167,6 +232,134 @@ static void sha2xx_transform(uint32_t *state, const unsigned char block[64])
         state[i] += S[i];
     }
 }
+#endif
+
+#if SHA256_HW_X86
+static bool _sha_ni_supported(void)
+{
+    /* native builds may run on any x86 CPU */
+    static int supported = -1;
+    unsigned eax, ebx, ecx, edx;
+
+    if (supported < 0) {
+        supported = __get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx) &&
+                    (ebx & bit_SHA);
+    }
+    return supported;
+}
+
+/* SHA-256 using the SHA extensions, the state is kept as ABEF and CDGH */
+__attribute__((target("sha,sse4.1,ssse3")))
+static void _transform_sha_ni(uint32_t *state, const unsigned char *data,
+                              size_t blocks)
+{
+    const __m128i bswap = _mm_set_epi64x(0x0c0d0e0f08090a0bULL,
+                                         0x0405060700010203ULL);
+    __m128i state0, state1, tmp;
+
+    tmp = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i *)&state[0]), 0xb1);
+    state1 = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i *)&state[4]), 0x1b);
+    state0 = _mm_alignr_epi8(tmp, state1, 8);
+    state1 = _mm_blend_epi16(state1, tmp, 0xf0);
+
+    for (; blocks; blocks--, data += 64) {
+        __m128i abef = state0, cdgh = state1;
+        __m128i msg[4];
+
+        for (unsigned i = 0; i < 4; i++) {
+            msg[i] = _mm_loadu_si128((const __m128i *)(data + 16 * i));
+            msg[i] = _mm_shuffle_epi8(msg[i], bswap);
+        }
+        /* four rounds per iteration, the message schedule is expanded
+         * three quadruples of words ahead */
+        for (unsigned i = 0; i < 16; i++) {
+            __m128i w = _mm_add_epi32(msg[i & 3],
+                                      _mm_loadu_si128((const __m128i *)&K[4 * i]));
+
+            state1 = _mm_sha256rnds2_epu32(state1, state0, w);
+            if (i >= 3 && i < 15) {
+                tmp = _mm_alignr_epi8(msg[i & 3], msg[(i - 1) & 3], 4);
+                tmp = _mm_add_epi32(msg[(i + 1) & 3], tmp);
+                msg[(i + 1) & 3] = _mm_sha256msg2_epu32(tmp, msg[i & 3]);
+            }
+            state0 = _mm_sha256rnds2_epu32(state0, state1,
+                                           _mm_shuffle_epi32(w, 0x0e));
+            if (i >= 1 && i < 13) {
+                msg[(i - 1) & 3] = _mm_sha256msg1_epu32(msg[(i - 1) & 3],
+                                                        msg[i & 3]);
+            }
+        }
+        state0 = _mm_add_epi32(state0, abef);
+        state1 = _mm_add_epi32(state1, cdgh);
+    }
+
+    tmp = _mm_shuffle_epi32(state0, 0x1b);
+    state1 = _mm_shuffle_epi32(state1, 0xb1);
+    state0 = _mm_blend_epi16(tmp, state1, 0xf0);
+    state1 = _mm_alignr_epi8(state1, tmp, 8);
+    _mm_storeu_si128((__m128i *)&state[0], state0);
+    _mm_storeu_si128((__m128i *)&state[4], state1);
+}
+#endif
+
+#if SHA256_HW_ARM
+/* SHA-256 using the ARMv8 cryptographic extension */
+static void _transform_armv8(uint32_t *state, const unsigned char *data,
+                             size_t blocks)
+{
+    uint32x4_t state0 = vld1q_u32(&state[0]);
+    uint32x4_t state1 = vld1q_u32(&state[4]);
+
+    for (; blocks; blocks--, data += 64) {
+        uint32x4_t abcd = state0, efgh = state1;
+        uint32x4_t msg[4];
+
+        for (unsigned i = 0; i < 4; i++) {
+            msg[i] = vreinterpretq_u32_u8(vrev32q_u8(vld1q_u8(data + 16 * i)));
+        }
+        /* four rounds per iteration, the message schedule is expanded
+         * in place for the rounds four iterations ahead */
+        for (unsigned i = 0; i < 16; i++) {
+            uint32x4_t w = vaddq_u32(msg[i & 3], vld1q_u32(&K[4 * i]));
+            uint32x4_t tmp = state0;
+
+            if (i < 12) {
+                msg[i & 3] = vsha256su0q_u32(msg[i & 3], msg[(i + 1) & 3]);
+            }
+            state0 = vsha256hq_u32(state0, state1, w);
+            state1 = vsha256h2q_u32(state1, tmp, w);
+            if (i < 12) {
+                msg[i & 3] = vsha256su1q_u32(msg[i & 3], msg[(i + 2) & 3],
+                                             msg[(i + 3) & 3]);
+            }
+        }
+        state0 = vaddq_u32(state0, abcd);
+        state1 = vaddq_u32(state1, efgh);
+    }
+
+    vst1q_u32(&state[0], state0);
+    vst1q_u32(&state[4], state1);
+}
+#endif
+
+/* Process a number of complete blocks */
+static void sha2xx_transform_blocks(uint32_t *state, const unsigned char *data,
+                                    size_t blocks)
+{
+#if SHA256_HW_X86
+    if (_sha_ni_supported()) {
+        _transform_sha_ni(state, data, blocks);
+        return;
+    }
+#elif SHA256_HW_ARM
+    _transform_armv8(state, data, blocks);
+    return;
+#endif
+
+    for (; blocks; blocks--, data += 64) {
+        sha2xx_transform(state, data);
+    }
+}
 
 static const unsigned char PAD[64] = {
     0x80, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
@@ -226,16 +419,14 @@ void sha2xx_update(sha2xx_context_t *ctx, const void *data, size_t len)
     const unsigned char *src = data;
 
     memcpy(&ctx->buf[r], src, f);
-    sha2xx_transform(ctx->state, ctx->buf);
+    sha2xx_transform_blocks(ctx->state, ctx->buf, 1);
     src += f;
     len -= f;
 
     /* Perform complete blocks */
-    while (len >= 64) {
-        sha2xx_transform(ctx->state, src);
-        src += 64;
-        len -= 64;
-    }
+    sha2xx_transform_blocks(ctx->state, src, len / 64);
+    src += len & ~0x3f;
+    len &= 0x3f;
 
     /* Copy left over data into buffer */
     memcpy(ctx->buf, src, len);
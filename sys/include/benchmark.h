@@ -10,6 +10,25 @@
  * @defgroup    sys_benchmark Benchmark
  * @ingroup     sys
  * @brief       Framework for running simple runtime benchmarks
+ *
+ * @ref BENCHMARK_FUNC measures a number of calls once. @ref BENCHMARK_RUN
+ * measures them @ref CONFIG_BENCHMARK_SAMPLES times after
+ * @ref CONFIG_BENCHMARK_WARMUP runs that are not recorded, and reports the
+ * minimum, median, 99th percentile, maximum and mean time per call.
+ *
+ * Where a cycle counter is available (@ref BENCHMARK_HAS_CYCLES), cycles per
+ * call are reported as well: the DWT cycle counter on Cortex-M3 and up, the
+ * time stamp counter on native on x86.
+ *
+ * Results are printed as text by default. For tracking them automatically,
+ * one of the following modules selects a machine readable format instead:
+ *
+ * - `benchmark_json`: one JSON object per result and line
+ * - `benchmark_csv`: a header line, then one line per result
+ *
+ * Applications in `tests/bench` select JSON by default, `BENCHMARK_FORMAT=csv`
+ * selects CSV.
+ *
  * @{
  *
  * @file
@@ -21,15 +40,111 @@
 #ifndef BENCHMARK_H
 #define BENCHMARK_H
 
+#include <stdbool.h>
 #include <stdint.h>
 
 #include "irq.h"
+#include "ztimer.h"
 #include "ztimer/stopwatch.h"
 
+#if defined(CPU_CORE_CORTEX_M3) || defined(CPU_CORE_CORTEX_M33) || \
+    defined(CPU_CORE_CORTEX_M4) || defined(CPU_CORE_CORTEX_M4F) || \
+    defined(CPU_CORE_CORTEX_M7)
+#include "cpu.h"
+#endif
+
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+/**
+ * @brief   Runs before measuring, to fill caches and to settle the system
+ */
+#ifndef CONFIG_BENCHMARK_WARMUP
+#define CONFIG_BENCHMARK_WARMUP     1
+#endif
+
+/**
+ * @brief   Measurements taken by @ref BENCHMARK_RUN
+ */
+#ifndef CONFIG_BENCHMARK_SAMPLES
+#define CONFIG_BENCHMARK_SAMPLES    100
+#endif
+
+/**
+ * @brief   Set to 1 if a cycle counter is available
+ */
+#if defined(DOXYGEN)
+#define BENCHMARK_HAS_CYCLES        1
+#elif defined(CPU_NATIVE) && (defined(__x86_64__) || defined(__i386__))
+#define BENCHMARK_HAS_CYCLES        1
+#elif defined(DWT_CTRL_CYCCNTENA_Msk)
+#define BENCHMARK_HAS_CYCLES        1
+#else
+#define BENCHMARK_HAS_CYCLES        0
+#endif
+
+/**
+ * @brief   Statistics of a benchmark
+ */
+typedef struct {
+    int32_t min;                /**< minimum */
+    int32_t median;             /**< median */
+    int32_t p99;                /**< 99th percentile */
+    int32_t max;                /**< maximum */
+    int32_t mean;               /**< mean */
+} benchmark_stats_t;
+
+/**
+ * @brief   Result of a benchmark
+ */
+typedef struct {
+    const char *name;           /**< name of the benchmark */
+    const char *unit;           /**< unit of @p time, e.g. "ns" */
+    unsigned long runs;         /**< calls per sample */
+    unsigned samples;           /**< number of samples */
+    benchmark_stats_t time;     /**< time (or other value) per call */
+    benchmark_stats_t cycles;   /**< cycles per call */
+    bool has_cycles;            /**< true if @p cycles is valid */
+} benchmark_result_t;
+
+/**
+ * @brief   Time stamp of the benchmark clocks
+ */
+typedef struct {
+    uint32_t us;                /**< time in µs */
+    uint32_t cycles;            /**< cycle counter */
+} benchmark_stamp_t;
+
+/**
+ * @brief   Read the cycle counter
+ *
+ * The counter wraps around, differences are valid for at least a second.
+ *
+ * @return  cycle counter, 0 if there is none
+ */
+static inline uint32_t benchmark_cycles(void)
+{
+#if defined(CPU_NATIVE) && (defined(__x86_64__) || defined(__i386__))
+    return (uint32_t)__builtin_ia32_rdtsc();
+#elif BENCHMARK_HAS_CYCLES
+    return DWT->CYCCNT;
+#else
+    return 0;
+#endif
+}
+
+/**
+ * @brief   Take a time stamp
+ *
+ * @param[out]  stamp   time stamp
+ */
+static inline void benchmark_stamp(benchmark_stamp_t *stamp)
+{
+    stamp->us = ztimer_now(ZTIMER_USEC);
+    stamp->cycles = benchmark_cycles();
+}
+
 /**
  * @brief   Measure the runtime of a given function call
  *
@@ -52,6 +167,36 @@ extern "C" {
         ztimer_stopwatch_stop(&timer);                          \
     } while (0)
 
+/**
+ * @brief   Measure the runtime of a given function call repeatedly
+ *
+ * Runs @p func @p runs times per sample, for @ref CONFIG_BENCHMARK_WARMUP
+ * samples that are discarded and @ref CONFIG_BENCHMARK_SAMPLES samples that
+ * are recorded, then prints the statistics of the time per call.
+ *
+ * @p runs should be chosen so that a sample takes at least a few hundred µs,
+ * as the time is measured with a µs resolution.
+ *
+ * @param[in] name      name for labeling the output
+ * @param[in] runs      number of times to run @p func per sample
+ * @param[in] func      function call to benchmark
+ */
+#define BENCHMARK_RUN(name, runs, func)                                     \
+    do {                                                                    \
+        benchmark_begin();                                                  \
+        for (unsigned _rep = 0;                                             \
+             _rep < CONFIG_BENCHMARK_WARMUP + CONFIG_BENCHMARK_SAMPLES;     \
+             _rep++) {                                                      \
+            benchmark_stamp_t _start;                                       \
+            benchmark_stamp(&_start);                                       \
+            for (unsigned long i = 0; i < runs; i++) {                      \
+                func;                                                       \
+            }                                                               \
+            benchmark_sample(_rep, &_start);                                \
+        }                                                                   \
+        benchmark_end(name, runs);                                          \
+    } while (0)
+
 /**
  * @brief   Output the given time as well as the time per run on STDIO
  *
@@ -61,6 +206,58 @@ extern "C" {
  */
 void benchmark_print_time(uint32_t time, unsigned long runs, const char *name);
 
+/**
+ * @brief   Output a single value that is not a time, e.g. a size
+ *
+ * @param[in] name      name to label the output
+ * @param[in] unit      unit of @p value
+ * @param[in] value     value
+ */
+void benchmark_print_value(const char *name, const char *unit, int32_t value);
+
+/**
+ * @brief   Output a benchmark result in the selected format
+ *
+ * @param[in] res       result to print
+ */
+void benchmark_print_result(const benchmark_result_t *res);
+
+/**
+ * @brief   Calculate the statistics of a set of values
+ *
+ * @param[out]    stats     statistics
+ * @param[in,out] values    values, sorted on return
+ * @param[in]     n         number of values, must not be 0
+ */
+void benchmark_stats(benchmark_stats_t *stats, int32_t *values, unsigned n);
+
+/**
+ * @brief   Prepare the clocks for @ref BENCHMARK_RUN
+ *
+ * @internal
+ */
+void benchmark_begin(void);
+
+/**
+ * @brief   Record a sample of @ref BENCHMARK_RUN
+ *
+ * @internal
+ *
+ * @param[in] rep       number of the sample, including warmup runs
+ * @param[in] start     time stamp at the start of the sample
+ */
+void benchmark_sample(unsigned rep, const benchmark_stamp_t *start);
+
+/**
+ * @brief   Print the result of @ref BENCHMARK_RUN
+ *
+ * @internal
+ *
+ * @param[in] name      name to label the output
+ * @param[in] runs      calls per sample
+ */
+void benchmark_end(const char *name, unsigned long runs);
+
 #ifdef __cplusplus
 }
 #endif
@@ -34,6 +34,10 @@ extern "C" {
  *
  * @note enable the `crc32_fast` module for a look-up table based implementation
  *       that trades code size for speed.
+ *       The `crc32_slice4` and `crc32_slice8` modules process 4 or 8 bytes
+ *       at a time with 3 KiB or 7 KiB of additional tables.
+ *       The `crc32_hw` module uses the CRC32 instructions of ARMv8 or the
+ *       carry-less multiplication of x86 CPUs with PCLMULQDQ, if available.
  *
  * @param[in] buf   The data to checksum
  * @param[in] size  Length of the data in bytes
@@ -105,6 +105,28 @@ int aes_init(cipher_context_t *context, const uint8_t *key, uint8_t keySize);
 int aes_encrypt(const cipher_context_t *context, const uint8_t *plain_block,
                 uint8_t *cipher_block);
 
+/**
+ * @brief   encrypts several consecutive plain-blocks in ECB fashion
+ *
+ * The key schedule is expanded only once for all blocks, which makes this
+ * considerably cheaper than calling @ref aes_encrypt for each block. With
+ * the `crypto_aes_hw` module, the blocks are processed with the AES
+ * instructions of the CPU if available.
+ *
+ * @param       context       the cipher_context_t-struct to use for this
+ *                            encryption
+ * @param       plain         the plaintext of @p blocks blocks
+ * @param       cipher        where to store the ciphertext of @p blocks
+ *                            blocks, may be equal to @p plain
+ * @param       blocks        number of blocks to encrypt
+ *
+ * @return  1 on success
+ * @return  A negative value if the cipher key cannot be expanded with the
+ *          AES key schedule
+ */
+int aes_encrypt_blocks(const cipher_context_t *context, const uint8_t *plain,
+                       uint8_t *cipher, size_t blocks);
+
 /**
  * @brief   decrypts one cipher-block and saves the plain-block in plainBlock.
  *          decrypts one blocksize long block of ciphertext pointed to by
@@ -22,6 +22,7 @@
 #ifndef CRYPTO_CIPHERS_H
 #define CRYPTO_CIPHERS_H
 
+#include <stddef.h>
 #include <stdint.h>
 #include "modules.h"
 
@@ -102,6 +103,15 @@ typedef struct cipher_interface_st {
     /** @brief the decrypt function */
     int (*decrypt)(const cipher_context_t *ctx, const uint8_t *cipher_block,
                    uint8_t *plain_block);
+
+    /**
+     * @brief encrypt several consecutive blocks at once (optional)
+     *
+     * May be NULL, in which case @ref cipher_encrypt_blocks falls back to
+     * calling @ref cipher_interface_st::encrypt for each block.
+     */
+    int (*encrypt_blocks)(const cipher_context_t *ctx, const uint8_t *plain,
+                          uint8_t *cipher, size_t blocks);
 } cipher_interface_t;
 
 /** Pointer type to BlockCipher-Interface for the Cipher-Algorithms */
@@ -157,6 +167,25 @@ int cipher_init(cipher_t *cipher, cipher_id_t cipher_id, const uint8_t *key,
 int cipher_encrypt(const cipher_t *cipher, const uint8_t *input,
                    uint8_t *output);
 
+/**
+ * @brief Encrypt several consecutive blocks of BLOCK_SIZE length
+ *
+ * This is equivalent to calling @ref cipher_encrypt for each block, but
+ * allows the cipher to set up its key schedule only once and to process
+ * multiple blocks in parallel.
+ *
+ * @param cipher     Already initialized cipher struct
+ * @param input      pointer to @p blocks blocks of input data
+ * @param output     pointer to allocated memory for @p blocks blocks of
+ *                   encrypted data, may be equal to @p input
+ * @param blocks     number of blocks to encrypt
+ *
+ * @return           1 in case of success
+ * @return           A negative value for an error
+ */
+int cipher_encrypt_blocks(const cipher_t *cipher, const uint8_t *input,
+                          uint8_t *output, size_t blocks);
+
 /**
  * @brief Decrypt data of BLOCK_SIZE length
  * *
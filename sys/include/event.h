@@ -120,6 +120,19 @@ extern "C" {
 #define THREAD_FLAG_EVENT   (0x1)
 #endif
 
+/**
+ * @brief   Maximum number of events handled from one queue in a row
+ *
+ * After waking up, @ref event_loop_multi handles up to this many events of
+ * the queue it took the first event from, before it checks the queues of
+ * higher priority again. With a single queue this only saves the repeated
+ * checks, with multiple queues it trades latency of the higher priority
+ * queues for throughput of bursts on the lower priority ones.
+ */
+#ifndef CONFIG_EVENT_LOOP_BATCH_BUDGET
+#define CONFIG_EVENT_LOOP_BATCH_BUDGET      1
+#endif
+
 /**
  * @brief   event_queue_t static initializer
  */
@@ -148,12 +161,31 @@ struct event {
     event_handler_t handler;    /**< pointer to event handler function  */
 };
 
+/**
+ * @brief   event queue statistics
+ *
+ * Available with the `event_stats` module. The handler runtime is only
+ * accounted for events handled by @ref event_loop_multi and
+ * @ref event_loop.
+ */
+typedef struct {
+    uint16_t depth;             /**< number of currently queued events  */
+    uint16_t depth_max;         /**< high-water mark of @ref depth      */
+    uint32_t handled;           /**< number of events handled           */
+    uint32_t runtime_us;        /**< accumulated handler runtime in us  */
+    uint32_t runtime_max_us;    /**< runtime of the slowest handler     */
+    event_handler_t slowest;    /**< handler that took the longest      */
+} event_queue_stats_t;
+
 /**
  * @brief   event queue structure
  */
 typedef struct PTRTAG {
     clist_node_t event_list;    /**< list of queued events              */
     thread_t *waiter;           /**< thread owning event queue          */
+#if IS_USED(MODULE_EVENT_STATS) || defined(DOXYGEN)
+    event_queue_stats_t stats;  /**< queue statistics                   */
+#endif
 } event_queue_t;
 
 /**
@@ -430,32 +462,13 @@ event_t *event_wait_timeout_ztimer(event_queue_t *queue,
  * @note    Enable the `event_loop_debug` module to print the execution times of
  *          the event handler functions.
  *
+ * @note    Once woken up, up to @ref CONFIG_EVENT_LOOP_BATCH_BUDGET events of
+ *          the same queue are handled before the other queues are checked.
+ *
  * @param[in]   queues      Event queues to process
  * @param[in]   n_queues    Number of queues passed with @p queues
  */
-static inline void event_loop_multi(event_queue_t *queues, size_t n_queues)
-{
-    event_t *event;
-
-    while ((event = event_wait_multi(queues, n_queues))) {
-        if (IS_USED(MODULE_EVENT_LOOP_DEBUG)) {
-            uint32_t now;
-            ztimer_acquire(ZTIMER_USEC);
-            printf("event: executing %p->%p\n",
-                   (void *)event, (void *)(uintptr_t)event->handler);
-            now = ztimer_now(ZTIMER_USEC);
-
-            event->handler(event);
-
-            printf("event: %p took %" PRIu32 " µs\n",
-                   (void *)event, ztimer_now(ZTIMER_USEC) - now);
-            ztimer_release(ZTIMER_USEC);
-        }
-        else {
-            event->handler(event);
-        }
-    }
-}
+void event_loop_multi(event_queue_t *queues, size_t n_queues);
 
 /**
  * @brief   Simple event loop
@@ -33,6 +33,13 @@
  * @defgroup    sys_hashes_sha256 SHA-256
  * @ingroup     sys_hashes_unkeyed
  * @brief       Implementation of the SHA-256 hashing function
+ *
+ * The portable implementation is optimized for size. The `sha256_fast`
+ * module selects an unrolled implementation that is about twice as large
+ * and faster. The `sha256_hw` module additionally uses the SHA extensions of
+ * x86 CPUs, detected at run time, or the ARMv8 cryptographic extension, if
+ * enabled for the target. Both apply to SHA-224 as well.
+ *
  * @{
  *
  * @file
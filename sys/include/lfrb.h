@@ -0,0 +1,283 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    sys_lfrb Lock-free ringbuffers
+ * @ingroup     sys
+ * @brief       Lock-free ringbuffers of fixed size elements
+ *
+ * Unlike @ref sys_tsrb, these ringbuffers do not disable interrupts and store
+ * elements of any size. Several elements are added or taken at once with at
+ * most two `memcpy()` calls.
+ *
+ * There are two variants:
+ *
+ * - @ref lfrb_t for a single producer and a single consumer, e.g. an ISR
+ *   receiving data and a thread handling it. Both sides only read the counter
+ *   of the other side and write their own, with @ref sys_atomic_utils.
+ * - @ref lfrb_mpmc_t for any number of producers and consumers. It uses C11
+ *   atomic compare and swap, which is implemented by disabling interrupts on
+ *   CPUs without such an instruction. Every element has a sequence number
+ *   telling whether it is ready to be written or read, so a producer or
+ *   consumer that is preempted in the middle of an operation does not block
+ *   the others: they see the buffer full or empty at that element instead.
+ *
+ * The number of elements must be a power of two.
+ *
+ * @{
+ *
+ * @file
+ * @brief       Lock-free ringbuffer interface definition
+ */
+
+#ifndef LFRB_H
+#define LFRB_H
+
+#include <assert.h>
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "atomic_utils.h"
+#include "container.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Single producer, single consumer ringbuffer
+ */
+typedef struct {
+    uint8_t *buf;               /**< buffer of @p size elements */
+    uint16_t size;              /**< number of elements, power of two */
+    uint16_t elem_size;         /**< size of an element in bytes */
+    uint32_t reads;             /**< elements read, written by the consumer */
+    uint32_t writes;            /**< elements written, written by the producer */
+} lfrb_t;
+
+/**
+ * @brief   Static initializer
+ *
+ * @param[in] BUF   array of elements, the number of elements must be a power
+ *                  of two
+ */
+#define LFRB_INIT(BUF) \
+    { (uint8_t *)(BUF), ARRAY_SIZE(BUF), sizeof((BUF)[0]), 0, 0 }
+
+/**
+ * @brief   Initialize a ringbuffer
+ *
+ * @param[out]  rb          ringbuffer to initialize
+ * @param[in]   buf         buffer of @p size elements
+ * @param[in]   size        number of elements, must be a power of two
+ * @param[in]   elem_size   size of an element in bytes
+ */
+static inline void lfrb_init(lfrb_t *rb, void *buf, uint16_t size,
+                             uint16_t elem_size)
+{
+    assert((size != 0) && ((size & (size - 1)) == 0));
+
+    rb->buf = buf;
+    rb->size = size;
+    rb->elem_size = elem_size;
+    rb->reads = 0;
+    rb->writes = 0;
+}
+
+/**
+ * @brief   Get the number of elements that can be read
+ *
+ * Exact when called by the consumer, the producer may add more at any time.
+ *
+ * @param[in]   rb      ringbuffer
+ *
+ * @return  number of elements in the ringbuffer
+ */
+static inline unsigned lfrb_avail(const lfrb_t *rb)
+{
+    return atomic_load_u32(&rb->writes) - atomic_load_u32(&rb->reads);
+}
+
+/**
+ * @brief   Get the number of elements that can be added
+ *
+ * Exact when called by the producer, the consumer may take more at any time.
+ *
+ * @param[in]   rb      ringbuffer
+ *
+ * @return  number of free elements in the ringbuffer
+ */
+static inline unsigned lfrb_free(const lfrb_t *rb)
+{
+    return rb->size - lfrb_avail(rb);
+}
+
+/**
+ * @brief   Check if the ringbuffer is empty
+ *
+ * @param[in]   rb      ringbuffer
+ */
+static inline bool lfrb_empty(const lfrb_t *rb)
+{
+    return lfrb_avail(rb) == 0;
+}
+
+/**
+ * @brief   Check if the ringbuffer is full
+ *
+ * @param[in]   rb      ringbuffer
+ */
+static inline bool lfrb_full(const lfrb_t *rb)
+{
+    return lfrb_avail(rb) == rb->size;
+}
+
+/**
+ * @brief   Add elements, may only be called by the producer
+ *
+ * @param[in]   rb      ringbuffer
+ * @param[in]   src     elements to add
+ * @param[in]   n       number of elements in @p src
+ *
+ * @return  number of elements added, less than @p n if the buffer is full
+ */
+unsigned lfrb_add(lfrb_t *rb, const void *src, unsigned n);
+
+/**
+ * @brief   Take elements, may only be called by the consumer
+ *
+ * @param[in]   rb      ringbuffer
+ * @param[out]  dst     buffer for up to @p n elements
+ * @param[in]   n       number of elements to take
+ *
+ * @return  number of elements taken, less than @p n if the buffer is empty
+ */
+unsigned lfrb_get(lfrb_t *rb, void *dst, unsigned n);
+
+/**
+ * @brief   Copy elements without taking them, may only be called by the
+ *          consumer
+ *
+ * @param[in]   rb      ringbuffer
+ * @param[out]  dst     buffer for up to @p n elements
+ * @param[in]   n       number of elements to copy
+ *
+ * @return  number of elements copied
+ */
+unsigned lfrb_peek(const lfrb_t *rb, void *dst, unsigned n);
+
+/**
+ * @brief   Drop elements, may only be called by the consumer
+ *
+ * @param[in]   rb      ringbuffer
+ * @param[in]   n       number of elements to drop
+ *
+ * @return  number of elements dropped
+ */
+unsigned lfrb_drop(lfrb_t *rb, unsigned n);
+
+/**
+ * @brief   Add a single element, may only be called by the producer
+ *
+ * @param[in]   rb      ringbuffer
+ * @param[in]   elem    element to add
+ *
+ * @return  0 on success
+ * @return  -1 if the buffer is full
+ */
+static inline int lfrb_add_one(lfrb_t *rb, const void *elem)
+{
+    return lfrb_add(rb, elem, 1) ? 0 : -1;
+}
+
+/**
+ * @brief   Take a single element, may only be called by the consumer
+ *
+ * @param[in]   rb      ringbuffer
+ * @param[out]  elem    buffer for the element
+ *
+ * @return  0 on success
+ * @return  -1 if the buffer is empty
+ */
+static inline int lfrb_get_one(lfrb_t *rb, void *elem)
+{
+    return lfrb_get(rb, elem, 1) ? 0 : -1;
+}
+
+/**
+ * @brief   Multi producer, multi consumer ringbuffer
+ */
+typedef struct {
+    uint8_t *buf;               /**< buffer of @p size elements */
+    atomic_uint *seq;           /**< sequence numbers of the elements */
+    uint16_t size;              /**< number of elements, power of two */
+    uint16_t elem_size;         /**< size of an element in bytes */
+    atomic_uint head;           /**< position of the next element to read */
+    atomic_uint tail;           /**< position of the next element to write */
+} lfrb_mpmc_t;
+
+/**
+ * @brief   Initialize a multi producer, multi consumer ringbuffer
+ *
+ * @param[out]  rb          ringbuffer to initialize
+ * @param[in]   buf         buffer of @p size elements
+ * @param[in]   seq         buffer of @p size sequence numbers
+ * @param[in]   size        number of elements, must be a power of two
+ * @param[in]   elem_size   size of an element in bytes
+ */
+void lfrb_mpmc_init(lfrb_mpmc_t *rb, void *buf, atomic_uint *seq,
+                    uint16_t size, uint16_t elem_size);
+
+/**
+ * @brief   Add elements
+ *
+ * The elements are added in one piece, they are not interleaved with
+ * elements of other producers.
+ *
+ * @param[in]   rb      ringbuffer
+ * @param[in]   src     elements to add
+ * @param[in]   n       number of elements in @p src
+ *
+ * @return  number of elements added, less than @p n if the buffer is full
+ */
+unsigned lfrb_mpmc_add(lfrb_mpmc_t *rb, const void *src, unsigned n);
+
+/**
+ * @brief   Take elements
+ *
+ * @param[in]   rb      ringbuffer
+ * @param[out]  dst     buffer for up to @p n elements
+ * @param[in]   n       number of elements to take
+ *
+ * @return  number of elements taken, less than @p n if the buffer is empty
+ */
+unsigned lfrb_mpmc_get(lfrb_mpmc_t *rb, void *dst, unsigned n);
+
+/**
+ * @brief   Get the number of elements in the ringbuffer
+ *
+ * Only a snapshot, other threads may add or take elements at any time.
+ *
+ * @param[in]   rb      ringbuffer
+ */
+static inline unsigned lfrb_mpmc_avail(lfrb_mpmc_t *rb)
+{
+    unsigned head = atomic_load_explicit(&rb->head, memory_order_relaxed);
+    unsigned tail = atomic_load_explicit(&rb->tail, memory_order_relaxed);
+
+    return tail - head;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LFRB_H */
+/** @} */
@@ -0,0 +1,133 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    sys_mutex_profiling Mutex contention profiling
+ * @ingroup     sys
+ * @brief       Records wait and hold times of contended mutexes
+ *
+ * When the `mutex_profiling` module is used, every mutex that a thread has
+ * to wait for gets an entry in a table of @ref CONFIG_MUTEX_PROFILING_NUMOF
+ * entries. From then on, each acquisition of that mutex is recorded with the
+ * time spent waiting for it, the time it was held and the address of the
+ * code that locked it. The table can be printed with
+ * @ref mutex_profiling_print or the `mutexprof` shell command.
+ *
+ * Mutexes that are never contended do not take up entries, so the table
+ * shows the hot ones. Mutexes used for signalling, e.g. the one a thread
+ * blocks on in `ztimer_sleep()`, show up as well. Times are measured with
+ * ZTIMER_USEC, recording starts once ztimer is initialized.
+ *
+ * @{
+ *
+ * @file
+ * @brief       Mutex contention profiling
+ */
+
+#ifndef MUTEX_PROFILING_H
+#define MUTEX_PROFILING_H
+
+#include <stdint.h>
+
+#include "architecture.h"
+#include "mutex.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Maximum number of contended mutexes to keep track of
+ */
+#ifndef CONFIG_MUTEX_PROFILING_NUMOF
+#define CONFIG_MUTEX_PROFILING_NUMOF    16
+#endif
+
+/**
+ * @brief   Profile of a contended mutex
+ *
+ * Counts and times cover the acquisitions since the first contention.
+ */
+typedef struct {
+    const mutex_t *mutex;       /**< the mutex, NULL if entry is unused  */
+    uint32_t locks;             /**< number of acquisitions              */
+    uint32_t contended;         /**< acquisitions that had to wait       */
+    uint32_t wait_us;           /**< total time spent waiting            */
+    uint32_t wait_max_us;       /**< longest wait                        */
+    uinttxtptr_t wait_max_pc;   /**< caller that waited the longest      */
+    uint32_t hold_us;           /**< total time the mutex was held       */
+    uint32_t hold_max_us;       /**< longest time the mutex was held     */
+    uinttxtptr_t hold_max_pc;   /**< caller that held it the longest     */
+    uint32_t locked_at;         /**< time of the current acquisition     */
+    uinttxtptr_t owner_pc;      /**< caller of the current acquisition   */
+} mutex_profile_t;
+
+/**
+ * @brief   Start recording, called by auto_init after ztimer is ready
+ */
+void mutex_profiling_init(void);
+
+/**
+ * @brief   Get the current time of the profiling clock
+ *
+ * @return  time stamp to pass to @ref mutex_profiling_contended
+ */
+uint32_t mutex_profiling_now(void);
+
+/**
+ * @brief   Record an uncontended acquisition, called by the mutex code
+ *
+ * @param[in]   mutex   the acquired mutex
+ * @param[in]   pc      address of the caller of mutex_lock()
+ */
+void mutex_profiling_acquired(const mutex_t *mutex, uinttxtptr_t pc);
+
+/**
+ * @brief   Record a contended acquisition, called by the mutex code
+ *
+ * @param[in]   mutex   the acquired mutex
+ * @param[in]   pc      address of the caller of mutex_lock()
+ * @param[in]   since   time stamp of when the caller started waiting
+ */
+void mutex_profiling_contended(const mutex_t *mutex, uinttxtptr_t pc,
+                               uint32_t since);
+
+/**
+ * @brief   Record the release of a mutex, called by the mutex code
+ *
+ * @param[in]   mutex   the released mutex
+ */
+void mutex_profiling_released(const mutex_t *mutex);
+
+/**
+ * @brief   Get a copy of the profile of a mutex
+ *
+ * @param[in]   mutex   the mutex to look up
+ * @param[out]  profile where to store the profile
+ *
+ * @retval  0       @p profile is valid
+ * @retval  -ENOENT @p mutex was never contended since the last reset
+ */
+int mutex_profiling_get(const mutex_t *mutex, mutex_profile_t *profile);
+
+/**
+ * @brief   Clear all entries of the profile table
+ */
+void mutex_profiling_reset(void);
+
+/**
+ * @brief   Print the profile table
+ */
+void mutex_profiling_print(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MUTEX_PROFILING_H */
+/** @} */
@@ -150,6 +150,19 @@ extern "C" {
 #define CONFIG_GNRC_IPV6_MSG_QUEUE_SIZE_EXP    (3U)
 #endif
 
+/**
+ * @brief   Number of bulk data messages the IPv6 thread holds back in favor
+ *          of control traffic (as exponent of 2^n).
+ *
+ * @note    Only used with module `gnrc_ipv6_prio_lane`.
+ *
+ * As the queue size ALWAYS needs to be power of two, this option represents
+ * the exponent of 2^n, which will be used as the size of the queue.
+ */
+#ifndef CONFIG_GNRC_IPV6_BULK_QUEUE_SIZE_EXP
+#define CONFIG_GNRC_IPV6_BULK_QUEUE_SIZE_EXP    (3U)
+#endif
+
 #ifdef DOXYGEN
 /**
  * @brief   Add a static IPv6 link local address to any network interface
@@ -214,6 +227,13 @@ extern "C" {
 #define GNRC_IPV6_MSG_QUEUE_SIZE    (1 << CONFIG_GNRC_IPV6_MSG_QUEUE_SIZE_EXP)
 #endif
 
+/**
+ * @brief Number of bulk data messages the IPv6 thread holds back.
+ */
+#ifndef GNRC_IPV6_BULK_QUEUE_SIZE
+#define GNRC_IPV6_BULK_QUEUE_SIZE   (1 << CONFIG_GNRC_IPV6_BULK_QUEUE_SIZE_EXP)
+#endif
+
 /**
  * @brief   The PID to the IPv6 thread.
  *
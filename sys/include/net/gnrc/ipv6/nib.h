@@ -358,6 +358,35 @@ int gnrc_ipv6_nib_get_next_hop_l2addr(const ipv6_addr_t *dst,
                                       gnrc_netif_t *netif, gnrc_pktsnip_t *pkt,
                                       gnrc_ipv6_nib_nc_t *nce);
 
+/**
+ * @brief   Gets link-layer address of next hop to a destination address
+ *          without changing the state of the NIB
+ *
+ * Unlike @ref gnrc_ipv6_nib_get_next_hop_l2addr() this function neither
+ * starts address resolution, queues packets, triggers route requests nor
+ * changes the NUD state of the next hop. It only succeeds if the next hop is
+ * already known to be reachable, so callers can fall back to the regular
+ * path on any error.
+ *
+ * Like @ref gnrc_ipv6_nib_get_next_hop_l2addr(), it notifies the route info
+ * callback of the interface (see @ref gnrc_netif_ipv6_t::route_info_cb) with
+ * @ref GNRC_IPV6_NIB_ROUTE_INFO_TYPE_RN when an off-link destination was
+ * found via a route, so routing protocols see the route in use.
+ *
+ * @pre `(dst != NULL) && (nce != NULL)`
+ *
+ * @note    Only available with module `gnrc_netif_ipv6_fastfwd`.
+ *
+ * @param[in] dst       Destination address of a packet.
+ * @param[out] nce      The neighbor cache entry of the next hop to @p dst.
+ *
+ * @return  0, on success.
+ * @return  -ENETUNREACH if there is no route to host.
+ * @return  -EHOSTUNREACH if the next hop is not known to be reachable.
+ */
+int gnrc_ipv6_nib_get_next_hop_l2addr_cached(const ipv6_addr_t *dst,
+                                             gnrc_ipv6_nib_nc_t *nce);
+
 /**
  * @brief   Handles a received ICMPv6 packet
  *
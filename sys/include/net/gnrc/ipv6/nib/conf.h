@@ -303,6 +303,47 @@ extern "C" {
 #define CONFIG_GNRC_IPV6_NIB_OFFL_NUMOF              (8)
 #endif
 
+/**
+ * @brief   Number of hash buckets to look up off-link entries by prefix
+ *
+ * With the default of 0 adding or replacing a forwarding table or prefix list
+ * entry compares the prefix of every off-link entry. Otherwise entries are
+ * also indexed by their prefix in a hash table with this many buckets. This
+ * costs two bytes per off-link entry and per bucket.
+ *
+ * @note    Longest-prefix matching when forwarding is not affected.
+ */
+#ifndef CONFIG_GNRC_IPV6_NIB_OFFL_HASH_BUCKETS
+#define CONFIG_GNRC_IPV6_NIB_OFFL_HASH_BUCKETS       (0)
+#endif
+
+/**
+ * @brief   Number of slots of the timer wheel for forwarding table lifetimes
+ *
+ * With the default of 0 every forwarding table entry with a finite lifetime
+ * is expired by its own event timer, so adding or refreshing a route is linear
+ * in the number of pending timers. Otherwise, the lifetimes are tracked in a
+ * hashed timer wheel with this many slots, advancing every
+ * @ref CONFIG_GNRC_IPV6_NIB_ROUTE_WHEEL_TICK_MS. This makes route updates
+ * constant-time, which pays off for large forwarding tables, e.g. on RPL
+ * storing-mode roots.
+ *
+ * @note    Only applicable with @ref CONFIG_GNRC_IPV6_NIB_ROUTER.
+ */
+#ifndef CONFIG_GNRC_IPV6_NIB_ROUTE_WHEEL_SLOTS
+#define CONFIG_GNRC_IPV6_NIB_ROUTE_WHEEL_SLOTS       (0)
+#endif
+
+/**
+ * @brief   Tick of the forwarding table lifetime timer wheel in milliseconds
+ *
+ * Routes expire at most one tick later than their lifetime, but never
+ * earlier.
+ */
+#ifndef CONFIG_GNRC_IPV6_NIB_ROUTE_WHEEL_TICK_MS
+#define CONFIG_GNRC_IPV6_NIB_ROUTE_WHEEL_TICK_MS     (1000U)
+#endif
+
 #if CONFIG_GNRC_IPV6_NIB_MULTIHOP_P6C || defined(DOXYGEN)
 /**
  * @brief   Number of authoritative border router entries in NIB
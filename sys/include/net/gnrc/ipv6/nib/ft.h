@@ -83,6 +83,32 @@ int gnrc_ipv6_nib_ft_add(const ipv6_addr_t *dst, unsigned dst_len,
                          const ipv6_addr_t *next_hop, unsigned iface,
                          uint32_t lifetime);
 
+/**
+ * @brief   Adds a route to the forwarding table, replacing all existing routes
+ *          to the same destination
+ *
+ * Equivalent to gnrc_ipv6_nib_ft_del() followed by gnrc_ipv6_nib_ft_add(),
+ * but an existing route via @p next_hop on @p iface is updated in place. This
+ * is e.g. used by routing protocols to refresh routes.
+ *
+ * @param[in] dst       The destination to the route. May be NULL or `::` for
+ *                      default route.
+ * @param[in] dst_len   The prefix length of @p dst in bits. May be 0 for
+ *                      default route.
+ * @param[in] next_hop  The next hop to @p dst/@p dst_len. May be NULL, if
+ *                      @p dst/@p dst_len is no the default route.
+ * @param[in] iface     The interface to @p next_hop. May not be 0.
+ * @param[in] lifetime  Lifetime of the route in seconds. 0 for infinite
+ *                      lifetime.
+ *
+ * @return  0, on success.
+ * @return  -EINVAL, if a parameter was of invalid value.
+ * @return  -ENOMEM, if there was no space left in forwarding table.
+ */
+int gnrc_ipv6_nib_ft_replace(const ipv6_addr_t *dst, unsigned dst_len,
+                             const ipv6_addr_t *next_hop, unsigned iface,
+                             uint32_t lifetime);
+
 /**
  * @brief   Deletes a route from forwarding table.
  *
@@ -110,6 +110,37 @@ extern "C" {
 #define CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_DO_NOT_OVERRIDE
 #endif
 
+/**
+ * @brief   Number of hash buckets used to look up reassembly buffer entries
+ *
+ * @note    Only applicable with the `gnrc_sixlowpan_frag_rb_hash` module
+ *
+ * Entries are looked up by hashing their (source, destination, tag) tuple
+ * into one of these buckets, instead of comparing every entry of the
+ * reassembly buffer. Must be a power of two.
+ */
+#ifndef CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_HASH_SIZE
+#define CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_HASH_SIZE   (8U)
+#endif
+
+/**
+ * @brief   Merge adjacent fragment intervals of a datagram
+ *
+ * @note    Only applicable with
+ *          [gnrc_sixlowpan_frag_rb](@ref net_gnrc_sixlowpan_frag_rb) module
+ *
+ * When set, the fragment intervals of a reassembly buffer entry are kept as
+ * run-lengths: a fragment adjacent to an already received interval extends
+ * that interval instead of allocating a new one. For in-order reception a
+ * datagram then only occupies a single interval, regardless of its number of
+ * fragments. As a consequence a fragment that is fully contained in an already
+ * received run is handled as a duplicate, even if its bounds differ from the
+ * fragment originally received there.
+ */
+#ifdef DOXYGEN
+#define CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_MERGE_INTS
+#endif
+
 /**
  * @brief   Deletion timer for reassembly buffer entries in microseconds
  *
@@ -101,6 +101,15 @@ typedef struct {
      * @brief   The reassembled packet in the packet buffer
      */
     gnrc_pktsnip_t *pkt;
+#if IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_STATS) || defined(DOXYGEN)
+    /**
+     * @brief   Number of fragments added to the entry
+     *
+     * @note    Only available with module `gnrc_sixlowpan_frag_stats`
+     *          compiled in.
+     */
+    uint16_t frags;
+#endif /* IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_STATS) */
 #if IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_SFR) || defined(DOXYGEN)
     /**
      * @brief   Bitmap for received fragments
@@ -34,6 +34,11 @@ typedef struct {
                              *   reassembly buffer is full */
     unsigned frag_full;     /**< counts the number of events that there where
                              *   no @ref gnrc_sixlowpan_frag_fb_t available */
+    unsigned rbuf_timeout;  /**< counts the number of reassembly buffer
+                             *   entries that timed out before completion */
+    unsigned rbuf_evicted;  /**< counts the number of incomplete reassembly
+                             *   buffer entries that were removed to make
+                             *   room for a new datagram */
     unsigned datagrams;     /**< reassembled datagrams */
     unsigned fragments;     /**< total fragments of reassembled fragments */
 #if defined(MODULE_GNRC_SIXLOWPAN_FRAG_VRB) || DOXYGEN
@@ -73,6 +73,58 @@ static inline uint16_t inet_csum(uint16_t sum, const uint8_t *buf, uint16_t len)
     return inet_csum_slice(sum, buf, len, 0);
 }
 
+/**
+ * @brief   Updates a finished Internet Checksum after a change to the data
+ *          it covers.
+ *
+ * @see <a href="https://tools.ietf.org/html/rfc1624">
+ *          RFC 1624
+ *      </a>
+ *
+ * @details Use this instead of recalculating the checksum over the whole
+ *          domain, e.g. when a header field is rewritten while forwarding.
+ *          The changed field must start at an even offset within the
+ *          checksum domain.
+ *
+ * @param[in] csum      The checksum as found in the header (i.e. normalized,
+ *                      in host byte order).
+ * @param[in] old       The old content of the changed field.
+ * @param[in] new_data  The new content of the changed field.
+ * @param[in] len       Length of the changed field in byte. Must be even.
+ *
+ * @return  The checksum over the changed data, normalized as @p csum.
+ */
+uint16_t inet_csum_update(uint16_t csum, const uint8_t *old,
+                          const uint8_t *new_data, uint16_t len);
+
+/**
+ * @brief   Updates a finished Internet Checksum after a change of a 16-bit
+ *          word in the data it covers.
+ *
+ * @see <a href="https://tools.ietf.org/html/rfc1624">
+ *          RFC 1624
+ *      </a>
+ *
+ * @param[in] csum      The checksum as found in the header (i.e. normalized,
+ *                      in host byte order).
+ * @param[in] old       The old value of the changed 16-bit word (host byte
+ *                      order).
+ * @param[in] new_val   The new value of the changed 16-bit word (host byte
+ *                      order).
+ *
+ * @return  The checksum over the changed data, normalized as @p csum.
+ */
+static inline uint16_t inet_csum_update16(uint16_t csum, uint16_t old,
+                                          uint16_t new_val)
+{
+    /* RFC 1624, eqn. 3: HC' = ~(~HC + ~m + m') */
+    uint32_t sum = (uint16_t)~csum + (uint16_t)~old + (uint32_t)new_val;
+
+    sum = (sum & 0xffff) + (sum >> 16);
+    sum = (sum & 0xffff) + (sum >> 16);
+    return ~sum;
+}
+
 #ifdef __cplusplus
 }
 #endif
@@ -871,6 +871,17 @@ typedef enum {
      */
     NETOPT_GTS_TX,
 
+    /**
+     * @brief   (@ref netopt_enable_t) device calculates upper-layer checksums
+     *          of outgoing packets (read-only)
+     *
+     * When enabled, the device fills the UDP, TCP, and ICMPv6 checksum fields
+     * of every frame it sends, including the IPv6 pseudo-header. The network
+     * stack then leaves these fields 0 instead of calculating them in
+     * software.
+     */
+    NETOPT_CSUM_OFFLOAD,
+
     /**
      * @brief   maximum number of options defined here.
      *
@@ -0,0 +1,232 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    sys_objpool Thread-safe object pool
+ * @ingroup     sys_memory_management
+ * @brief       Lock-free pool of fixed size objects
+ *
+ * The object pool is similar to @ref sys_memarray, but objects can be
+ * allocated and freed from any thread or ISR without a lock. It is not a
+ * drop-in replacement: the functions are prefixed `objpool_` instead of
+ * `memarray_`, and there is no equivalent of memarray_extend() and
+ * memarray_reduce().
+ * The free objects form a list linked by their index. The head of the list is
+ * a 32 bit word holding the index of the first object and a tag that is
+ * incremented on every change. The head is updated with a C11 compare and
+ * swap, the tag makes sure that an update fails when the list was changed in
+ * between, even if the same object is at the head again (ABA problem).
+ * The tag has 16 bits, so this only makes ABA unlikely, it does not rule it
+ * out: if a thread is preempted in the middle of an update while the head
+ * changes exactly a multiple of 65536 times, the tag is the same again and
+ * its stale update succeeds.
+ * On CPUs with exclusive load and store, e.g. ARMv7-M, the compare and swap
+ * is implemented with them, on others by disabling interrupts.
+ *
+ * A pool holds at most 65535 objects of at least `sizeof(void *)` bytes, all
+ * given to objpool_init().
+ *
+ * ## Per-thread caches
+ *
+ * With the `objpool_cache` module, a pool can get a small cache for each
+ * thread with @ref objpool_cache_init. Objects freed by a thread are put in
+ * its cache and given back on its next allocation, without touching the
+ * shared list. When the cache is full, half of it is put back to the shared
+ * list with a single compare and swap. ISRs always use the shared list.
+ *
+ * Objects in the cache of a thread can not be allocated by other threads, so
+ * the pool should have @ref CONFIG_OBJPOOL_CACHE_SIZE objects more per thread
+ * using it. A thread should call @ref objpool_cache_flush before it exits.
+ *
+ * ## Statistics
+ *
+ * With the `objpool_stats` module, a pool counts the objects in use, the
+ * highest number of objects in use and the failed allocations, see
+ * @ref objpool_get_stats.
+ *
+ * @{
+ *
+ * @file
+ * @brief       Thread-safe object pool interface definition
+ */
+
+#ifndef OBJPOOL_H
+#define OBJPOOL_H
+
+#include <stdatomic.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "modules.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup sys_objpool_conf Object pool compile configurations
+ * @ingroup config
+ * @{
+ */
+/**
+ * @brief   Number of objects in the cache of a thread
+ */
+#ifndef CONFIG_OBJPOOL_CACHE_SIZE
+#define CONFIG_OBJPOOL_CACHE_SIZE   (4U)
+#endif
+/** @} */
+
+/**
+ * @brief   Per-thread cache of an object pool
+ */
+typedef struct {
+    uint16_t num;                               /**< number of cached objects */
+    uint16_t idx[CONFIG_OBJPOOL_CACHE_SIZE];    /**< indices of the objects */
+} objpool_cache_t;
+
+/**
+ * @brief   Statistics of an object pool
+ */
+typedef struct {
+    unsigned in_use;        /**< objects currently allocated */
+    unsigned high_water;    /**< highest number of objects allocated at once */
+    unsigned failures;      /**< allocations that failed */
+} objpool_stats_t;
+
+/**
+ * @brief   Object pool
+ */
+typedef struct {
+    uint8_t *data;                  /**< memory of the objects */
+    size_t size;                    /**< size of an object */
+    uint16_t num;                   /**< number of objects */
+    atomic_uint_least32_t head;     /**< tag and index + 1 of the first free
+                                         object, 0 if there is none */
+#if IS_USED(MODULE_OBJPOOL_CACHE) || defined(DOXYGEN)
+    objpool_cache_t *caches;        /**< @ref MAXTHREADS caches or NULL */
+#endif
+#if IS_USED(MODULE_OBJPOOL_STATS) || defined(DOXYGEN)
+    atomic_uint in_use;             /**< objects currently allocated */
+    atomic_uint high_water;         /**< highest value of @p in_use */
+    atomic_uint failures;           /**< allocations that failed */
+#endif
+} objpool_t;
+
+/**
+ * @brief   Initialize an object pool
+ *
+ * @pre `size >= sizeof(void *)`
+ * @pre `0 < num <= UINT16_MAX`
+ *
+ * @param[out]  pool    object pool to initialize
+ * @param[in]   data    memory for @p num objects
+ * @param[in]   size    size of an object in bytes
+ * @param[in]   num     number of objects in @p data
+ */
+void objpool_init(objpool_t *pool, void *data, size_t size, size_t num);
+
+/**
+ * @brief   Allocate an object
+ *
+ * Can be called from any thread or ISR.
+ *
+ * @note    The object is not cleared
+ *
+ * @param[in,out]   pool    object pool
+ *
+ * @return  pointer to the object
+ * @return  NULL if no object is free
+ */
+void *objpool_alloc(objpool_t *pool);
+
+/**
+ * @brief   Allocate and clear an object
+ *
+ * @param[in,out]   pool    object pool
+ *
+ * @return  pointer to the object
+ * @return  NULL if no object is free
+ */
+static inline void *objpool_calloc(objpool_t *pool)
+{
+    void *obj = objpool_alloc(pool);
+
+    if (obj) {
+        memset(obj, 0, pool->size);
+    }
+    return obj;
+}
+
+/**
+ * @brief   Free an object
+ *
+ * Can be called from any thread or ISR.
+ *
+ * @param[in,out]   pool    object pool
+ * @param[in]       ptr     object allocated from @p pool
+ */
+void objpool_free(objpool_t *pool, void *ptr);
+
+/**
+ * @brief   Get the number of free objects
+ *
+ * Objects in the caches of threads are counted as free. The result is only
+ * exact if the pool is not used concurrently.
+ *
+ * @param[in]   pool    object pool
+ *
+ * @return  number of free objects
+ */
+size_t objpool_available(objpool_t *pool);
+
+#if IS_USED(MODULE_OBJPOOL_CACHE) || defined(DOXYGEN)
+/**
+ * @brief   Enable the per-thread caches of a pool
+ *
+ * Must be called right after @ref objpool_init, before the pool is used.
+ *
+ * @param[in,out]   pool    object pool
+ * @param[in]       caches  array of @ref MAXTHREADS caches
+ */
+void objpool_cache_init(objpool_t *pool, objpool_cache_t *caches);
+
+/**
+ * @brief   Put the objects in the cache of the calling thread back to the
+ *          shared list
+ *
+ * @param[in,out]   pool    object pool
+ */
+void objpool_cache_flush(objpool_t *pool);
+#endif
+
+#if IS_USED(MODULE_OBJPOOL_STATS) || defined(DOXYGEN)
+/**
+ * @brief   Get the statistics of a pool
+ *
+ * @param[in]   pool    object pool
+ * @param[out]  stats   statistics of @p pool
+ */
+void objpool_get_stats(objpool_t *pool, objpool_stats_t *stats);
+
+/**
+ * @brief   Reset the high water mark and the failure counter of a pool
+ *
+ * The high water mark is set to the number of objects currently in use.
+ *
+ * @param[in,out]   pool    object pool
+ */
+void objpool_reset_stats(objpool_t *pool);
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* OBJPOOL_H */
+/** @} */
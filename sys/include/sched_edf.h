@@ -0,0 +1,123 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    sched_edf Earliest Deadline First Scheduler
+ * @ingroup     sys
+ * @brief       Earliest deadline first scheduling within one priority level
+ *
+ * This module turns the priority level @ref CONFIG_SCHED_EDF_PRIO into an
+ * earliest deadline first (EDF) scheduling class: runnable threads of that
+ * priority are ordered by their absolute deadline, and a thread becoming
+ * runnable with an earlier deadline than the running one preempts it. All
+ * other priorities keep the fixed priority scheduling of RIOT, so threads of
+ * higher priority still preempt any EDF thread.
+ *
+ * Periodic tasks use @ref sched_edf_task_t, which updates the deadline of
+ * the calling thread at each release and counts missed deadlines:
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~ {.c}
+ * sched_edf_task_t task;
+ *
+ * sched_edf_task_init(&task, 10000, 8000);
+ * while (1) {
+ *     sample_sensor();
+ *     sched_edf_task_wait(&task);
+ * }
+ * ~~~~~~~~~~~~~~~~~~~~~~~~
+ *
+ * Deadlines are ticks of @ref SCHED_EDF_TIMERBASE and are compared
+ * overflow aware, so they must not lie more than 2^31 ticks apart.
+ *
+ * @{
+ *
+ * @file
+ * @brief       Earliest Deadline First Scheduler
+ */
+#ifndef SCHED_EDF_H
+#define SCHED_EDF_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "thread.h"
+#include "ztimer.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if !defined(SCHED_EDF_TIMERBASE) || defined(DOXYGEN)
+/**
+ * @brief   ztimer clock the deadlines are based on
+ *
+ * @details Defaults to ZTIMER_USEC if available else it uses ZTIMER_MSEC
+ */
+#if MODULE_ZTIMER_USEC
+#define SCHED_EDF_TIMERBASE ZTIMER_USEC
+#else
+#define SCHED_EDF_TIMERBASE ZTIMER_MSEC
+#endif
+#endif
+
+/**
+ * @brief   Periodic EDF task
+ */
+typedef struct {
+    uint32_t release;       /**< release time of the current job          */
+    uint32_t period;        /**< period in ticks                          */
+    uint32_t deadline;      /**< deadline relative to the release         */
+    uint32_t jobs;          /**< number of completed jobs                 */
+    uint32_t misses;        /**< number of jobs completed after deadline  */
+} sched_edf_task_t;
+
+/**
+ * @brief   Set the absolute deadline of a thread
+ *
+ * If @p thread is runnable, it is moved to its new position in the run
+ * queue and the scheduler is invoked if that changes the thread to run.
+ *
+ * @param[in,out]   thread      thread to set the deadline of
+ * @param[in]       deadline    absolute deadline in ticks of
+ *                              @ref SCHED_EDF_TIMERBASE, 0 to clear it
+ */
+void sched_edf_set_deadline(thread_t *thread, uint32_t deadline);
+
+/**
+ * @brief   Turn the calling thread into a periodic EDF task
+ *
+ * Moves the calling thread to @ref CONFIG_SCHED_EDF_PRIO and releases the
+ * first job now.
+ *
+ * @param[out]  task        task to initialize
+ * @param[in]   period      period of the task in ticks
+ * @param[in]   deadline    deadline of each job relative to its release,
+ *                          usually less than or equal to @p period
+ */
+void sched_edf_task_init(sched_edf_task_t *task, uint32_t period,
+                         uint32_t deadline);
+
+/**
+ * @brief   Complete the current job and sleep until the next release
+ *
+ * If the next release already passed, the function returns right away and
+ * the next job starts late.
+ *
+ * @param[in,out]   task    task of the calling thread
+ *
+ * @retval  true    the completed job met its deadline
+ * @retval  false   the completed job missed its deadline
+ */
+bool sched_edf_task_wait(sched_edf_task_t *task);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SCHED_EDF_H */
+/** @} */
@@ -26,10 +26,12 @@
  * The trace buffer works like a ring-buffer. If it is full, it will start
  * overwriting from the beginning.
  *
- * Tracing is made thread safe by disabling interrupts for critical sections.
+ * A slot in the buffer is reserved with a single atomic increment, so
+ * recording does not disable interrupts. An entry that is being written when
+ * the buffer is dumped may be incomplete.
  *
  * It does incur some overhead (at least a function call, getting the current
- * time, a pair of enable/disable interrupts and a couple of memory accesses).
+ * time, an atomic increment and writing a 16 byte record).
  *
  * Example:
  *
@@ -41,6 +43,30 @@
  * trace_dump();
  * ~~~~~~~~~~~~~~~~~~~~~~~~
  *
+ * Tracepoints
+ * -----------
+ *
+ * In addition to `trace()`, RIOT has built-in tracepoints that are compiled
+ * in by using the corresponding module:
+ *
+ * | module         | events                                           |
+ * |----------------|--------------------------------------------------|
+ * | `trace_sched`  | context switches                                 |
+ * | `trace_msg`    | messages sent and received                       |
+ * | `trace_pktbuf` | GNRC packet snips allocated and freed            |
+ * | `trace_netif`  | packets sent and received by GNRC interfaces     |
+ * | `trace_ztimer` | ztimer callbacks fired                           |
+ *
+ * Compiled in tracepoints are recorded once auto_init has run and can be
+ * switched on and off at runtime with @ref trace_enable and
+ * @ref trace_disable. @ref CONFIG_TRACE_CATEGORIES selects the categories
+ * that are enabled initially.
+ *
+ * @ref trace_export writes the buffer in the JSON trace event format, which
+ * can be opened with https://ui.perfetto.dev or `chrome://tracing`. Context
+ * switches show up as slices of the thread that is running, all other events
+ * as instant events of the thread or ISR that recorded them.
+ *
  * @{
  *
  * @brief       Execution tracing module API
@@ -53,12 +79,104 @@
 #ifndef TRACE_H
 #define TRACE_H
 
+#include <stddef.h>
 #include <stdint.h>
 
+#include "kernel_defines.h"
+
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+/**
+ * @brief   Trace event categories
+ *
+ * Each category can be enabled and disabled at runtime.
+ */
+enum {
+    TRACE_CAT_USER,             /**< values recorded with @ref trace */
+    TRACE_CAT_SCHED,            /**< scheduler */
+    TRACE_CAT_MSG,              /**< core messages */
+    TRACE_CAT_PKTBUF,           /**< GNRC packet buffer */
+    TRACE_CAT_NETIF,            /**< GNRC network interfaces */
+    TRACE_CAT_ZTIMER,           /**< ztimer */
+    TRACE_CAT_NUMOF,            /**< number of categories */
+};
+
+/**
+ * @brief   Get the mask of a category for @ref trace_enable
+ */
+#define TRACE_CAT_MASK(cat)     (1UL << (cat))
+
+/**
+ * @brief   Mask of all categories
+ */
+#define TRACE_CAT_ALL           (TRACE_CAT_MASK(TRACE_CAT_NUMOF) - 1)
+
+/**
+ * @brief   Categories that are enabled by auto_init
+ */
+#ifndef CONFIG_TRACE_CATEGORIES
+#define CONFIG_TRACE_CATEGORIES TRACE_CAT_ALL
+#endif
+
+/**
+ * @brief   Build an event identifier from its category and number
+ */
+#define TRACE_EVENT(cat, num)   (((cat) << 8) | (num))
+
+/**
+ * @brief   Trace events
+ */
+typedef enum {
+    /** value passed to @ref trace */
+    TRACE_USER          = TRACE_EVENT(TRACE_CAT_USER, 0),
+    /** context switch, args: previous PID, next PID */
+    TRACE_SCHED_SWITCH  = TRACE_EVENT(TRACE_CAT_SCHED, 0),
+    /** message sent or replied, args: target PID, message type */
+    TRACE_MSG_SEND      = TRACE_EVENT(TRACE_CAT_MSG, 0),
+    /** message received, args: sender PID, message type */
+    TRACE_MSG_RECV      = TRACE_EVENT(TRACE_CAT_MSG, 1),
+    /** packet snip allocated, args: snip, size */
+    TRACE_PKTBUF_ALLOC  = TRACE_EVENT(TRACE_CAT_PKTBUF, 0),
+    /** packet snip freed, args: snip, size */
+    TRACE_PKTBUF_FREE   = TRACE_EVENT(TRACE_CAT_PKTBUF, 1),
+    /** packet handed to the device, args: interface PID, length */
+    TRACE_NETIF_TX      = TRACE_EVENT(TRACE_CAT_NETIF, 0),
+    /** packet received from the device, args: interface PID, length */
+    TRACE_NETIF_RX      = TRACE_EVENT(TRACE_CAT_NETIF, 1),
+    /** timer callback called, args: timer, callback */
+    TRACE_ZTIMER_FIRE   = TRACE_EVENT(TRACE_CAT_ZTIMER, 0),
+} trace_event_t;
+
+/**
+ * @brief   Trace buffer entry
+ *
+ * Pointers are recorded as their lower 32 bits.
+ */
+typedef struct {
+    uint32_t time;              /**< ZTIMER_USEC time stamp */
+    uint16_t event;             /**< event, see @ref trace_event_t */
+    int16_t pid;                /**< recording thread or KERNEL_PID_ISR */
+    uint32_t arg[2];            /**< event arguments */
+} trace_record_t;
+
+/**
+ * @brief   Write function for @ref trace_export
+ *
+ * @param[in]   arg     argument passed to @ref trace_export
+ * @param[in]   data    data to write
+ * @param[in]   len     length of @p data
+ */
+typedef void (*trace_write_t)(void *arg, const void *data, size_t len);
+
+/**
+ * @brief   Categories that are currently recorded
+ *
+ * @internal use @ref trace_enable and @ref trace_disable
+ */
+extern volatile uint32_t trace_categories;
+
 /**
  * @brief   Add entry to trace buffer
  *
@@ -73,12 +191,52 @@ extern "C" {
  */
 void trace(uint32_t val);
 
+/**
+ * @brief   Add an event to the trace buffer, regardless of its category
+ *
+ * @param[in]   event   event to record
+ * @param[in]   arg0    first argument of the event
+ * @param[in]   arg1    second argument of the event
+ */
+void trace_record(trace_event_t event, uint32_t arg0, uint32_t arg1);
+
+/**
+ * @brief   Add an event to the trace buffer if its category is enabled
+ *
+ * This is what tracepoints call.
+ *
+ * @param[in]   event   event to record
+ * @param[in]   arg0    first argument of the event
+ * @param[in]   arg1    second argument of the event
+ */
+static inline void trace_event(trace_event_t event, uint32_t arg0,
+                               uint32_t arg1)
+{
+    if (trace_categories & TRACE_CAT_MASK(event >> 8)) {
+        trace_record(event, arg0, arg1);
+    }
+}
+
+/**
+ * @brief   Start recording events of the given categories
+ *
+ * @param[in]   categories  mask of categories, see @ref TRACE_CAT_MASK
+ */
+void trace_enable(uint32_t categories);
+
+/**
+ * @brief   Stop recording events of the given categories
+ *
+ * @param[in]   categories  mask of categories, see @ref TRACE_CAT_MASK
+ */
+void trace_disable(uint32_t categories);
+
 /**
  * @brief   Print the current trace buffer
  *
  * Will print the number of the trace log entry, the timestamp (first entry) or
  * relative time since last entry, and the value supplied to the `trace()` call
- * of each entry.
+ * of each entry. Other events are printed with their name and arguments.
  *
  * Example output (after adding two traces, 3us apart, with values 0 and 1):
  *
@@ -87,6 +245,35 @@ void trace(uint32_t val);
  */
 void trace_dump(void);
 
+/**
+ * @brief   Write the trace buffer in the JSON trace event format
+ *
+ * Recording is paused while the buffer is exported.
+ *
+ * @param[in]   write   function to write the output with
+ * @param[in]   arg     argument passed to @p write
+ */
+void trace_export(trace_write_t write, void *arg);
+
+/**
+ * @brief   Write the trace buffer in the JSON trace event format to stdio
+ */
+void trace_export_stdio(void);
+
+/**
+ * @brief   Write the trace buffer in the JSON trace event format to a file
+ *
+ * On native, this can be a file on the host with the `fs_native` module.
+ *
+ * @note    Only available with the `vfs` module.
+ *
+ * @param[in]   path    VFS path of the file to create
+ *
+ * @return  0 on success
+ * @return  negative errno on error
+ */
+int trace_export_file(const char *path);
+
 /**
  * @brief   Empty the trace buffer
  */
@@ -384,6 +384,7 @@ typedef struct {
  */
 struct vfs_mount_struct {
     clist_node_t list_entry;     /**< List entry for the _vfs_mount_list list */
+    vfs_mount_t *lookup_next;    /**< Next mount point in path look-up order */
     const vfs_file_system_t *fs; /**< The file system driver for the mount point */
     const char *mount_point;     /**< Mount point, e.g. "/mnt/cdrom" */
     size_t mount_point_len;      /**< Length of mount_point string (set by vfs_mount) */
@@ -548,6 +549,27 @@ struct vfs_file_ops {
      */
     ssize_t (*read) (vfs_file_t *filp, void *dest, size_t nbytes);
 
+    /**
+     * @brief Get direct read-only access to the bytes at the current position
+     *
+     * This is optional and only implemented by file systems that can expose
+     * file contents as directly addressable memory, e.g. because they are
+     * stored in memory mapped flash. The read position is advanced as with
+     * @c read.
+     *
+     * The returned memory must stay valid until the next operation on
+     * @p filp.
+     *
+     * @param[in]  filp     pointer to open file
+     * @param[out] data     start of the extent
+     * @param[in]  nbytes   maximum number of bytes to access
+     *
+     * @return number of bytes available at @p data, may be less than @p nbytes
+     * @return 0 at the end of the file
+     * @return <0 on error
+     */
+    ssize_t (*read_extent) (vfs_file_t *filp, const void **data, size_t nbytes);
+
     /**
      * @brief Write bytes to an open file
      *
@@ -867,6 +889,61 @@ ssize_t vfs_read(int fd, void *dest, size_t count);
  */
 ssize_t vfs_readline(int fd, char *dest, size_t count);
 
+/**
+ * @brief Access the contents of an open file without copying them
+ *
+ * Only supported by file systems that store files in directly addressable
+ * memory, like @ref sys_fs_constfs. The read position is advanced by the
+ * number of bytes returned.
+ *
+ * @param[in]  fd       fd number obtained from vfs_open
+ * @param[out] data     start of the file contents at the current position,
+ *                      valid until the next operation on @p fd
+ * @param[in]  count    maximum number of bytes to access
+ *
+ * @return number of bytes available at @p data on success
+ * @return 0 at the end of the file
+ * @return -ENOTSUP if the file system does not support direct access
+ * @return <0 on other errors
+ */
+ssize_t vfs_read_extent(int fd, const void **data, size_t count);
+
+/**
+ * @brief Callback for @ref vfs_sendfile
+ *
+ * @param[in]  arg      argument passed to @ref vfs_sendfile
+ * @param[in]  data     data to send
+ *
+ * @return number of bytes sent, less than the length of @p data ends the
+ *         transfer
+ * @return <0 on error
+ */
+typedef ssize_t (*vfs_sendfile_cb_t)(void *arg, const iolist_t *data);
+
+/**
+ * @brief Pass the contents of an open file to a send function
+ *
+ * If the file system supports @ref vfs_read_extent, the file contents are
+ * handed to @p send without any copy, e.g. to @ref sock_udp_sendv. Otherwise
+ * they are read into @p buf chunk by chunk.
+ *
+ * On success, the read position of @p fd is behind the last byte sent.
+ *
+ * @param[in]  fd       fd number obtained from vfs_open
+ * @param[in]  send     function sending the data
+ * @param[in]  arg      argument for @p send
+ * @param[in]  count    maximum number of bytes to send
+ * @param[in]  buf      buffer to read into if direct access is not supported,
+ *                      may be NULL
+ * @param[in]  buf_len  size of @p buf
+ *
+ * @return number of bytes sent on success
+ * @return -ENOTSUP if direct access is not supported and no @p buf was given
+ * @return <0 on other errors
+ */
+ssize_t vfs_sendfile(int fd, vfs_sendfile_cb_t send, void *arg, size_t count,
+                     void *buf, size_t buf_len);
+
 /**
  * @brief Write bytes to an open file
  *
@@ -0,0 +1,99 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser General
+ * Public License v2.1. See the file LICENSE in the top level directory for more
+ * details.
+ */
+
+/**
+ * @ingroup     sys_lfrb
+ * @{
+ *
+ * @file
+ * @brief       Single producer, single consumer ringbuffer
+ *
+ * The producer only writes `writes` and the consumer only writes `reads`, so
+ * atomic loads and stores of the counters are enough. The stores come after
+ * copying the elements, the other side never sees a counter before the data.
+ *
+ * @}
+ */
+
+#include <string.h>
+
+#include "lfrb.h"
+
+static void _copy_in(lfrb_t *rb, uint32_t pos, const uint8_t *src, unsigned n)
+{
+    unsigned idx = pos & (rb->size - 1);
+    unsigned first = rb->size - idx;
+
+    if (first > n) {
+        first = n;
+    }
+    memcpy(rb->buf + idx * rb->elem_size, src, first * rb->elem_size);
+    memcpy(rb->buf, src + first * rb->elem_size, (n - first) * rb->elem_size);
+}
+
+static void _copy_out(const lfrb_t *rb, uint32_t pos, uint8_t *dst, unsigned n)
+{
+    unsigned idx = pos & (rb->size - 1);
+    unsigned first = rb->size - idx;
+
+    if (first > n) {
+        first = n;
+    }
+    memcpy(dst, rb->buf + idx * rb->elem_size, first * rb->elem_size);
+    memcpy(dst + first * rb->elem_size, rb->buf, (n - first) * rb->elem_size);
+}
+
+unsigned lfrb_add(lfrb_t *rb, const void *src, unsigned n)
+{
+    uint32_t writes = rb->writes;
+    unsigned free = rb->size - (writes - atomic_load_u32(&rb->reads));
+
+    if (n > free) {
+        n = free;
+    }
+    if (n) {
+        _copy_in(rb, writes, src, n);
+        atomic_store_u32(&rb->writes, writes + n);
+    }
+    return n;
+}
+
+unsigned lfrb_peek(const lfrb_t *rb, void *dst, unsigned n)
+{
+    uint32_t reads = rb->reads;
+    unsigned avail = atomic_load_u32(&rb->writes) - reads;
+
+    if (n > avail) {
+        n = avail;
+    }
+    if (n) {
+        _copy_out(rb, reads, dst, n);
+    }
+    return n;
+}
+
+unsigned lfrb_get(lfrb_t *rb, void *dst, unsigned n)
+{
+    n = lfrb_peek(rb, dst, n);
+    if (n) {
+        atomic_store_u32(&rb->reads, rb->reads + n);
+    }
+    return n;
+}
+
+unsigned lfrb_drop(lfrb_t *rb, unsigned n)
+{
+    uint32_t reads = rb->reads;
+    unsigned avail = atomic_load_u32(&rb->writes) - reads;
+
+    if (n > avail) {
+        n = avail;
+    }
+    atomic_store_u32(&rb->reads, reads + n);
+    return n;
+}
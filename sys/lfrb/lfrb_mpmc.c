@@ -0,0 +1,145 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser General
+ * Public License v2.1. See the file LICENSE in the top level directory for more
+ * details.
+ */
+
+/**
+ * @ingroup     sys_lfrb
+ * @{
+ *
+ * @file
+ * @brief       Multi producer, multi consumer ringbuffer
+ *
+ * Based on the bounded queue by Dmitry Vyukov: element `i` has the sequence
+ * number `pos` when it can be written at position `pos`, and `pos + 1` when it
+ * can be read at position `pos`. A producer claims all elements that are
+ * ready to be written with a single compare and swap of the tail, copies
+ * them and then marks them as readable. Consumers work the same way on the
+ * head.
+ *
+ * @}
+ */
+
+#include <string.h>
+
+#include "lfrb.h"
+
+void lfrb_mpmc_init(lfrb_mpmc_t *rb, void *buf, atomic_uint *seq,
+                    uint16_t size, uint16_t elem_size)
+{
+    assert((size != 0) && ((size & (size - 1)) == 0));
+
+    rb->buf = buf;
+    rb->seq = seq;
+    rb->size = size;
+    rb->elem_size = elem_size;
+    for (unsigned i = 0; i < size; i++) {
+        atomic_init(&seq[i], i);
+    }
+    atomic_init(&rb->head, 0);
+    atomic_init(&rb->tail, 0);
+}
+
+/* claims up to n elements whose sequence number is pos + offset, returns the
+ * number of elements claimed and their first position in pos */
+static unsigned _claim(lfrb_mpmc_t *rb, atomic_uint *counter, unsigned *pos,
+                       unsigned offset, unsigned n)
+{
+    unsigned mask = rb->size - 1;
+
+    *pos = atomic_load_explicit(counter, memory_order_relaxed);
+    while (1) {
+        unsigned claimed = 0;
+        unsigned seq = 0;
+
+        while (claimed < n) {
+            unsigned cur = *pos + claimed;
+
+            seq = atomic_load_explicit(&rb->seq[cur & mask],
+                                       memory_order_acquire);
+            if (seq != cur + offset) {
+                break;
+            }
+            claimed++;
+        }
+
+        if (claimed == 0) {
+            if ((int)(seq - (*pos + offset)) < 0) {
+                /* full or empty, or the element is still being copied */
+                return 0;
+            }
+            /* others got ahead of us */
+            *pos = atomic_load_explicit(counter, memory_order_relaxed);
+            continue;
+        }
+
+        /* *pos is updated if the counter changed in the meantime */
+        if (atomic_compare_exchange_weak_explicit(counter, pos,
+                                                  *pos + claimed,
+                                                  memory_order_relaxed,
+                                                  memory_order_relaxed)) {
+            return claimed;
+        }
+    }
+}
+
+static void _mark(lfrb_mpmc_t *rb, unsigned pos, unsigned n, unsigned offset)
+{
+    unsigned mask = rb->size - 1;
+
+    for (unsigned i = 0; i < n; i++) {
+        atomic_store_explicit(&rb->seq[(pos + i) & mask], pos + i + offset,
+                              memory_order_release);
+    }
+}
+
+unsigned lfrb_mpmc_add(lfrb_mpmc_t *rb, const void *src, unsigned n)
+{
+    unsigned pos;
+
+    n = _claim(rb, &rb->tail, &pos, 0, n);
+    if (n == 0) {
+        return 0;
+    }
+
+    unsigned idx = pos & (rb->size - 1);
+    unsigned first = rb->size - idx;
+    const uint8_t *data = src;
+
+    if (first > n) {
+        first = n;
+    }
+    memcpy(rb->buf + idx * rb->elem_size, data, first * rb->elem_size);
+    memcpy(rb->buf, data + first * rb->elem_size, (n - first) * rb->elem_size);
+
+    /* readable at the same position */
+    _mark(rb, pos, n, 1);
+    return n;
+}
+
+unsigned lfrb_mpmc_get(lfrb_mpmc_t *rb, void *dst, unsigned n)
+{
+    unsigned pos;
+
+    n = _claim(rb, &rb->head, &pos, 1, n);
+    if (n == 0) {
+        return 0;
+    }
+
+    unsigned idx = pos & (rb->size - 1);
+    unsigned first = rb->size - idx;
+    uint8_t *data = dst;
+
+    if (first > n) {
+        first = n;
+    }
+    memcpy(data, rb->buf + idx * rb->elem_size, first * rb->elem_size);
+    memcpy(data + first * rb->elem_size, rb->buf, (n - first) * rb->elem_size);
+
+    /* writable again one round later */
+    _mark(rb, pos, n, rb->size);
+    return n;
+}
@@ -27,16 +27,31 @@
 #include "malloc_monitor_internal.h"
 #include "mutex.h"
 
+#if IS_USED(MODULE_TLSF_MALLOC_TAG)
+#include "tlsf-malloc.h"
+#endif
+
 extern void *__real_malloc(size_t size);
 extern void __real_free(void *ptr);
 extern void *__real_realloc(void *ptr, size_t size);
 
 static mutex_t _lock;
 
+/* let the allocator tag the allocation with the caller of the wrapper */
+static inline void _set_caller(uintptr_t pc)
+{
+#if IS_USED(MODULE_TLSF_MALLOC_TAG)
+    tlsf_malloc_set_caller(pc);
+#else
+    (void)pc;
+#endif
+}
+
 void __attribute__((used)) *__wrap_malloc(size_t size)
 {
     assert(!irq_is_in());
     mutex_lock(&_lock);
+    _set_caller(cpu_get_caller_pc());
     void *ptr = __real_malloc(size);
     if (IS_USED(MODULE_MALLOC_MONITOR)) {
         malloc_monitor_add(ptr, size, cpu_get_caller_pc(), "m");
@@ -67,6 +82,7 @@ void * __attribute__((used)) __wrap_calloc(size_t nmemb, size_t size)
     }
 
     mutex_lock(&_lock);
+    _set_caller(cpu_get_caller_pc());
     void *res = __real_malloc(total_size);
     if (IS_USED(MODULE_MALLOC_MONITOR)) {
         malloc_monitor_add(res, total_size, cpu_get_caller_pc(), "c");
@@ -83,6 +99,7 @@ void * __attribute__((used))__wrap_realloc(void *ptr, size_t size)
 {
     assert(!irq_is_in());
     mutex_lock(&_lock);
+    _set_caller(cpu_get_caller_pc());
     void *new = __real_realloc(ptr, size);
     if (IS_USED(MODULE_MALLOC_MONITOR)) {
         malloc_monitor_mv(ptr, new, size, cpu_get_caller_pc());
@@ -0,0 +1,185 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_mutex_profiling
+ * @{
+ *
+ * @file
+ * @brief       Mutex contention profiling implementation
+ *
+ * @}
+ */
+
+#include <errno.h>
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "irq.h"
+#include "mutex_profiling.h"
+#include "ztimer.h"
+
+static mutex_profile_t _profiles[CONFIG_MUTEX_PROFILING_NUMOF];
+/* contended mutexes that did not fit into the table */
+static uint32_t _dropped;
+static bool _enabled;
+
+/* must be called with IRQs disabled */
+static mutex_profile_t *_find(const mutex_t *mutex, bool create)
+{
+    mutex_profile_t *free = NULL;
+
+    for (unsigned i = 0; i < CONFIG_MUTEX_PROFILING_NUMOF; i++) {
+        if (_profiles[i].mutex == mutex) {
+            return &_profiles[i];
+        }
+        if (!free && !_profiles[i].mutex) {
+            free = &_profiles[i];
+        }
+    }
+    if (!create) {
+        return NULL;
+    }
+    if (!free) {
+        _dropped++;
+        return NULL;
+    }
+    memset(free, 0, sizeof(*free));
+    free->mutex = mutex;
+    return free;
+}
+
+void mutex_profiling_init(void)
+{
+    ztimer_acquire(ZTIMER_USEC);
+    _enabled = true;
+}
+
+uint32_t mutex_profiling_now(void)
+{
+    return _enabled ? ztimer_now(ZTIMER_USEC) : 0;
+}
+
+static void _acquired(mutex_profile_t *profile, uinttxtptr_t pc, uint32_t now)
+{
+    profile->locks++;
+    profile->locked_at = now;
+    profile->owner_pc = pc;
+}
+
+void mutex_profiling_acquired(const mutex_t *mutex, uinttxtptr_t pc)
+{
+    if (!_enabled) {
+        return;
+    }
+
+    unsigned state = irq_disable();
+    mutex_profile_t *profile = _find(mutex, false);
+
+    if (profile) {
+        _acquired(profile, pc, ztimer_now(ZTIMER_USEC));
+    }
+    irq_restore(state);
+}
+
+void mutex_profiling_contended(const mutex_t *mutex, uinttxtptr_t pc,
+                               uint32_t since)
+{
+    if (!_enabled) {
+        return;
+    }
+
+    unsigned state = irq_disable();
+    mutex_profile_t *profile = _find(mutex, true);
+
+    if (profile) {
+        uint32_t now = ztimer_now(ZTIMER_USEC);
+        uint32_t wait = now - since;
+
+        profile->contended++;
+        profile->wait_us += wait;
+        if (wait >= profile->wait_max_us) {
+            profile->wait_max_us = wait;
+            profile->wait_max_pc = pc;
+        }
+        _acquired(profile, pc, now);
+    }
+    irq_restore(state);
+}
+
+void mutex_profiling_released(const mutex_t *mutex)
+{
+    if (!_enabled) {
+        return;
+    }
+
+    unsigned state = irq_disable();
+    mutex_profile_t *profile = _find(mutex, false);
+
+    /* the mutex may have been locked before the entry was created */
+    if (profile && profile->locks) {
+        uint32_t hold = ztimer_now(ZTIMER_USEC) - profile->locked_at;
+
+        profile->hold_us += hold;
+        if (hold >= profile->hold_max_us) {
+            profile->hold_max_us = hold;
+            profile->hold_max_pc = profile->owner_pc;
+        }
+    }
+    irq_restore(state);
+}
+
+int mutex_profiling_get(const mutex_t *mutex, mutex_profile_t *profile)
+{
+    unsigned state = irq_disable();
+    mutex_profile_t *entry = _find(mutex, false);
+
+    if (entry) {
+        *profile = *entry;
+    }
+    irq_restore(state);
+
+    return entry ? 0 : -ENOENT;
+}
+
+void mutex_profiling_reset(void)
+{
+    unsigned state = irq_disable();
+    memset(_profiles, 0, sizeof(_profiles));
+    _dropped = 0;
+    irq_restore(state);
+}
+
+void mutex_profiling_print(void)
+{
+    mutex_profile_t p;
+
+    printf("%-10s %8s %8s %10s %10s %-10s %10s %10s %-10s\n",
+           "mutex", "locks", "waits", "wait[us]", "max[us]", "max pc",
+           "hold[us]", "max[us]", "max pc");
+    for (unsigned i = 0; i < CONFIG_MUTEX_PROFILING_NUMOF; i++) {
+        unsigned state = irq_disable();
+        p = _profiles[i];
+        irq_restore(state);
+
+        if (!p.mutex) {
+            continue;
+        }
+        printf("%-10p %8" PRIu32 " %8" PRIu32 " %10" PRIu32 " %10" PRIu32
+               " 0x%08" PRIxTXTPTR " %10" PRIu32 " %10" PRIu32
+               " 0x%08" PRIxTXTPTR "\n",
+               (void *)p.mutex, p.locks, p.contended, p.wait_us, p.wait_max_us,
+               p.wait_max_pc, p.hold_us, p.hold_max_us, p.hold_max_pc);
+    }
+    if (_dropped) {
+        printf("%" PRIu32 " contended mutexes did not fit into the table\n",
+               _dropped);
+    }
+}
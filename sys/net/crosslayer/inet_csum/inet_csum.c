@@ -12,9 +12,13 @@
  * @file
  */
 
+#include <assert.h>
 #include <inttypes.h>
 #include <stdio.h>
+#include <string.h>
 
+#include "architecture.h"
+#include "byteorder.h"
 #include "modules.h"
 #include "od.h"
 #include "net/inet_csum.h"
@@ -22,6 +26,61 @@
 #define ENABLE_DEBUG 0
 #include "debug.h"
 
+#if ARCHITECTURE_WORD_BITS >= 32
+/* Sums up 16-bit words of buf in network byte order. The one's complement
+ * sum does not depend on byte order (RFC 1071, section 2 (B)), so whole
+ * machine words are added up in host byte order and only the folded result
+ * is converted. */
+static uint16_t _sum_words(const uint8_t *buf, uint16_t len)
+{
+#if ARCHITECTURE_WORD_BITS == 64
+    uint64_t sum = 0;
+
+    for (; len >= sizeof(uint64_t); buf += sizeof(uint64_t), len -= sizeof(uint64_t)) {
+        uint64_t word;
+
+        memcpy(&word, buf, sizeof(word));
+        sum += word;
+        sum += (sum < word);    /* end-around carry */
+    }
+    sum = (sum & 0xffffffff) + (sum >> 32);
+#else
+    uint64_t sum = 0;
+#endif
+    /* a 64-bit accumulator takes up to 2^32 32-bit words without overflow */
+    for (; len >= sizeof(uint32_t); buf += sizeof(uint32_t), len -= sizeof(uint32_t)) {
+        uint32_t word;
+
+        memcpy(&word, buf, sizeof(word));
+        sum += word;
+    }
+    if (len >= sizeof(uint16_t)) {
+        uint16_t word;
+
+        memcpy(&word, buf, sizeof(word));
+        sum += word;
+    }
+    sum = (sum & 0xffffffff) + (sum >> 32);
+    sum = (sum & 0xffffffff) + (sum >> 32);
+    sum = (sum & 0xffff) + (sum >> 16);
+    sum = (sum & 0xffff) + (sum >> 16);
+    return byteorder_ntohs((network_uint16_t){ .u16 = sum });
+}
+#else   /* ARCHITECTURE_WORD_BITS >= 32 */
+static uint16_t _sum_words(const uint8_t *buf, uint16_t len)
+{
+    uint32_t sum = 0;
+
+    /* 2^15 16-bit words can not overflow a 32-bit accumulator */
+    for (unsigned i = 0; i < (len >> 1); buf += 2, i++) {
+        sum += (uint16_t)(*buf << 8) + *(buf + 1);
+    }
+    sum = (sum & 0xffff) + (sum >> 16);
+    sum = (sum & 0xffff) + (sum >> 16);
+    return sum;
+}
+#endif  /* ARCHITECTURE_WORD_BITS >= 32 */
+
 uint16_t inet_csum_slice(uint16_t sum, const uint8_t *buf, uint16_t len, size_t accum_len)
 {
     uint32_t csum = sum;
@@ -47,10 +106,8 @@ uint16_t inet_csum_slice(uint16_t sum, const uint8_t *buf, uint16_t len, size_t
         accum_len++;
     }
 
-    for (unsigned i = 0; i < (len >> 1); buf += 2, i++) {
-        csum += (uint16_t)(*buf << 8) + *(buf + 1); /* group bytes by 16-byte words */
-                                                    /* and add them */
-    }
+    csum += _sum_words(buf, len & ~1U);
+    buf += len & ~1U;
 
     if ((accum_len + len) & 1)          /* if accumulated length is odd */
         csum += (uint16_t)(*buf << 8);  /* add last byte as top half of 16-byte word */
@@ -65,4 +122,19 @@ uint16_t inet_csum_slice(uint16_t sum, const uint8_t *buf, uint16_t len, size_t
     return csum;
 }
 
+uint16_t inet_csum_update(uint16_t csum, const uint8_t *old,
+                          const uint8_t *new_data, uint16_t len)
+{
+    /* RFC 1624, eqn. 3: HC' = ~(~HC + ~m + m') */
+    uint32_t sum = (uint16_t)~csum;
+
+    assert(!(len & 1));
+    sum += (uint16_t)~inet_csum(0, old, len);
+    sum += inet_csum(0, new_data, len);
+    while (sum >> 16) {
+        sum = (sum & 0xffff) + (sum >> 16);
+    }
+    return ~sum;
+}
+
 /** @} */
@@ -27,6 +27,12 @@
 #include "net/gnrc.h"
 #include "net/gnrc/ipv6/nib.h"
 #include "net/gnrc/ipv6.h"
+#if IS_USED(MODULE_GNRC_IPV6_BLACKLIST)
+#include "net/gnrc/ipv6/blacklist.h"
+#endif /* IS_USED(MODULE_GNRC_IPV6_BLACKLIST) */
+#if IS_USED(MODULE_GNRC_IPV6_WHITELIST)
+#include "net/gnrc/ipv6/whitelist.h"
+#endif /* IS_USED(MODULE_GNRC_IPV6_WHITELIST) */
 #if IS_USED(MODULE_GNRC_NETIF_PKTQ)
 #include "net/gnrc/netif/pktq.h"
 #endif /* IS_USED(MODULE_GNRC_NETIF_PKTQ) */
@@ -39,6 +45,9 @@
 #include "fmt.h"
 #include "log.h"
 #include "sched.h"
+#if IS_USED(MODULE_TRACE_NETIF)
+#include "trace.h"
+#endif
 #if IS_USED(MODULE_ZTIMER)
 #include "ztimer.h"
 #endif
@@ -1506,6 +1515,15 @@ static void _init_from_device(gnrc_netif_t *netif)
     (void)res;
     assert(res == sizeof(tmp));
     netif->device_type = (uint8_t)tmp;
+    if (IS_USED(MODULE_GNRC_IPV6)) {
+        netopt_enable_t enable;
+
+        if ((dev->driver->get(dev, NETOPT_CSUM_OFFLOAD, &enable,
+                              sizeof(enable)) == sizeof(enable)) &&
+            (enable == NETOPT_ENABLE)) {
+            netif->flags |= GNRC_NETIF_FLAGS_CSUM_OFFLOAD;
+        }
+    }
     gnrc_netif_ipv6_init_mtu(netif);
     _update_l2addr_from_dev(netif);
 }
@@ -1926,6 +1944,9 @@ static void _send(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt, bool push_back)
     /* Split off the TX sync snip */
     gnrc_pktsnip_t *tx_sync = IS_USED(MODULE_GNRC_TX_SYNC)
                             ? gnrc_tx_sync_split(pkt) : NULL;
+#if IS_USED(MODULE_TRACE_NETIF)
+    trace_event(TRACE_NETIF_TX, netif->pid, gnrc_pkt_len(pkt));
+#endif
     int res = netif->ops->send(netif, pkt);
 
     /* For legacy netdevs (no confirm_send) TX is blocking, thus it is always
@@ -2075,6 +2096,139 @@ static void _pass_on_packet(gnrc_pktsnip_t *pkt)
     }
 }
 
+#if IS_USED(MODULE_GNRC_NETIF_IPV6_FASTFWD)
+static bool _ipv6_fastfwd_eligible(const ipv6_hdr_t *hdr)
+{
+    const ipv6_addr_t *dst = &hdr->dst;
+
+    switch (hdr->nh) {
+        /* no extension headers that the IPv6 thread may need to look at */
+        case PROTNUM_ICMPV6:
+        case PROTNUM_TCP:
+        case PROTNUM_UDP:
+            break;
+        default:
+            return false;
+    }
+    /* hop limits of 0 and 1 require an ICMPv6 error or a drop */
+    return (hdr->hl > 1) &&
+           !ipv6_addr_is_multicast(dst) && !ipv6_addr_is_loopback(dst) &&
+           !ipv6_addr_is_unspecified(dst) && !ipv6_addr_is_link_local(dst) &&
+           !ipv6_addr_is_link_local(&hdr->src) &&
+#if IS_USED(MODULE_GNRC_IPV6_WHITELIST)
+           gnrc_ipv6_whitelisted(&hdr->src) &&
+#endif
+#if IS_USED(MODULE_GNRC_IPV6_BLACKLIST)
+           !gnrc_ipv6_blacklisted(&hdr->src) &&
+#endif
+           /* the IPv6 thread must be the only one interested in IPv6
+            * packets, otherwise other subscribers would miss forwarded
+            * packets */
+           (gnrc_netreg_num(GNRC_NETTYPE_IPV6, GNRC_NETREG_DEMUX_CTX_ALL) == 1) &&
+           (gnrc_netif_get_by_ipv6_addr(dst) == NULL);
+}
+
+/**
+ * @brief   Forwards a received IPv6 packet directly to the egress interface
+ *          without a round trip through the IPv6 thread
+ *
+ * Only plain unicast packets with an already resolved next hop take this
+ * path. Everything that needs an ICMPv6 error, NIB state changes, or
+ * extension header processing is left to the IPv6 thread.
+ *
+ * @param[in] netif The receiving interface.
+ * @param[in] pkt   A packet in receive order as returned by
+ *                  gnrc_netif_ops_t::recv().
+ *
+ * @return  true, if @p pkt was consumed.
+ * @return  false, if @p pkt should be passed on to the IPv6 thread.
+ */
+static bool _ipv6_fastfwd(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt)
+{
+    gnrc_pktsnip_t *netif_hdr = pkt->next;
+    gnrc_ipv6_nib_nc_t nce;
+    gnrc_netif_t *egress;
+    ipv6_hdr_t *hdr = pkt->data;
+    size_t ipv6_len;
+
+    if ((pkt->type != GNRC_NETTYPE_IPV6) || (pkt->users > 1) ||
+        (netif_hdr == NULL) || (netif_hdr->type != GNRC_NETTYPE_NETIF) ||
+        (netif_hdr->next != NULL) || (netif_hdr->users > 1) ||
+        (pkt->size < sizeof(ipv6_hdr_t)) || !ipv6_hdr_is(hdr)) {
+        return false;
+    }
+    ipv6_len = byteorder_ntohs(hdr->len);
+    if ((ipv6_len == 0) || ((ipv6_len + sizeof(ipv6_hdr_t)) > pkt->size) ||
+        !_ipv6_fastfwd_eligible(hdr) ||
+        (gnrc_ipv6_nib_get_next_hop_l2addr_cached(&hdr->dst, &nce) < 0)) {
+        return false;
+    }
+    egress = gnrc_netif_get_by_pid(gnrc_ipv6_nib_nc_get_iface(&nce));
+    if ((egress == NULL) || (egress->ipv6.mtu < (ipv6_len + sizeof(ipv6_hdr_t)))) {
+        return false;
+    }
+    DEBUG("gnrc_netif: fast-forward IPv6 packet from %u to %u\n",
+          netif->pid, egress->pid);
+#ifdef MODULE_NETSTATS_IPV6
+    unsigned irq_state = irq_disable();
+    netif->ipv6.stats.rx_count++;
+    netif->ipv6.stats.rx_bytes += pkt->size;
+    irq_restore(irq_state);
+#else
+    (void)netif;
+#endif
+    /* remove padding added by lower layers (e.g. ethernet) */
+    if ((ipv6_len + sizeof(ipv6_hdr_t)) < pkt->size) {
+        gnrc_pktbuf_realloc_data(pkt, ipv6_len + sizeof(ipv6_hdr_t));
+        hdr = pkt->data;
+    }
+    hdr->hl--;
+    /* separate IPv6 header from payload as the IPv6 thread would */
+    if (gnrc_pktbuf_mark(pkt, sizeof(ipv6_hdr_t), GNRC_NETTYPE_IPV6) == NULL) {
+        gnrc_pktbuf_release(pkt);
+        return true;
+    }
+    pkt->type = GNRC_NETTYPE_UNDEF;
+    pkt = gnrc_pktbuf_reverse_snips(gnrc_pktbuf_remove_snip(pkt, netif_hdr));
+    if (pkt == NULL) {
+        DEBUG("gnrc_netif: unable to reverse packet to send order\n");
+        return true;
+    }
+    netif_hdr = gnrc_netif_hdr_build(NULL, 0, nce.l2addr, nce.l2addr_len);
+    if (netif_hdr == NULL) {
+        DEBUG("gnrc_netif: unable to allocate netif header\n");
+        gnrc_pktbuf_release(pkt);
+        return true;
+    }
+    gnrc_netif_hdr_set_netif(netif_hdr->data, egress);
+    pkt = gnrc_pkt_prepend(pkt, netif_hdr);
+#ifdef MODULE_NETSTATS_IPV6
+    irq_state = irq_disable();
+    egress->ipv6.stats.tx_success++;
+    egress->ipv6.stats.tx_bytes += gnrc_pkt_len(pkt->next);
+    irq_restore(irq_state);
+#endif
+#ifdef MODULE_GNRC_SIXLOWPAN
+    if (gnrc_netif_is_6lo(egress)) {
+        if (!gnrc_netapi_dispatch_send(GNRC_NETTYPE_SIXLOWPAN,
+                                       GNRC_NETREG_DEMUX_CTX_ALL, pkt)) {
+            DEBUG("gnrc_netif: no 6LoWPAN thread found\n");
+            gnrc_pktbuf_release(pkt);
+        }
+        return true;
+    }
+#endif
+    if (egress == netif) {
+        _send(netif, pkt, false);
+    }
+    else if (gnrc_netif_send(egress, pkt) < 1) {
+        DEBUG("gnrc_netif: unable to send packet\n");
+        gnrc_pktbuf_release(pkt);
+    }
+    return true;
+}
+#endif /* IS_USED(MODULE_GNRC_NETIF_IPV6_FASTFWD) */
+
 static void _event_cb(netdev_t *dev, netdev_event_t event)
 {
     gnrc_netif_t *netif = (gnrc_netif_t *)dev->context;
@@ -2114,7 +2268,15 @@ static void _event_cb(netdev_t *dev, netdev_event_t event)
                  * Further packets will be sent on later TX_COMPLETE */
                 _send_queued_pkt(netif);
                 if (pkt) {
+#if IS_USED(MODULE_TRACE_NETIF)
+                    trace_event(TRACE_NETIF_RX, netif->pid, gnrc_pkt_len(pkt));
+#endif
                     _process_receive_stats(netif, pkt);
+#if IS_USED(MODULE_GNRC_NETIF_IPV6_FASTFWD)
+                    if (_ipv6_fastfwd(netif, pkt)) {
+                        break;
+                    }
+#endif
                     _pass_on_packet(pkt);
                 }
                 break;
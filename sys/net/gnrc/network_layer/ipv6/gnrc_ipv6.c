@@ -18,6 +18,7 @@
 #include <stdbool.h>
 
 #include "byteorder.h"
+#include "cib.h"
 #include "cpu_conf.h"
 #include "sched.h"
 #include "net/gnrc.h"
@@ -52,6 +53,12 @@
 static char _stack[GNRC_IPV6_STACK_SIZE + DEBUG_EXTRA_STACKSIZE];
 static msg_t _msg_q[GNRC_IPV6_MSG_QUEUE_SIZE];
 
+#if IS_USED(MODULE_GNRC_IPV6_PRIO_LANE)
+/* data packets held back while control messages are pending */
+static msg_t _bulk_q[GNRC_IPV6_BULK_QUEUE_SIZE];
+static cib_t _bulk_cib = CIB_INIT(GNRC_IPV6_BULK_QUEUE_SIZE);
+#endif
+
 #ifdef MODULE_FIB
 /**
  * @brief buffer to store the entries in the IPv6 forwarding table
@@ -171,6 +178,55 @@ static void _dispatch_next_header(gnrc_pktsnip_t *pkt, unsigned nh,
     }
 }
 
+#if IS_USED(MODULE_GNRC_IPV6_PRIO_LANE)
+static bool _is_bulk(const msg_t *msg)
+{
+    gnrc_pktsnip_t *pkt = msg->content.ptr;
+
+    switch (msg->type) {
+        case GNRC_NETAPI_MSG_TYPE_RCV:
+            /* the IPv6 header was not parsed yet, extension headers are
+             * treated as data */
+            return (pkt->size < sizeof(ipv6_hdr_t)) ||
+                   (((const ipv6_hdr_t *)pkt->data)->nh != PROTNUM_ICMPV6);
+        case GNRC_NETAPI_MSG_TYPE_SND:
+            return gnrc_pktsnip_search_type(pkt, GNRC_NETTYPE_ICMPV6) == NULL;
+        default:
+            return false;
+    }
+}
+
+/* receives the next message, but holds back data packets as long as other
+ * messages are pending */
+static void _receive_msg(msg_t *msg)
+{
+    while (1) {
+        if ((cib_avail(&_bulk_cib) > 0) && (msg_avail() == 0)) {
+            *msg = _bulk_q[cib_get_unsafe(&_bulk_cib)];
+            return;
+        }
+        msg_receive(msg);
+        if (!_is_bulk(msg)) {
+            return;
+        }
+        if (cib_full(&_bulk_cib)) {
+            /* keep order of data packets: handle the oldest one first */
+            msg_t tmp = _bulk_q[cib_get_unsafe(&_bulk_cib)];
+
+            _bulk_q[cib_put_unsafe(&_bulk_cib)] = *msg;
+            *msg = tmp;
+            return;
+        }
+        _bulk_q[cib_put_unsafe(&_bulk_cib)] = *msg;
+    }
+}
+#else   /* IS_USED(MODULE_GNRC_IPV6_PRIO_LANE) */
+static inline void _receive_msg(msg_t *msg)
+{
+    msg_receive(msg);
+}
+#endif  /* IS_USED(MODULE_GNRC_IPV6_PRIO_LANE) */
+
 static void *_event_loop(void *args)
 {
     msg_t msg, reply;
@@ -193,7 +249,7 @@ static void *_event_loop(void *args)
     /* start event loop */
     while (1) {
         DEBUG("ipv6: waiting for incoming message.\n");
-        msg_receive(&msg);
+        _receive_msg(&msg);
 
         switch (msg.type) {
             case GNRC_NETAPI_MSG_TYPE_RCV:
@@ -238,6 +294,7 @@ static void *_event_loop(void *args)
             case GNRC_IPV6_NIB_ABR_TIMEOUT:
             case GNRC_IPV6_NIB_PFX_TIMEOUT:
             case GNRC_IPV6_NIB_RTR_TIMEOUT:
+            case GNRC_IPV6_NIB_ROUTE_TIMEOUT:
             case GNRC_IPV6_NIB_RECALC_REACH_TIME:
             case GNRC_IPV6_NIB_REREG_ADDRESS:
             case GNRC_IPV6_NIB_DAD:
@@ -334,7 +391,10 @@ static bool _is_ipv6_hdr(gnrc_pktsnip_t *hdr)
 #endif
 }
 
-static int _fill_ipv6_hdr(gnrc_netif_t *netif, gnrc_pktsnip_t *ipv6)
+/* loopback: packet is not handed to the device, so the checksum can't be
+ * offloaded */
+static int _fill_ipv6_hdr(gnrc_netif_t *netif, gnrc_pktsnip_t *ipv6,
+                          bool loopback)
 {
     int res;
     ipv6_hdr_t *hdr = ipv6->data;
@@ -434,6 +494,12 @@ static int _fill_ipv6_hdr(gnrc_netif_t *netif, gnrc_pktsnip_t *ipv6)
         prev->next = payload;
         prev = payload;
     }
+    if (!loopback && (netif != NULL) &&
+        (netif->flags & GNRC_NETIF_FLAGS_CSUM_OFFLOAD) &&
+        !gnrc_netif_is_6lo(netif)) {
+        DEBUG("ipv6: checksum for upper header is calculated by device.\n");
+        return 0;
+    }
     DEBUG("ipv6: calculate checksum for upper header.\n");
     if ((res = gnrc_netreg_calc_csum(payload, ipv6)) < 0) {
         if (res != -ENOENT) {   /* if there is no checksum we are okay */
@@ -447,9 +513,9 @@ static int _fill_ipv6_hdr(gnrc_netif_t *netif, gnrc_pktsnip_t *ipv6)
 }
 
 static bool _safe_fill_ipv6_hdr(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt,
-                                bool prep_hdr)
+                                bool prep_hdr, bool loopback)
 {
-    if (prep_hdr && (_fill_ipv6_hdr(netif, pkt) < 0)) {
+    if (prep_hdr && (_fill_ipv6_hdr(netif, pkt, loopback) < 0)) {
         /* error on filling up header */
         gnrc_pktbuf_release(pkt);
         return false;
@@ -506,7 +572,7 @@ static void _send_unicast(gnrc_pktsnip_t *pkt, bool prep_hdr,
     }
     netif = gnrc_netif_get_by_pid(gnrc_ipv6_nib_nc_get_iface(&nce));
     assert(netif != NULL);
-    if (_safe_fill_ipv6_hdr(netif, pkt, prep_hdr)) {
+    if (_safe_fill_ipv6_hdr(netif, pkt, prep_hdr, false)) {
         DEBUG("ipv6: add interface header to packet\n");
         if ((pkt = _create_netif_hdr(nce.l2addr, nce.l2addr_len, pkt,
                                      netif_hdr_flags)) == NULL) {
@@ -596,7 +662,7 @@ static void _send_multicast(gnrc_pktsnip_t *pkt, bool prep_hdr,
                         gnrc_pktbuf_release(pkt);
                         return;
                     }
-                    if (_fill_ipv6_hdr(netif, send_pkt) < 0) {
+                    if (_fill_ipv6_hdr(netif, send_pkt, false) < 0) {
                         /* error on filling up header */
                         if (send_pkt != pkt) {
                             gnrc_pktbuf_release(send_pkt);
@@ -610,7 +676,7 @@ static void _send_multicast(gnrc_pktsnip_t *pkt, bool prep_hdr,
             }
         }
         else {
-            if (_safe_fill_ipv6_hdr(netif, pkt, prep_hdr)) {
+            if (_safe_fill_ipv6_hdr(netif, pkt, prep_hdr, false)) {
                 _send_multicast_over_iface(pkt, prep_hdr, netif, netif_hdr_flags);
             }
         }
@@ -625,7 +691,7 @@ static void _send_multicast(gnrc_pktsnip_t *pkt, bool prep_hdr,
                 return;
             }
         }
-        if (_safe_fill_ipv6_hdr(netif, pkt, prep_hdr)) {
+        if (_safe_fill_ipv6_hdr(netif, pkt, prep_hdr, false)) {
             _send_multicast_over_iface(pkt, prep_hdr, netif, netif_hdr_flags);
         }
     }
@@ -635,7 +701,7 @@ static void _send_to_self(gnrc_pktsnip_t *pkt, bool prep_hdr,
                           gnrc_netif_t *netif)
 {
     /* _safe_fill_ipv6_hdr releases pkt on error */
-    if (!_safe_fill_ipv6_hdr(netif, pkt, prep_hdr)) {
+    if (!_safe_fill_ipv6_hdr(netif, pkt, prep_hdr, true)) {
         DEBUG("ipv6: error looping packet to sender.\n");
         return;
     }
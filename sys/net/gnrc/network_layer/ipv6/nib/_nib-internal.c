@@ -45,6 +45,18 @@ static _nib_dr_entry_t _def_routers[CONFIG_GNRC_IPV6_NIB_DEFAULT_ROUTER_NUMOF];
 #if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_MULTIHOP_P6C)
 static _nib_abr_entry_t _abrs[CONFIG_GNRC_IPV6_NIB_ABR_NUMOF];
 #endif  /* CONFIG_GNRC_IPV6_NIB_MULTIHOP_P6C */
+#if CONFIG_GNRC_IPV6_NIB_OFFL_HASH_BUCKETS > 0
+/* index + 1 of the first entry in each bucket */
+static uint16_t _dsts_hash[CONFIG_GNRC_IPV6_NIB_OFFL_HASH_BUCKETS];
+#endif
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_ROUTER) && \
+    (CONFIG_GNRC_IPV6_NIB_ROUTE_WHEEL_SLOTS > 0)
+/* index + 1 of the first entry in each slot */
+static uint16_t _route_wheel[CONFIG_GNRC_IPV6_NIB_ROUTE_WHEEL_SLOTS];
+static evtimer_msg_event_t _route_wheel_tick;
+static uint32_t _route_wheel_now;
+static unsigned _route_wheel_count;
+#endif
 static rmutex_t _nib_mutex = RMUTEX_INIT;
 
 static char addr_str[IPV6_ADDR_MAX_STR_LEN];
@@ -63,9 +75,18 @@ void _nib_init(void)
     memset(_nodes, 0, sizeof(_nodes));
     memset(_def_routers, 0, sizeof(_def_routers));
     memset(_dsts, 0, sizeof(_dsts));
+#if CONFIG_GNRC_IPV6_NIB_OFFL_HASH_BUCKETS > 0
+    memset(_dsts_hash, 0, sizeof(_dsts_hash));
+#endif
 #if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_MULTIHOP_P6C)
     memset(_abrs, 0, sizeof(_abrs));
 #endif  /* CONFIG_GNRC_IPV6_NIB_MULTIHOP_P6C */
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_ROUTER) && \
+    (CONFIG_GNRC_IPV6_NIB_ROUTE_WHEEL_SLOTS > 0)
+    memset(_route_wheel, 0, sizeof(_route_wheel));
+    _route_wheel_now = 0;
+    _route_wheel_count = 0;
+#endif
 #endif  /* TEST_SUITES */
     evtimer_init_msg(&_nib_evtimer);
     /* TODO: load ABR information from persistent memory */
@@ -475,6 +496,47 @@ void _nib_drl_ft_get(const _nib_dr_entry_t *drl, gnrc_ipv6_nib_ft_t *fte)
     fte->iface = _nib_onl_get_if(drl->next_hop);
 }
 
+#if CONFIG_GNRC_IPV6_NIB_OFFL_HASH_BUCKETS > 0
+static uint16_t *_offl_hash_bucket(const ipv6_addr_t *pfx, unsigned pfx_len)
+{
+    ipv6_addr_t key;
+    uint32_t hash = pfx_len;
+
+    /* only the first pfx_len bits identify the prefix */
+    ipv6_addr_set_unspecified(&key);
+    ipv6_addr_init_prefix(&key, pfx, pfx_len);
+    for (unsigned i = 0; i < ARRAY_SIZE(key.u32); i++) {
+        hash = (hash ^ key.u32[i].u32) * 0x9e3779b1U;
+    }
+    return &_dsts_hash[(hash >> 16) % CONFIG_GNRC_IPV6_NIB_OFFL_HASH_BUCKETS];
+}
+
+static void _offl_hash_link(_nib_offl_entry_t *dst)
+{
+    uint16_t *bucket = _offl_hash_bucket(&dst->pfx, dst->pfx_len);
+
+    dst->hash_next = *bucket;
+    *bucket = (dst - _dsts) + 1;
+}
+
+static void _offl_hash_unlink(_nib_offl_entry_t *dst)
+{
+    uint16_t *ptr = _offl_hash_bucket(&dst->pfx, dst->pfx_len);
+    uint16_t idx = (dst - _dsts) + 1;
+
+    while (*ptr && (*ptr != idx)) {
+        ptr = &_dsts[*ptr - 1].hash_next;
+    }
+    if (*ptr) {
+        *ptr = dst->hash_next;
+    }
+    dst->hash_next = 0;
+}
+#else   /* CONFIG_GNRC_IPV6_NIB_OFFL_HASH_BUCKETS > 0 */
+#define _offl_hash_link(dst)        (void)dst
+#define _offl_hash_unlink(dst)      (void)dst
+#endif  /* CONFIG_GNRC_IPV6_NIB_OFFL_HASH_BUCKETS > 0 */
+
 _nib_offl_entry_t *_nib_offl_alloc(const ipv6_addr_t *next_hop, unsigned iface,
                                    const ipv6_addr_t *pfx, unsigned pfx_len)
 {
@@ -489,33 +551,30 @@ _nib_offl_entry_t *_nib_offl_alloc(const ipv6_addr_t *next_hop, unsigned iface,
           iface);
     DEBUG("pfx = %s/%u)\n", ipv6_addr_to_str(addr_str, pfx,
                                              sizeof(addr_str)), pfx_len);
-    for (unsigned i = 0; i < CONFIG_GNRC_IPV6_NIB_OFFL_NUMOF; i++) {
-        _nib_offl_entry_t *tmp = &_dsts[i];
+    _nib_offl_entry_t *tmp = NULL;
+
+    while ((tmp = _nib_offl_iter_pfx(tmp, pfx, pfx_len))) {
         _nib_onl_entry_t *tmp_node = tmp->next_hop;
 
-        if (tmp->mode == _EMPTY) {
-            if (dst == NULL) {
-                dst = tmp;
-            }
-            continue;
-        }
-
-        /* else: offlink entry not empty, potential match */
-        if (tmp->pfx_len == pfx_len && ipv6_addr_match_prefix(&tmp->pfx, pfx) >= pfx_len) {
-            /* prefix matches */
-            assert(tmp_node);
-            if (_nib_onl_get_if(tmp_node) == iface && (ipv6_addr_is_unspecified(&tmp_node->ipv6)
-                                                       || _addr_equals(next_hop, tmp_node))) {
-                /* next hop matches or is unspecified */
-                DEBUG("  %p is an exact match\n", (void *)tmp);
-                if (next_hop != NULL) {
-                    /* sets next_hop if it was previously unspecified */
-                    memcpy(&tmp_node->ipv6, next_hop, sizeof(tmp_node->ipv6));
-                }
-                /*mark that this NCE is used by an offl_entry*/
-                tmp->next_hop->mode |= _DST;
-                return tmp;
+        /* prefix matches */
+        assert(tmp_node);
+        if (_nib_onl_get_if(tmp_node) == iface && (ipv6_addr_is_unspecified(&tmp_node->ipv6)
+                                                   || _addr_equals(next_hop, tmp_node))) {
+            /* next hop matches or is unspecified */
+            DEBUG("  %p is an exact match\n", (void *)tmp);
+            if (next_hop != NULL) {
+                /* sets next_hop if it was previously unspecified */
+                memcpy(&tmp_node->ipv6, next_hop, sizeof(tmp_node->ipv6));
             }
+            /*mark that this NCE is used by an offl_entry*/
+            tmp->next_hop->mode |= _DST;
+            return tmp;
+        }
+    }
+    for (unsigned i = 0; i < CONFIG_GNRC_IPV6_NIB_OFFL_NUMOF; i++) {
+        if (_dsts[i].mode == _EMPTY) {
+            dst = &_dsts[i];
+            break;
         }
     }
     if (dst != NULL) {
@@ -526,8 +585,13 @@ _nib_offl_entry_t *_nib_offl_alloc(const ipv6_addr_t *next_hop, unsigned iface,
         }
         _override_node(next_hop, iface, dst->next_hop);
         dst->next_hop->mode |= _DST;
+        if (dst->pfx_len > 0) {
+            /* stale entry that never got a mode */
+            _offl_hash_unlink(dst);
+        }
         ipv6_addr_init_prefix(&dst->pfx, pfx, pfx_len);
         dst->pfx_len = pfx_len;
+        _offl_hash_link(dst);
     }
     return dst;
 }
@@ -566,6 +630,9 @@ void _nib_offl_clear(_nib_offl_entry_t *dst)
                 _nib_onl_clear(dst->next_hop);
             }
         }
+        if (dst->pfx_len > 0) {
+            _offl_hash_unlink(dst);
+        }
         memset(dst, 0, sizeof(_nib_offl_entry_t));
     }
     else {
@@ -589,6 +656,35 @@ _nib_offl_entry_t *_nib_offl_iter(const _nib_offl_entry_t *last)
     return NULL;
 }
 
+_nib_offl_entry_t *_nib_offl_iter_pfx(const _nib_offl_entry_t *last,
+                                      const ipv6_addr_t *pfx, unsigned pfx_len)
+{
+#if CONFIG_GNRC_IPV6_NIB_OFFL_HASH_BUCKETS > 0
+    uint16_t next = (last) ? last->hash_next : *_offl_hash_bucket(pfx, pfx_len);
+
+    while (next) {
+        _nib_offl_entry_t *dst = &_dsts[next - 1];
+
+        if ((dst->mode != _EMPTY) && (dst->pfx_len == pfx_len) &&
+            (ipv6_addr_match_prefix(&dst->pfx, pfx) >= pfx_len)) {
+            return dst;
+        }
+        next = dst->hash_next;
+    }
+    return NULL;
+#else   /* CONFIG_GNRC_IPV6_NIB_OFFL_HASH_BUCKETS > 0 */
+    _nib_offl_entry_t *dst = (_nib_offl_entry_t *)last;
+
+    while ((dst = _nib_offl_iter(dst))) {
+        if ((dst->pfx_len == pfx_len) &&
+            (ipv6_addr_match_prefix(&dst->pfx, pfx) >= pfx_len)) {
+            return dst;
+        }
+    }
+    return NULL;
+#endif  /* CONFIG_GNRC_IPV6_NIB_OFFL_HASH_BUCKETS > 0 */
+}
+
 bool _nib_offl_is_entry(const _nib_offl_entry_t *entry)
 {
     return (entry >= _dsts) && _in_dsts(entry);
@@ -638,6 +734,89 @@ void _nib_ft_get(const _nib_offl_entry_t *dst, gnrc_ipv6_nib_ft_t *fte)
     }
 }
 
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_ROUTER) && \
+    (CONFIG_GNRC_IPV6_NIB_ROUTE_WHEEL_SLOTS > 0)
+static inline uint16_t _route_wheel_idx(const _nib_offl_entry_t *dst)
+{
+    return (dst - _dsts) + 1;
+}
+
+void _nib_ft_clear_timeout(_nib_offl_entry_t *dst)
+{
+    if (dst->route_until == 0) {
+        return;
+    }
+    if (dst->route_prev) {
+        _dsts[dst->route_prev - 1].route_next = dst->route_next;
+    }
+    else {
+        _route_wheel[dst->route_until %
+                     CONFIG_GNRC_IPV6_NIB_ROUTE_WHEEL_SLOTS] = dst->route_next;
+    }
+    if (dst->route_next) {
+        _dsts[dst->route_next - 1].route_prev = dst->route_prev;
+    }
+    dst->route_until = 0;
+    dst->route_prev = 0;
+    dst->route_next = 0;
+    if (--_route_wheel_count == 0) {
+        _evtimer_del(&_route_wheel_tick);
+    }
+}
+
+void _nib_ft_set_timeout(_nib_offl_entry_t *dst, uint32_t ltime_ms)
+{
+    uint16_t *slot;
+
+    assert(ltime_ms > 0);
+    _nib_ft_clear_timeout(dst);
+    /* add one tick so that the route never expires early, as the next tick
+     * may be due any moment */
+    dst->route_until = _route_wheel_now +
+                       (ltime_ms / CONFIG_GNRC_IPV6_NIB_ROUTE_WHEEL_TICK_MS) + 1;
+    if (dst->route_until == 0) {
+        /* 0 marks entries not in the wheel */
+        dst->route_until++;
+    }
+    slot = &_route_wheel[dst->route_until % CONFIG_GNRC_IPV6_NIB_ROUTE_WHEEL_SLOTS];
+    dst->route_prev = 0;
+    dst->route_next = *slot;
+    if (*slot) {
+        _dsts[*slot - 1].route_prev = _route_wheel_idx(dst);
+    }
+    *slot = _route_wheel_idx(dst);
+    if (_route_wheel_count++ == 0) {
+        _evtimer_add(NULL, GNRC_IPV6_NIB_ROUTE_TIMEOUT, &_route_wheel_tick,
+                     CONFIG_GNRC_IPV6_NIB_ROUTE_WHEEL_TICK_MS);
+    }
+}
+
+void _nib_ft_handle_timeout(void *ctx)
+{
+    uint16_t next;
+
+    (void)ctx;
+    _route_wheel_now++;
+    next = _route_wheel[_route_wheel_now % CONFIG_GNRC_IPV6_NIB_ROUTE_WHEEL_SLOTS];
+    while (next) {
+        _nib_offl_entry_t *dst = &_dsts[next - 1];
+
+        next = dst->route_next;
+        /* the slot also holds entries expiring in later rounds */
+        if ((int32_t)(dst->route_until - _route_wheel_now) <= 0) {
+            DEBUG("nib: route to %s/%u expired\n",
+                  ipv6_addr_to_str(addr_str, &dst->pfx, sizeof(addr_str)),
+                  dst->pfx_len);
+            _nib_ft_remove(dst);
+        }
+    }
+    if (_route_wheel_count > 0) {
+        _evtimer_add(NULL, GNRC_IPV6_NIB_ROUTE_TIMEOUT, &_route_wheel_tick,
+                     CONFIG_GNRC_IPV6_NIB_ROUTE_WHEEL_TICK_MS);
+    }
+}
+#endif
+
 int _nib_get_route(const ipv6_addr_t *dst, gnrc_pktsnip_t *pkt,
                    gnrc_ipv6_nib_ft_t *fte)
 {
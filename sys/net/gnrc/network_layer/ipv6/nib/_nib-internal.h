@@ -34,6 +34,7 @@
 #ifdef MODULE_GNRC_IPV6
 #include "net/gnrc/ipv6.h"
 #endif
+#include "net/gnrc/ipv6/nib.h"
 #include "net/gnrc/ipv6/nib/ft.h"
 #include "net/gnrc/ipv6/nib/nc.h"
 #include "net/gnrc/ipv6/nib/conf.h"
@@ -207,10 +208,32 @@ typedef struct {
      */
     evtimer_msg_event_t pfx_timeout;
 #if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_ROUTER)
+#if (CONFIG_GNRC_IPV6_NIB_ROUTE_WHEEL_SLOTS > 0) || defined(DOXYGEN)
+    /**
+     * @brief   Timer wheel tick at which the route expires (0 if it does not
+     *          expire)
+     *
+     * @note    Only available if @ref CONFIG_GNRC_IPV6_NIB_ROUTE_WHEEL_SLOTS
+     *          is not 0.
+     */
+    uint32_t route_until;
+    uint16_t route_prev;        /**< index + 1 of previous entry in wheel slot */
+    uint16_t route_next;        /**< index + 1 of next entry in wheel slot */
+#else
     /**
      * @brief   Event for @ref GNRC_IPV6_NIB_ROUTE_TIMEOUT
      */
     evtimer_msg_event_t route_timeout;
+#endif
+#endif
+#if (CONFIG_GNRC_IPV6_NIB_OFFL_HASH_BUCKETS > 0) || defined(DOXYGEN)
+    /**
+     * @brief   index + 1 of next entry in the same prefix hash bucket
+     *
+     * @note    Only available if @ref CONFIG_GNRC_IPV6_NIB_OFFL_HASH_BUCKETS
+     *          is not 0.
+     */
+    uint16_t hash_next;
 #endif
     uint8_t mode;               /**< [mode](@ref net_gnrc_ipv6_nib_mode) of the
                                  *   off-link entry */
@@ -603,6 +626,18 @@ void _nib_offl_clear(_nib_offl_entry_t *dst);
  */
 _nib_offl_entry_t *_nib_offl_iter(const _nib_offl_entry_t *last);
 
+/**
+ * @brief   Iterates over off-link entries with a given prefix
+ *
+ * @param[in] last      Last entry (NULL to start).
+ * @param[in] pfx       The prefix.
+ * @param[in] pfx_len   The length of @p pfx in bits.
+ *
+ * @return  entry after @p last with exactly the prefix @p pfx/@p pfx_len.
+ */
+_nib_offl_entry_t *_nib_offl_iter_pfx(const _nib_offl_entry_t *last,
+                                      const ipv6_addr_t *pfx, unsigned pfx_len);
+
 /**
  * @brief   Checks if @p entry was allocated using _nib_offl_alloc()
  *
@@ -779,11 +814,60 @@ static inline _nib_offl_entry_t *_nib_ft_add(const ipv6_addr_t *next_hop,
  *
  * @note    Only available if @ref CONFIG_GNRC_IPV6_NIB_ROUTER.
  */
-static inline void _nib_ft_remove(_nib_offl_entry_t *nib_offl)
+#if (CONFIG_GNRC_IPV6_NIB_ROUTE_WHEEL_SLOTS > 0) || defined(DOXYGEN)
+/**
+ * @brief   Sets the lifetime of a forwarding table entry
+ *
+ * @param[in,out] nib_offl    An entry.
+ * @param[in] ltime_ms        Lifetime in milliseconds. Must not be 0.
+ *
+ * @note    Only available if @ref CONFIG_GNRC_IPV6_NIB_ROUTER.
+ */
+void _nib_ft_set_timeout(_nib_offl_entry_t *nib_offl, uint32_t ltime_ms);
+
+/**
+ * @brief   Stops the lifetime of a forwarding table entry
+ *
+ * @param[in,out] nib_offl    An entry.
+ *
+ * @note    Only available if @ref CONFIG_GNRC_IPV6_NIB_ROUTER.
+ */
+void _nib_ft_clear_timeout(_nib_offl_entry_t *nib_offl);
+
+/**
+ * @brief   Handles a @ref GNRC_IPV6_NIB_ROUTE_TIMEOUT event
+ *
+ * @param[in] ctx   Context of the event.
+ *
+ * @note    Only available if @ref CONFIG_GNRC_IPV6_NIB_ROUTER.
+ */
+void _nib_ft_handle_timeout(void *ctx);
+#else   /* CONFIG_GNRC_IPV6_NIB_ROUTE_WHEEL_SLOTS > 0 */
+static inline void _nib_ft_set_timeout(_nib_offl_entry_t *nib_offl,
+                                       uint32_t ltime_ms)
+{
+    _evtimer_add(nib_offl, GNRC_IPV6_NIB_ROUTE_TIMEOUT,
+                 &nib_offl->route_timeout, ltime_ms);
+}
+
+static inline void _nib_ft_clear_timeout(_nib_offl_entry_t *nib_offl)
 {
     _evtimer_del(&nib_offl->route_timeout);
+}
+#endif  /* CONFIG_GNRC_IPV6_NIB_ROUTE_WHEEL_SLOTS > 0 */
+
+static inline void _nib_ft_remove(_nib_offl_entry_t *nib_offl)
+{
+    _nib_ft_clear_timeout(nib_offl);
     _nib_offl_remove(nib_offl, _FT);
 }
+
+#if CONFIG_GNRC_IPV6_NIB_ROUTE_WHEEL_SLOTS == 0
+static inline void _nib_ft_handle_timeout(void *ctx)
+{
+    _nib_ft_remove(ctx);
+}
+#endif  /* CONFIG_GNRC_IPV6_NIB_ROUTE_WHEEL_SLOTS == 0 */
 #endif  /* CONFIG_GNRC_IPV6_NIB_ROUTER */
 
 #if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_MULTIHOP_P6C) || defined(DOXYGEN)
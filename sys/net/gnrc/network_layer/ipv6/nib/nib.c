@@ -397,6 +397,88 @@ int gnrc_ipv6_nib_get_next_hop_l2addr(const ipv6_addr_t *dst,
     return res;
 }
 
+#if IS_USED(MODULE_GNRC_NETIF_IPV6_FASTFWD)
+static bool _cached_l2addr(_nib_onl_entry_t *entry, gnrc_ipv6_nib_nc_t *nce)
+{
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_ARSM)
+    if ((entry == NULL) || !(entry->mode & _NC) || (entry->l2addr_len == 0) ||
+        !_is_reachable(entry) ||
+        /* leave NUD state transitions to the regular path */
+        (_get_nud_state(entry) == GNRC_IPV6_NIB_NC_INFO_NUD_STATE_STALE)) {
+        return false;
+    }
+    _nib_nc_get(entry, nce);
+    return true;
+#else   /* CONFIG_GNRC_IPV6_NIB_ARSM */
+    /* without address resolution the link-layer address is derived by the
+     * regular path */
+    (void)entry;
+    (void)nce;
+    return false;
+#endif  /* CONFIG_GNRC_IPV6_NIB_ARSM */
+}
+
+static bool _has_offl_match(const ipv6_addr_t *dst)
+{
+    _nib_offl_entry_t *entry = NULL;
+
+    while ((entry = _nib_offl_iter(entry))) {
+        if (ipv6_addr_match_prefix(dst, &entry->pfx) >= entry->pfx_len) {
+            return true;
+        }
+    }
+    return false;
+}
+
+int gnrc_ipv6_nib_get_next_hop_l2addr_cached(const ipv6_addr_t *dst,
+                                             gnrc_ipv6_nib_nc_t *nce)
+{
+    int res = -EHOSTUNREACH;
+
+    assert((dst != NULL) && (nce != NULL));
+    _nib_acquire();
+    do {    /* XXX: hidden goto ;-) */
+        _nib_onl_entry_t *node = _nib_onl_nc_get(dst, 0);
+        unsigned iface = 0;
+
+        if ((node != NULL) || _on_link(dst, &iface)) {
+            if (_cached_l2addr(node, nce)) {
+                res = 0;
+            }
+            break;
+        }
+
+        gnrc_ipv6_nib_ft_t route;
+
+        /* do not trigger route requests, the regular path handles those */
+        if ((_nib_drl_iter(NULL) == NULL) && !_has_offl_match(dst)) {
+            res = -ENETUNREACH;
+            break;
+        }
+        if (_nib_get_route(dst, NULL, &route) < 0) {
+            res = -ENETUNREACH;
+            break;
+        }
+        if (ipv6_addr_is_unspecified(&route.next_hop)) {
+            memcpy(&route.next_hop, dst, sizeof(route.next_hop));
+        }
+        node = _nib_onl_nc_get(&route.next_hop, route.iface);
+        if (_cached_l2addr(node, nce)) {
+            gnrc_netif_t *netif = gnrc_netif_get_by_pid(route.iface);
+
+            if (netif != NULL) {
+                _call_route_info_cb(netif, GNRC_IPV6_NIB_ROUTE_INFO_TYPE_RN,
+                                    &route.dst,
+                                    (void *)((intptr_t)route.dst_len));
+            }
+            res = 0;
+        }
+    } while (0);
+    _nib_release();
+    return res;
+}
+#endif  /* MODULE_GNRC_NETIF_IPV6_FASTFWD */
+
 void gnrc_ipv6_nib_handle_pkt(gnrc_netif_t *netif, const ipv6_hdr_t *ipv6,
                               const icmpv6_hdr_t *icmpv6, size_t icmpv6_len)
 {
@@ -470,7 +552,7 @@ void gnrc_ipv6_nib_handle_timer_event(void *ctx, uint16_t type)
             _handle_snd_mc_ra(ctx);
             break;
         case GNRC_IPV6_NIB_ROUTE_TIMEOUT:
-            _nib_ft_remove(ctx);
+            _nib_ft_handle_timeout(ctx);
             break;
 #endif  /* CONFIG_GNRC_IPV6_NIB_ROUTER */
 #if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_6LR)
@@ -82,8 +82,7 @@ int gnrc_ipv6_nib_ft_add(const ipv6_addr_t *dst, unsigned dst_len,
             res = -ENOMEM;
         }
         else if (ltime_ms > 0) {
-            _evtimer_add(ptr, GNRC_IPV6_NIB_ROUTE_TIMEOUT,
-                         &ptr->route_timeout, ltime_ms);
+            _nib_ft_set_timeout(ptr, ltime_ms);
         }
     }
 #else /* CONFIG_GNRC_IPV6_NIB_ROUTER */
@@ -95,6 +94,55 @@ int gnrc_ipv6_nib_ft_add(const ipv6_addr_t *dst, unsigned dst_len,
     return res;
 }
 
+int gnrc_ipv6_nib_ft_replace(const ipv6_addr_t *dst, unsigned dst_len,
+                             const ipv6_addr_t *next_hop, unsigned iface,
+                             uint32_t ltime)
+{
+    if ((dst == NULL) || (dst_len == 0) || ipv6_addr_is_unspecified(dst)) {
+        gnrc_ipv6_nib_ft_del(dst, dst_len);
+        return gnrc_ipv6_nib_ft_add(dst, dst_len, next_hop, iface, ltime);
+    }
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_ROUTER)
+    _nib_offl_entry_t *entry, *next;
+    int res;
+
+    if (iface == 0) {
+        return -EINVAL;
+    }
+    dst_len = (dst_len > 128) ? 128 : dst_len;
+    _nib_acquire();
+    /* remove routes via other next hops, _nib_ft_add() will find a remaining
+     * route via next_hop and just update it */
+    for (entry = _nib_offl_iter_pfx(NULL, dst, dst_len); entry != NULL;
+         entry = next) {
+        /* removing entry may unlink it from the iteration */
+        next = _nib_offl_iter_pfx(entry, dst, dst_len);
+        if (!(entry->mode & _FT)) {
+            continue;
+        }
+        if ((entry->next_hop == NULL) ||
+            (_nib_onl_get_if(entry->next_hop) != iface) ||
+            (next_hop == NULL) ||
+            !ipv6_addr_equal(&entry->next_hop->ipv6, next_hop)) {
+            _nib_ft_remove(entry);
+        }
+        else if (ltime == 0) {
+            /* route becomes permanent */
+            _nib_ft_clear_timeout(entry);
+        }
+    }
+    /* NIB mutex is recursive, so the update is atomic */
+    res = gnrc_ipv6_nib_ft_add(dst, dst_len, next_hop, iface, ltime);
+    _nib_release();
+    return res;
+#else /* CONFIG_GNRC_IPV6_NIB_ROUTER */
+    (void)next_hop;
+    (void)iface;
+    (void)ltime;
+    return -ENOTSUP;
+#endif
+}
+
 void gnrc_ipv6_nib_ft_del(const ipv6_addr_t *dst, unsigned dst_len)
 {
     _nib_acquire();
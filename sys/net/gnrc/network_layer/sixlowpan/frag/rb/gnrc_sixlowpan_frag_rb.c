@@ -16,6 +16,7 @@
 #include <assert.h>
 #include <inttypes.h>
 #include <stdbool.h>
+#include <stdint.h>
 
 #include "net/ieee802154.h"
 #include "net/ipv6.h"
@@ -63,6 +64,32 @@ static gnrc_sixlowpan_frag_rb_int_t rbuf_int[RBUF_INT_SIZE];
 
 static gnrc_sixlowpan_frag_rb_t rbuf[CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE];
 
+#if IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_RB_HASH)
+#define RBUF_HASH_MASK  (CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_HASH_SIZE - 1)
+
+static_assert((CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_HASH_SIZE &
+               RBUF_HASH_MASK) == 0,
+              "CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_HASH_SIZE must be a power of two");
+static_assert(CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_HASH_SIZE < UINT8_MAX,
+              "CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_HASH_SIZE too large");
+static_assert(CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE < UINT8_MAX,
+              "CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE too large for hashing");
+
+/* All indices below are stored incremented by one, so 0 marks the end of a
+ * chain / an unchained entry and the arrays need no further initialization.
+ * Entries are only re-chained when their slot is reused for a new datagram,
+ * so a chain may contain removed entries, which are skipped on look-up. */
+/* first entry of each bucket's chain */
+static uint8_t _rbuf_hash[CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_HASH_SIZE];
+/* next entry in the chain of the respective reassembly buffer entry */
+static uint8_t _rbuf_hash_next[CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE];
+/* bucket the respective reassembly buffer entry is chained into */
+static uint8_t _rbuf_hash_bucket[CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE];
+#endif  /* IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_RB_HASH) */
+
+/* wildcard for the datagram size in _rbuf_find() */
+#define RBUF_ANY_SIZE   (SIZE_MAX)
+
 static char l2addr_str[3 * IEEE802154_LONG_ADDRESS_LEN];
 
 static xtimer_t _gc_timer;
@@ -84,6 +111,10 @@ static int _rbuf_get(const void *src, size_t src_len,
                      const void *dst, size_t dst_len,
                      size_t size, uint16_t tag,
                      unsigned page);
+/* finds an existing entry by its tuple */
+static gnrc_sixlowpan_frag_rb_t *_rbuf_find(const void *src, size_t src_len,
+                                            const void *dst, size_t dst_len,
+                                            size_t size, uint16_t tag);
 /* gets an entry only by link-layer information and tag */
 static gnrc_sixlowpan_frag_rb_t *_rbuf_get_by_tag(const gnrc_netif_hdr_t *netif_hdr,
                                                   uint16_t tag);
@@ -114,12 +145,20 @@ static int _check_fragments(gnrc_sixlowpan_frag_rb_base_t *entry,
                             size_t frag_size, size_t offset)
 {
     gnrc_sixlowpan_frag_rb_int_t *ptr = entry->ints;
+    uint16_t end = (uint16_t)(offset + frag_size - 1);
 
     /* If the fragment overlaps another fragment and differs in either the size
      * or the offset of the overlapped fragment, discards the datagram
      * https://tools.ietf.org/html/rfc4944#section-5.3 */
     while (ptr != NULL) {
-        if (_rbuf_int_overlap_partially(ptr, offset, offset + frag_size - 1)) {
+        if (IS_ACTIVE(CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_MERGE_INTS) &&
+            (ptr->start <= offset) && (end <= ptr->end)) {
+            /* with merged intervals, the bounds of the original fragments
+             * are lost, so consider everything within a run a duplicate */
+            DEBUG("6lo rbuf: fragment already in reassembly buffer\n");
+            return RBUF_ADD_DUPLICATE;
+        }
+        if (_rbuf_int_overlap_partially(ptr, offset, end)) {
 
             /* "A fresh reassembly may be commenced with the most recently
              * received link fragment"
@@ -184,22 +223,105 @@ static gnrc_sixlowpan_frag_rb_t *_rbuf_get_by_tag(const gnrc_netif_hdr_t *netif_
                                                   uint16_t tag)
 {
     assert(netif_hdr != NULL);
-    const uint8_t *src = gnrc_netif_hdr_get_src_addr(netif_hdr);
-    const uint8_t *dst = gnrc_netif_hdr_get_dst_addr(netif_hdr);
-    const uint8_t src_len = netif_hdr->src_l2addr_len;
-    const uint8_t dst_len = netif_hdr->dst_l2addr_len;
 
+    return _rbuf_find(gnrc_netif_hdr_get_src_addr(netif_hdr),
+                      netif_hdr->src_l2addr_len,
+                      gnrc_netif_hdr_get_dst_addr(netif_hdr),
+                      netif_hdr->dst_l2addr_len,
+                      RBUF_ANY_SIZE, tag);
+}
+
+static bool _rbuf_match(const gnrc_sixlowpan_frag_rb_t *e,
+                        const void *src, size_t src_len,
+                        const void *dst, size_t dst_len,
+                        size_t size, uint16_t tag)
+{
+    if ((e->pkt == NULL) || (e->super.tag != tag) ||
+        (e->super.src_len != src_len) || (e->super.dst_len != dst_len)) {
+        return false;
+    }
+    if ((size != RBUF_ANY_SIZE) &&
+        /* not all SFR fragments carry the datagram size, so make 0 a legal
+         * value to not compare datagram size */
+        !(IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_SFR) && (size == 0)) &&
+        (e->super.datagram_size != size)) {
+        return false;
+    }
+    return (memcmp(e->super.src, src, src_len) == 0) &&
+           (memcmp(e->super.dst, dst, dst_len) == 0);
+}
+
+#if IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_RB_HASH)
+static unsigned _rbuf_hash_idx(const uint8_t *src, size_t src_len,
+                               const uint8_t *dst, size_t dst_len,
+                               uint16_t tag)
+{
+    uint32_t hash = tag;
+
+    for (unsigned i = 0; i < src_len; i++) {
+        hash = (hash * 31) + src[i];
+    }
+    for (unsigned i = 0; i < dst_len; i++) {
+        hash = (hash * 31) + dst[i];
+    }
+    return (hash ^ (hash >> 16)) & RBUF_HASH_MASK;
+}
+
+static void _rbuf_hash_unlink(unsigned idx)
+{
+    if (_rbuf_hash_bucket[idx] == 0) {
+        return;
+    }
+    uint8_t *ptr = &_rbuf_hash[_rbuf_hash_bucket[idx] - 1];
+
+    while (*ptr != 0) {
+        if (*ptr == (idx + 1)) {
+            *ptr = _rbuf_hash_next[idx];
+            break;
+        }
+        ptr = &_rbuf_hash_next[*ptr - 1];
+    }
+    _rbuf_hash_next[idx] = 0;
+    _rbuf_hash_bucket[idx] = 0;
+}
+
+static void _rbuf_hash_link(unsigned idx)
+{
+    const gnrc_sixlowpan_frag_rb_base_t *e = &rbuf[idx].super;
+    unsigned bucket = _rbuf_hash_idx(e->src, e->src_len, e->dst, e->dst_len,
+                                     e->tag);
+
+    _rbuf_hash_unlink(idx);
+    _rbuf_hash_next[idx] = _rbuf_hash[bucket];
+    _rbuf_hash[bucket] = idx + 1;
+    _rbuf_hash_bucket[idx] = bucket + 1;
+}
+#endif  /* IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_RB_HASH) */
+
+static gnrc_sixlowpan_frag_rb_t *_rbuf_find(const void *src, size_t src_len,
+                                            const void *dst, size_t dst_len,
+                                            size_t size, uint16_t tag)
+{
+#if IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_RB_HASH)
+    uint8_t idx = _rbuf_hash[_rbuf_hash_idx(src, src_len, dst, dst_len, tag)];
+
+    while (idx != 0) {
+        gnrc_sixlowpan_frag_rb_t *e = &rbuf[idx - 1];
+
+        if (_rbuf_match(e, src, src_len, dst, dst_len, size, tag)) {
+            return e;
+        }
+        idx = _rbuf_hash_next[idx - 1];
+    }
+#else   /* IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_RB_HASH) */
     for (unsigned i = 0; i < CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE; i++) {
         gnrc_sixlowpan_frag_rb_t *e = &rbuf[i];
 
-        if ((e->pkt != NULL) && (e->super.tag == tag) &&
-            (e->super.src_len == src_len) &&
-            (e->super.dst_len == dst_len) &&
-            (memcmp(e->super.src, src, src_len) == 0) &&
-            (memcmp(e->super.dst, dst, dst_len) == 0)) {
+        if (_rbuf_match(e, src, src_len, dst, dst_len, size, tag)) {
             return e;
         }
     }
+#endif  /* IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_RB_HASH) */
     return NULL;
 }
 
@@ -409,6 +531,9 @@ static int _rbuf_add(gnrc_netif_hdr_t *netif_hdr, gnrc_pktsnip_t *pkt,
     if (_rbuf_update_ints(entry.super, offset, frag_size)) {
         DEBUG("6lo rbuf: add fragment data\n");
         entry.super->current_size += (uint16_t)frag_size;
+#if IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_STATS)
+        entry.rbuf->frags++;
+#endif
         if (offset == 0) {
             if (IS_USED(MODULE_GNRC_SIXLOWPAN_IPHC) &&
                 sixlowpan_iphc_is(data)) {
@@ -541,6 +666,45 @@ static bool _rbuf_update_ints(gnrc_sixlowpan_frag_rb_base_t *entry,
     gnrc_sixlowpan_frag_rb_int_t *new;
     uint16_t end = (uint16_t)(offset + frag_size - 1);
 
+#if IS_ACTIVE(CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_MERGE_INTS)
+    gnrc_sixlowpan_frag_rb_int_t *lower = NULL, *upper = NULL, *ptr;
+
+    /* _check_fragments() ruled out overlaps, so at most one interval ends
+     * directly before and at most one starts directly after the fragment */
+    LL_FOREACH(entry->ints, ptr) {
+        if ((ptr->end + 1U) == offset) {
+            lower = ptr;
+        }
+        else if ((end + 1U) == ptr->start) {
+            upper = ptr;
+        }
+    }
+    if (lower != NULL) {
+        if (upper != NULL) {
+            /* fragment closes the gap between two intervals */
+            lower->end = upper->end;
+            LL_DELETE(entry->ints, upper);
+            upper->start = 0;
+            upper->end = 0;
+            upper->next = NULL;
+        }
+        else {
+            lower->end = end;
+        }
+        DEBUG("6lo rfrag: merged (%" PRIu16 ", %" PRIu16 ") into interval "
+              "(%" PRIu16 ", %" PRIu16 ")\n", offset, end, lower->start,
+              lower->end);
+        return true;
+    }
+    else if (upper != NULL) {
+        upper->start = offset;
+        DEBUG("6lo rfrag: merged (%" PRIu16 ", %" PRIu16 ") into interval "
+              "(%" PRIu16 ", %" PRIu16 ")\n", offset, end, upper->start,
+              upper->end);
+        return true;
+    }
+#endif  /* IS_ACTIVE(CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_MERGE_INTS) */
+
     new = _rbuf_int_get_free();
 
     if (new == NULL) {
@@ -565,15 +729,21 @@ static bool _rbuf_update_ints(gnrc_sixlowpan_frag_rb_base_t *entry,
     return true;
 }
 
+/* checks if an entry is only kept for CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_DEL_TIMER
+ * after its datagram was completed */
+static inline bool _rbuf_completed(const gnrc_sixlowpan_frag_rb_t *rbuf)
+{
+    return (CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_DEL_TIMER > 0) &&
+           (rbuf->super.current_size == 0);
+}
+
 static void _gc_pkt(gnrc_sixlowpan_frag_rb_t *rbuf)
 {
-#if CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_DEL_TIMER > 0
-    if (rbuf->super.current_size == 0) {
+    if (_rbuf_completed(rbuf)) {
         /* packet is scheduled for deletion, but was complete, i.e. pkt is
          * already handed up to other layer, i.e. no need to release */
         return;
     }
-#endif
     gnrc_pktbuf_release(rbuf->pkt);
 }
 
@@ -597,6 +767,11 @@ void gnrc_sixlowpan_frag_rb_gc(void)
                                          l2addr_str),
                   (unsigned)rbuf[i].super.datagram_size, rbuf[i].super.tag);
 
+#if IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_STATS)
+            if (!_rbuf_completed(&rbuf[i])) {
+                gnrc_sixlowpan_frag_stats_get()->rbuf_timeout++;
+            }
+#endif
             _gc_pkt(&rbuf[i]);
             gnrc_sixlowpan_frag_rb_remove(&(rbuf[i]));
         }
@@ -620,41 +795,27 @@ static int _rbuf_get(const void *src, size_t src_len,
     gnrc_sixlowpan_frag_rb_t *res = NULL, *oldest = NULL;
     uint32_t now_usec = xtimer_now_usec();
 
-    for (unsigned int i = 0; i < CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE; i++) {
-        /* check first if entry already available */
-        if ((rbuf[i].pkt != NULL) && (rbuf[i].super.tag == tag) &&
-            ((IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_SFR) &&
-              /* not all SFR fragments carry the datagram size, so make 0 a
-               * legal value to not compare datagram size */
-              ((size == 0) || (rbuf[i].super.datagram_size == size))) ||
-             (!IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_SFR) &&
-              (rbuf[i].super.datagram_size == size))) &&
-            (rbuf[i].super.src_len == src_len) &&
-            (rbuf[i].super.dst_len == dst_len) &&
-            (memcmp(rbuf[i].super.src, src, src_len) == 0) &&
-            (memcmp(rbuf[i].super.dst, dst, dst_len) == 0)) {
-            DEBUG("6lo rfrag: entry %p (%s, ", (void *)(&rbuf[i]),
-                  gnrc_netif_addr_to_str(rbuf[i].super.src,
-                                         rbuf[i].super.src_len,
-                                         l2addr_str));
-            DEBUG("%s, %u, %u) found\n",
-                  gnrc_netif_addr_to_str(rbuf[i].super.dst,
-                                         rbuf[i].super.dst_len,
-                                         l2addr_str),
-                  (unsigned)rbuf[i].super.datagram_size, rbuf[i].super.tag);
-#if CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_DEL_TIMER > 0
-            if (rbuf[i].super.current_size == 0) {
-                /* ensure that only empty reassembly buffer entries and entries
-                 * scheduled for deletion have `current_size == 0` */
-                DEBUG("6lo rfrag: scheduled for deletion, don't add fragment\n");
-                return -1;
-            }
-#endif
-            rbuf[i].super.arrival = now_usec;
-            _set_rbuf_timeout();
-            return i;
+    /* check first if entry already available */
+    if ((res = _rbuf_find(src, src_len, dst, dst_len, size, tag)) != NULL) {
+        DEBUG("6lo rfrag: entry %p (%s, ", (void *)res,
+              gnrc_netif_addr_to_str(res->super.src, res->super.src_len,
+                                     l2addr_str));
+        DEBUG("%s, %u, %u) found\n",
+              gnrc_netif_addr_to_str(res->super.dst, res->super.dst_len,
+                                     l2addr_str),
+              (unsigned)res->super.datagram_size, res->super.tag);
+        if (_rbuf_completed(res)) {
+            /* ensure that only empty reassembly buffer entries and entries
+             * scheduled for deletion have `current_size == 0` */
+            DEBUG("6lo rfrag: scheduled for deletion, don't add fragment\n");
+            return -1;
         }
+        res->super.arrival = now_usec;
+        _set_rbuf_timeout();
+        return res - &(rbuf[0]);
+    }
 
+    for (unsigned int i = 0; i < CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE; i++) {
         /* if there is a free spot: remember it */
         if ((res == NULL) && gnrc_sixlowpan_frag_rb_entry_empty(&rbuf[i])) {
             res = &(rbuf[i]);
@@ -678,6 +839,11 @@ static int _rbuf_get(const void *src, size_t src_len,
             ((now_usec - oldest->super.arrival) >
             CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_TIMEOUT_US)) {
             DEBUG("6lo rfrag: reassembly buffer full, remove oldest entry\n");
+#if IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_STATS)
+            if (!_rbuf_completed(oldest)) {
+                gnrc_sixlowpan_frag_stats_get()->rbuf_evicted++;
+            }
+#endif
             gnrc_pktbuf_release(oldest->pkt);
             gnrc_sixlowpan_frag_rb_remove(oldest);
             res = oldest;
@@ -742,6 +908,12 @@ static int _rbuf_get(const void *src, size_t src_len,
     res->super.dst_len = dst_len;
     res->super.tag = tag;
     res->super.current_size = 0;
+#if IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_STATS)
+    res->frags = 0;
+#endif
+#if IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_RB_HASH)
+    _rbuf_hash_link(res - &(rbuf[0]));
+#endif
 #if IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_SFR)
     res->offset_diff = 0U;
     memset(res->received, 0U, sizeof(res->received));
@@ -772,6 +944,11 @@ void gnrc_sixlowpan_frag_rb_reset(void)
         }
     }
     memset(rbuf, 0, sizeof(rbuf));
+#if IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_RB_HASH)
+    memset(_rbuf_hash, 0, sizeof(_rbuf_hash));
+    memset(_rbuf_hash_next, 0, sizeof(_rbuf_hash_next));
+    memset(_rbuf_hash_bucket, 0, sizeof(_rbuf_hash_bucket));
+#endif
 }
 
 const gnrc_sixlowpan_frag_rb_t *gnrc_sixlowpan_frag_rb_array(void)
@@ -812,20 +989,6 @@ static void _tmp_rm(gnrc_sixlowpan_frag_rb_t *rbuf)
 #endif  /* CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_DEL_TIMER */
 }
 
-#if IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_STATS)
-static inline unsigned _count_frags(gnrc_sixlowpan_frag_rb_t *rbuf)
-{
-    unsigned frags = 0;
-    gnrc_sixlowpan_frag_rb_int_t *frag = rbuf->super.ints;
-
-    while (frag) {
-        frag = frag->next;
-        frags++;
-    }
-    return frags;
-}
-#endif
-
 int gnrc_sixlowpan_frag_rb_dispatch_when_complete(gnrc_sixlowpan_frag_rb_t *rbuf,
                                                    gnrc_netif_hdr_t *netif_hdr)
 {
@@ -857,7 +1020,7 @@ int gnrc_sixlowpan_frag_rb_dispatch_when_complete(gnrc_sixlowpan_frag_rb_t *rbuf
         new_netif_hdr->rssi = netif_hdr->rssi;
         rbuf->pkt = gnrc_pkt_append(rbuf->pkt, netif);
 #if IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_STATS)
-        gnrc_sixlowpan_frag_stats_get()->fragments += _count_frags(rbuf);
+        gnrc_sixlowpan_frag_stats_get()->fragments += rbuf->frags;
         gnrc_sixlowpan_frag_stats_get()->datagrams++;
 #endif
         gnrc_sixlowpan_dispatch_recv(rbuf->pkt, NULL, 0);
@@ -19,6 +19,10 @@
 
 #include "pktbuf_internal.h"
 
+#if IS_USED(MODULE_TRACE_PKTBUF)
+#include "trace.h"
+#endif
+
 #define ENABLE_DEBUG 0
 #include "debug.h"
 
@@ -103,6 +107,9 @@ void gnrc_pktbuf_release_error(gnrc_pktsnip_t *pkt, uint32_t err)
 
         if (pkt->users == 1) {
             pkt->users = 0; /* not necessary but to be on the safe side */
+#if IS_USED(MODULE_TRACE_PKTBUF)
+            trace_event(TRACE_PKTBUF_FREE, (uintptr_t)pkt, pkt->size);
+#endif
             if (!IS_USED(MODULE_GNRC_TX_SYNC)
                 || (pkt->type != GNRC_NETTYPE_TX_SYNC)) {
                 gnrc_pktbuf_free_internal(pkt->data, pkt->size);
@@ -35,6 +35,10 @@
 
 #include "pktbuf_internal.h"
 
+#if IS_USED(MODULE_TRACE_PKTBUF)
+#include "trace.h"
+#endif
+
 #define ENABLE_DEBUG 0
 #include "debug.h"
 
@@ -109,6 +113,11 @@ gnrc_pktsnip_t *gnrc_pktbuf_add(gnrc_pktsnip_t *next, const void *data, size_t s
     mutex_lock(&gnrc_pktbuf_mutex);
     pkt = _create_snip(next, data, size, type);
     mutex_unlock(&gnrc_pktbuf_mutex);
+#if IS_USED(MODULE_TRACE_PKTBUF)
+    if (pkt) {
+        trace_event(TRACE_PKTBUF_ALLOC, (uintptr_t)pkt, size);
+    }
+#endif
     return pkt;
 }
 
@@ -512,12 +512,39 @@ static inline uint32_t _sec_to_ms(uint32_t sec)
 }
 
 /** @todo allow target prefixes in target options to be of variable length */
+/* Installs routes for num_targets target options, starting at first_target.
+ * Other options may be interleaved. */
+static void _update_targets(gnrc_rpl_dodag_t *dodag, gnrc_rpl_opt_t *first_target,
+                            unsigned num_targets, ipv6_addr_t *src, uint32_t lifetime)
+{
+    gnrc_rpl_opt_t *opt = first_target;
+
+    while (num_targets > 0) {
+        if (opt->type == GNRC_RPL_OPT_PAD1) {
+            opt = (gnrc_rpl_opt_t *)(((uint8_t *)opt) + 1);
+            continue;
+        }
+        if (opt->type == GNRC_RPL_OPT_TARGET) {
+            gnrc_rpl_opt_target_t *target = (gnrc_rpl_opt_target_t *)opt;
+
+            DEBUG("RPL: updating FT entry %s/%d\n",
+                  ipv6_addr_to_str(addr_str, &(target->target), sizeof(addr_str)),
+                  target->prefix_length);
+            gnrc_ipv6_nib_ft_replace(&(target->target), target->prefix_length, src,
+                                     dodag->iface, lifetime);
+            num_targets--;
+        }
+        opt = (gnrc_rpl_opt_t *)(((uint8_t *)(opt + 1)) + opt->length);
+    }
+}
+
 static bool _parse_options(int msg_type, gnrc_rpl_instance_t *inst, gnrc_rpl_opt_t *opt,
                            uint16_t len,
                            ipv6_addr_t *src, uint32_t *included_opts)
 {
     uint16_t len_parsed = 0;
     gnrc_rpl_opt_target_t *first_target = NULL;
+    unsigned num_targets = 0;
     gnrc_rpl_dodag_t *dodag = &inst->dodag;
     eui64_t iid;
 
@@ -632,19 +659,12 @@ static bool _parse_options(int msg_type, gnrc_rpl_instance_t *inst, gnrc_rpl_opt
             DEBUG("RPL: RPL TARGET DAO option parsed\n");
             *included_opts |= ((uint32_t)1) << GNRC_RPL_OPT_TARGET;
 
-            gnrc_rpl_opt_target_t *target = (gnrc_rpl_opt_target_t *)opt;
             if (first_target == NULL) {
-                first_target = target;
+                first_target = (gnrc_rpl_opt_target_t *)opt;
             }
-
-            DEBUG("RPL: adding FT entry %s/%d\n",
-                  ipv6_addr_to_str(addr_str, &(target->target), (unsigned)sizeof(addr_str)),
-                  target->prefix_length);
-
-            gnrc_ipv6_nib_ft_del(&(target->target), target->prefix_length);
-            gnrc_ipv6_nib_ft_add(&(target->target), target->prefix_length, src,
-                                 dodag->iface,
-                                 dodag->default_lifetime * dodag->lifetime_unit);
+            /* the route is installed once the lifetime is known from the
+             * following transit information option */
+            num_targets++;
             break;
 
         case (GNRC_RPL_OPT_TRANSIT):
@@ -657,24 +677,10 @@ static bool _parse_options(int msg_type, gnrc_rpl_instance_t *inst, gnrc_rpl_opt
                 break;
             }
 
-            do {
-                DEBUG("RPL: updating FT entry %s/%d\n",
-                      ipv6_addr_to_str(addr_str, &(first_target->target), sizeof(addr_str)),
-                      first_target->prefix_length);
-
-                gnrc_ipv6_nib_ft_del(&(first_target->target),
-                                     first_target->prefix_length);
-                gnrc_ipv6_nib_ft_add(&(first_target->target),
-                                     first_target->prefix_length, src,
-                                     dodag->iface,
-                                     transit->path_lifetime * dodag->lifetime_unit);
-
-                first_target = (gnrc_rpl_opt_target_t *)(((uint8_t *)(first_target)) +
-                                                         sizeof(gnrc_rpl_opt_t) +
-                                                         first_target->length);
-            }while (first_target->type == GNRC_RPL_OPT_TARGET);
-
+            _update_targets(dodag, (gnrc_rpl_opt_t *)first_target, num_targets, src,
+                            transit->path_lifetime * dodag->lifetime_unit);
             first_target = NULL;
+            num_targets = 0;
             break;
 
 #ifdef MODULE_GNRC_RPL_P2P
@@ -686,6 +692,11 @@ static bool _parse_options(int msg_type, gnrc_rpl_instance_t *inst, gnrc_rpl_opt
         len_parsed += opt->length + sizeof(gnrc_rpl_opt_t);
         opt = (gnrc_rpl_opt_t *)(((uint8_t *)(opt + 1)) + opt->length);
     }
+    if (first_target != NULL) {
+        /* targets without transit information option get the default lifetime */
+        _update_targets(dodag, (gnrc_rpl_opt_t *)first_target, num_targets, src,
+                        dodag->default_lifetime * dodag->lifetime_unit);
+    }
     return true;
 }
 
@@ -1224,7 +1235,10 @@ void gnrc_rpl_recv_DAO(gnrc_rpl_dao_t *dao, kernel_pid_t iface, ipv6_addr_t *src
         gnrc_rpl_send_DAO_ACK(inst, src, dao->dao_sequence);
     }
 
-    gnrc_rpl_delay_dao(dodag);
+    /* the root does not send DAOs, so there is nothing to aggregate */
+    if (dodag->node_status != GNRC_RPL_ROOT_NODE) {
+        gnrc_rpl_delay_dao(dodag);
+    }
 }
 
 void gnrc_rpl_recv_DAO_ACK(gnrc_rpl_dao_ack_t *dao_ack, kernel_pid_t iface, ipv6_addr_t *src,
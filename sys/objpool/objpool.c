@@ -0,0 +1,275 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_objpool
+ * @{
+ *
+ * @file
+ * @brief       Thread-safe object pool implementation
+ *
+ * @}
+ */
+
+#include <assert.h>
+#include <string.h>
+
+#include "irq.h"
+#include "objpool.h"
+#include "thread.h"
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+/* the head holds the index + 1 of the first object in the lower half and the
+ * tag in the upper half, the link of a free object is the index + 1 of the
+ * next one */
+#define IDX_MASK        (0xffffU)
+#define TAG_INC         (0x10000U)
+
+static inline uint8_t *_obj(const objpool_t *pool, unsigned link)
+{
+    return pool->data + (link - 1) * pool->size;
+}
+
+static inline unsigned _link(const objpool_t *pool, const void *ptr)
+{
+    size_t offset = (const uint8_t *)ptr - pool->data;
+
+    assert((offset % pool->size) == 0);
+    assert((offset / pool->size) < pool->num);
+    return (offset / pool->size) + 1;
+}
+
+/* The link is copied bytewise, as objects may not be aligned. It may be
+ * read from an object that was just allocated by another thread, the
+ * compare and swap then fails as the tag has changed. */
+static inline uint16_t _get_next(const objpool_t *pool, unsigned link)
+{
+    uint16_t next;
+
+    memcpy(&next, _obj(pool, link), sizeof(next));
+    return next;
+}
+
+static inline void _set_next(objpool_t *pool, unsigned link, uint16_t next)
+{
+    memcpy(_obj(pool, link), &next, sizeof(next));
+}
+
+static unsigned _pop(objpool_t *pool)
+{
+    uint_least32_t head = atomic_load_explicit(&pool->head,
+                                               memory_order_acquire);
+    uint_least32_t new_head;
+
+    do {
+        unsigned link = head & IDX_MASK;
+
+        if (link == 0) {
+            return 0;
+        }
+        new_head = ((head + TAG_INC) & ~IDX_MASK) | _get_next(pool, link);
+    } while (!atomic_compare_exchange_weak_explicit(&pool->head, &head,
+                                                    new_head,
+                                                    memory_order_acquire,
+                                                    memory_order_acquire));
+
+    return head & IDX_MASK;
+}
+
+/* push the objects from first to last, already linked to each other */
+static void _push(objpool_t *pool, unsigned first, unsigned last)
+{
+    uint_least32_t head = atomic_load_explicit(&pool->head,
+                                               memory_order_relaxed);
+    uint_least32_t new_head;
+
+    do {
+        _set_next(pool, last, head & IDX_MASK);
+        new_head = ((head + TAG_INC) & ~IDX_MASK) | first;
+    } while (!atomic_compare_exchange_weak_explicit(&pool->head, &head,
+                                                    new_head,
+                                                    memory_order_release,
+                                                    memory_order_relaxed));
+}
+
+#if IS_USED(MODULE_OBJPOOL_CACHE)
+static objpool_cache_t *_cache(objpool_t *pool)
+{
+    kernel_pid_t pid = thread_getpid();
+
+    if (!pool->caches || irq_is_in() || !pid_is_valid(pid)) {
+        return NULL;
+    }
+    return &pool->caches[pid - KERNEL_PID_FIRST];
+}
+
+/* put the oldest objects of the cache back to the shared list */
+static void _cache_put_back(objpool_t *pool, objpool_cache_t *cache,
+                            unsigned num)
+{
+    if (num == 0) {
+        return;
+    }
+    for (unsigned i = 0; i < num - 1; i++) {
+        _set_next(pool, cache->idx[i], cache->idx[i + 1]);
+    }
+    _push(pool, cache->idx[0], cache->idx[num - 1]);
+    cache->num -= num;
+    memmove(cache->idx, &cache->idx[num], cache->num * sizeof(cache->idx[0]));
+}
+
+void objpool_cache_init(objpool_t *pool, objpool_cache_t *caches)
+{
+    memset(caches, 0, MAXTHREADS * sizeof(*caches));
+    pool->caches = caches;
+}
+
+void objpool_cache_flush(objpool_t *pool)
+{
+    objpool_cache_t *cache = _cache(pool);
+
+    if (cache) {
+        _cache_put_back(pool, cache, cache->num);
+    }
+}
+#endif
+
+#if IS_USED(MODULE_OBJPOOL_STATS)
+static void _stats_alloc(objpool_t *pool)
+{
+    unsigned in_use = atomic_fetch_add_explicit(&pool->in_use, 1,
+                                                memory_order_relaxed) + 1;
+    unsigned high_water = atomic_load_explicit(&pool->high_water,
+                                               memory_order_relaxed);
+
+    while ((in_use > high_water) &&
+           !atomic_compare_exchange_weak_explicit(&pool->high_water,
+                                                  &high_water, in_use,
+                                                  memory_order_relaxed,
+                                                  memory_order_relaxed)) {}
+}
+
+void objpool_get_stats(objpool_t *pool, objpool_stats_t *stats)
+{
+    stats->in_use = atomic_load_explicit(&pool->in_use, memory_order_relaxed);
+    stats->high_water = atomic_load_explicit(&pool->high_water,
+                                             memory_order_relaxed);
+    stats->failures = atomic_load_explicit(&pool->failures,
+                                           memory_order_relaxed);
+}
+
+void objpool_reset_stats(objpool_t *pool)
+{
+    atomic_store_explicit(&pool->high_water,
+                          atomic_load_explicit(&pool->in_use,
+                                               memory_order_relaxed),
+                          memory_order_relaxed);
+    atomic_store_explicit(&pool->failures, 0, memory_order_relaxed);
+}
+#endif
+
+void objpool_init(objpool_t *pool, void *data, size_t size, size_t num)
+{
+    assert((pool != NULL) && (data != NULL) && (size >= sizeof(void *)) &&
+           (num != 0) && (num <= IDX_MASK));
+
+    DEBUG("objpool: initialize %p with %u times %u bytes at %p\n",
+          (void *)pool, (unsigned)num, (unsigned)size, data);
+
+    pool->data = data;
+    pool->size = size;
+    pool->num = num;
+    for (unsigned link = 1; link < num; link++) {
+        _set_next(pool, link, link + 1);
+    }
+    _set_next(pool, num, 0);
+    atomic_init(&pool->head, 1);
+#if IS_USED(MODULE_OBJPOOL_CACHE)
+    pool->caches = NULL;
+#endif
+#if IS_USED(MODULE_OBJPOOL_STATS)
+    atomic_init(&pool->in_use, 0);
+    atomic_init(&pool->high_water, 0);
+    atomic_init(&pool->failures, 0);
+#endif
+}
+
+void *objpool_alloc(objpool_t *pool)
+{
+    unsigned link = 0;
+
+    assert(pool != NULL);
+
+#if IS_USED(MODULE_OBJPOOL_CACHE)
+    objpool_cache_t *cache = _cache(pool);
+
+    if (cache && cache->num) {
+        link = cache->idx[--cache->num];
+    }
+#endif
+    if (link == 0) {
+        link = _pop(pool);
+    }
+    if (link == 0) {
+        DEBUG("objpool: %p is empty\n", (void *)pool);
+#if IS_USED(MODULE_OBJPOOL_STATS)
+        atomic_fetch_add_explicit(&pool->failures, 1, memory_order_relaxed);
+#endif
+        return NULL;
+    }
+#if IS_USED(MODULE_OBJPOOL_STATS)
+    _stats_alloc(pool);
+#endif
+    return _obj(pool, link);
+}
+
+void objpool_free(objpool_t *pool, void *ptr)
+{
+    assert((pool != NULL) && (ptr != NULL));
+
+    unsigned link = _link(pool, ptr);
+
+#if IS_USED(MODULE_OBJPOOL_STATS)
+    atomic_fetch_sub_explicit(&pool->in_use, 1, memory_order_relaxed);
+#endif
+#if IS_USED(MODULE_OBJPOOL_CACHE)
+    objpool_cache_t *cache = _cache(pool);
+
+    if (cache) {
+        if (cache->num == CONFIG_OBJPOOL_CACHE_SIZE) {
+            _cache_put_back(pool, cache, (CONFIG_OBJPOOL_CACHE_SIZE + 1) / 2);
+        }
+        cache->idx[cache->num++] = link;
+        return;
+    }
+#endif
+    _push(pool, link, link);
+}
+
+size_t objpool_available(objpool_t *pool)
+{
+    size_t num = 0;
+    unsigned link = atomic_load_explicit(&pool->head,
+                                         memory_order_acquire) & IDX_MASK;
+
+    /* bounded, the list may change while walking it */
+    while (link && (num < pool->num)) {
+        num++;
+        link = _get_next(pool, link);
+    }
+#if IS_USED(MODULE_OBJPOOL_CACHE)
+    if (pool->caches) {
+        for (unsigned i = 0; i < MAXTHREADS; i++) {
+            num += pool->caches[i].num;
+        }
+    }
+#endif
+    return (num < pool->num) ? num : pool->num;
+}
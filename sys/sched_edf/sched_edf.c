@@ -0,0 +1,81 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sched_edf
+ * @{
+ *
+ * @file
+ * @brief       Earliest Deadline First Scheduler implementation
+ *
+ * The ordering of the run queue is done in core/sched.c, this only manages
+ * the deadlines.
+ *
+ * @}
+ */
+
+#include "irq.h"
+#include "sched.h"
+#include "thread.h"
+#include "ztimer.h"
+#include "sched_edf.h"
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+void sched_edf_set_deadline(thread_t *thread, uint32_t deadline)
+{
+    sched_set_deadline(thread, deadline);
+
+    if (thread_is_active(thread) && !irq_is_in()) {
+        sched_switch(thread->priority);
+    }
+}
+
+void sched_edf_task_init(sched_edf_task_t *task, uint32_t period,
+                         uint32_t deadline)
+{
+    thread_t *me = thread_get_active();
+
+    task->release = ztimer_now(SCHED_EDF_TIMERBASE);
+    task->period = period;
+    task->deadline = deadline;
+    task->jobs = 0;
+    task->misses = 0;
+
+    /* the deadline has to be in place before joining the EDF run queue */
+    sched_edf_set_deadline(me, task->release + deadline);
+    sched_change_priority(me, CONFIG_SCHED_EDF_PRIO);
+}
+
+bool sched_edf_task_wait(sched_edf_task_t *task)
+{
+    thread_t *me = thread_get_active();
+    uint32_t now = ztimer_now(SCHED_EDF_TIMERBASE);
+    bool met = (now - task->release) <= task->deadline;
+
+    task->jobs++;
+    if (!met) {
+        task->misses++;
+        DEBUG("sched_edf: pid %" PRIkernel_pid " missed its deadline by %"
+              PRIu32 "\n", me->pid, now - task->release - task->deadline);
+    }
+
+    /* jobs are released at their nominal times even after an overrun, so
+     * that an overload shows up as missed deadlines */
+    task->release += task->period;
+    /* set before sleeping, so that the thread is woken up with it */
+    sched_edf_set_deadline(me, task->release + task->deadline);
+
+    uint32_t offset = task->release - ztimer_now(SCHED_EDF_TIMERBASE);
+    if (offset <= task->period) {
+        ztimer_sleep(SCHED_EDF_TIMERBASE, offset);
+    }
+
+    return met;
+}
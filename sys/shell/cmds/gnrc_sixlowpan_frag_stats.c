@@ -28,6 +28,8 @@ static int _gnrc_6lo_frag_stats(int argc, char **argv)
     (void)argc;
     (void)argv;
     printf("rbuf full: %u\n", stats->rbuf_full);
+    printf("rbuf timeouts: %u\n", stats->rbuf_timeout);
+    printf("rbuf evicted: %u\n", stats->rbuf_evicted);
     printf("frag full: %u\n", stats->frag_full);
 #ifdef MODULE_GNRC_SIXLOWPAN_FRAG_VRB
     printf("VRB full: %u\n", stats->vrb_full);
@@ -18,21 +18,38 @@
  * @}
  */
 
+#include <stdio.h>
+#include <string.h>
+
 #include "cpu_conf.h"
+#include "modules.h"
 #include "shell.h"
 
-#if defined(MODULE_NEWLIB_SYSCALLS_DEFAULT) || defined (HAVE_HEAP_STATS)
+#if defined(MODULE_TLSF_MALLOC)
+#include "tlsf-malloc.h"
+#endif
+
+#if defined(MODULE_NEWLIB_SYSCALLS_DEFAULT) || defined (HAVE_HEAP_STATS) || \
+    defined(MODULE_TLSF_MALLOC)
 extern void heap_stats(void);
-#else
-#include <stdio.h>
+#define HEAP_HAS_STATS  1
 #endif
 
 static int _heap_handler(int argc, char **argv)
 {
-    (void) argc;
-    (void) argv;
+#if defined(MODULE_TLSF_MALLOC_TAG)
+    if ((argc > 1) && (strcmp(argv[1], "allocs") == 0)) {
+        tlsf_malloc_print_allocs();
+        return 0;
+    }
+#endif
+    if (argc > 1) {
+        printf("usage: %s%s\n", argv[0],
+               IS_USED(MODULE_TLSF_MALLOC_TAG) ? " [allocs]" : "");
+        return 1;
+    }
 
-#if defined(MODULE_NEWLIB_SYSCALLS_DEFAULT) || defined (HAVE_HEAP_STATS)
+#if defined(HEAP_HAS_STATS)
     heap_stats();
     return 0;
 #else
@@ -0,0 +1,42 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_shell_commands
+ * @{
+ *
+ * @file
+ * @brief       Shell command for the mutex contention profile
+ *
+ * @}
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "mutex_profiling.h"
+#include "shell.h"
+
+static int _mutexprof_handler(int argc, char **argv)
+{
+    if (argc < 2) {
+        mutex_profiling_print();
+    }
+    else if (!strcmp(argv[1], "reset")) {
+        mutex_profiling_reset();
+    }
+    else {
+        printf("usage: %s [reset]\n", argv[0]);
+        return 1;
+    }
+
+    return 0;
+}
+
+SHELL_COMMAND(mutexprof, "Prints the mutex contention profile.",
+              _mutexprof_handler);
@@ -20,52 +20,283 @@
  * @}
  */
 
+#include <errno.h>
+#include <fcntl.h>
+#include <stdarg.h>
+#include <stdatomic.h>
+#include <stdbool.h>
 #include <stdio.h>
 
 #include "architecture.h"
 #include "irq.h"
+#include "msg.h"
+#include "thread.h"
+#include "trace.h"
 #include "ztimer.h"
 
+#if IS_USED(MODULE_VFS)
+#include "vfs.h"
+#endif
+
 #ifndef CONFIG_TRACE_BUFSIZE
 #define CONFIG_TRACE_BUFSIZE 512
 #endif
 
 typedef struct {
-    uint32_t time;
-    uint32_t val;
-} tracebuf_entry_t;
+    const char *name;
+    const char *arg_names[2];
+} trace_event_desc_t;
+
+static trace_record_t tracebuf[CONFIG_TRACE_BUFSIZE];
+static atomic_uint tracebuf_pos;
+
+/* tracepoints are enabled by auto_init, once ztimer can be used */
+volatile uint32_t trace_categories = TRACE_CAT_MASK(TRACE_CAT_USER);
+
+void trace_record(trace_event_t event, uint32_t arg0, uint32_t arg1)
+{
+    unsigned pos = atomic_fetch_add_explicit(&tracebuf_pos, 1,
+                                             memory_order_relaxed);
+    trace_record_t *rec = &tracebuf[pos % CONFIG_TRACE_BUFSIZE];
 
-static tracebuf_entry_t tracebuf[CONFIG_TRACE_BUFSIZE];
-static size_t tracebuf_pos;
+    rec->time = ztimer_now(ZTIMER_USEC);
+    rec->event = event;
+    rec->pid = irq_is_in() ? KERNEL_PID_ISR : thread_getpid();
+    rec->arg[0] = arg0;
+    rec->arg[1] = arg1;
+}
 
 void trace(uint32_t val)
+{
+    trace_event(TRACE_USER, val, 0);
+}
+
+void trace_enable(uint32_t categories)
 {
     unsigned state = irq_disable();
 
-    tracebuf[tracebuf_pos % CONFIG_TRACE_BUFSIZE] =
-        (tracebuf_entry_t){ .time = ztimer_now(ZTIMER_USEC), .val = val };
-    tracebuf_pos++;
+    trace_categories |= categories;
     irq_restore(state);
 }
 
+void trace_disable(uint32_t categories)
+{
+    unsigned state = irq_disable();
+
+    trace_categories &= ~categories;
+    irq_restore(state);
+}
+
+void trace_init(void)
+{
+    /* keep the timestamps running while the CPU sleeps */
+    ztimer_acquire(ZTIMER_USEC);
+    trace_enable(CONFIG_TRACE_CATEGORIES);
+}
+
+static const trace_event_desc_t *_desc(uint16_t event)
+{
+    static const trace_event_desc_t sched[] = {
+        { "sched_switch", { "prev", "next" } },
+    };
+    static const trace_event_desc_t msg[] = {
+        { "msg_send", { "target", "type" } },
+        { "msg_recv", { "sender", "type" } },
+    };
+    static const trace_event_desc_t pktbuf[] = {
+        { "pktbuf_alloc", { "snip", "size" } },
+        { "pktbuf_free", { "snip", "size" } },
+    };
+    static const trace_event_desc_t netif[] = {
+        { "netif_tx", { "netif", "len" } },
+        { "netif_rx", { "netif", "len" } },
+    };
+    static const trace_event_desc_t ztimer[] = {
+        { "ztimer_fire", { "timer", "callback" } },
+    };
+    static const trace_event_desc_t unknown = { "unknown", { "arg0", "arg1" } };
+    unsigned num = event & 0xff;
+
+    switch (event >> 8) {
+    case TRACE_CAT_SCHED:
+        return (num < ARRAY_SIZE(sched)) ? &sched[num] : &unknown;
+    case TRACE_CAT_MSG:
+        return (num < ARRAY_SIZE(msg)) ? &msg[num] : &unknown;
+    case TRACE_CAT_PKTBUF:
+        return (num < ARRAY_SIZE(pktbuf)) ? &pktbuf[num] : &unknown;
+    case TRACE_CAT_NETIF:
+        return (num < ARRAY_SIZE(netif)) ? &netif[num] : &unknown;
+    case TRACE_CAT_ZTIMER:
+        return (num < ARRAY_SIZE(ztimer)) ? &ztimer[num] : &unknown;
+    default:
+        return &unknown;
+    }
+}
+
+/* returns the number of entries and the position of the oldest one */
+static size_t _entries(unsigned *first)
+{
+    unsigned pos = atomic_load_explicit(&tracebuf_pos, memory_order_relaxed);
+    size_t n = pos > CONFIG_TRACE_BUFSIZE ? CONFIG_TRACE_BUFSIZE : pos;
+
+    *first = pos - n;
+    return n;
+}
+
 void trace_dump(void)
 {
-    size_t n = tracebuf_pos >
-               CONFIG_TRACE_BUFSIZE ? CONFIG_TRACE_BUFSIZE : tracebuf_pos;
+    unsigned first;
+    size_t n = _entries(&first);
     uint32_t t_last = 0;
 
     for (size_t i = 0; i < n; i++) {
-        printf("n=%4" PRIuSIZE " t=%s%8" PRIu32 " v=0x%08" PRIx32 "\n", i,
-               i ? "+" : " ",
-               tracebuf[i].time - t_last, tracebuf[i].val);
-        t_last = tracebuf[i].time;
+        const trace_record_t *rec = &tracebuf[(first + i) % CONFIG_TRACE_BUFSIZE];
+
+        if (rec->event == TRACE_USER) {
+            printf("n=%4" PRIuSIZE " t=%s%8" PRIu32 " v=0x%08" PRIx32 "\n", i,
+                   i ? "+" : " ", rec->time - t_last, rec->arg[0]);
+        }
+        else {
+            printf("n=%4" PRIuSIZE " t=%s%8" PRIu32 " %s 0x%08" PRIx32
+                   " 0x%08" PRIx32 "\n", i, i ? "+" : " ", rec->time - t_last,
+                   _desc(rec->event)->name, rec->arg[0], rec->arg[1]);
+        }
+        t_last = rec->time;
     }
 }
 
-void trace_reset(void)
+static void _print(trace_write_t write, void *arg, const char *fmt, ...)
 {
-    unsigned state = irq_disable();
+    char buf[160];
+    va_list args;
 
-    tracebuf_pos = 0;
-    irq_restore(state);
+    va_start(args, fmt);
+    int len = vsnprintf(buf, sizeof(buf), fmt, args);
+    va_end(args);
+
+    if (len > 0) {
+        write(arg, buf, (size_t)len < sizeof(buf) ? (size_t)len : sizeof(buf) - 1);
+    }
+}
+
+static void _export_names(trace_write_t write, void *arg)
+{
+    _print(write, arg, "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,"
+           "\"tid\":%u,\"args\":{\"name\":\"isr\"}}", (unsigned)KERNEL_PID_ISR);
+    for (kernel_pid_t pid = KERNEL_PID_FIRST; pid <= KERNEL_PID_LAST; pid++) {
+        const char *name = thread_getname(pid);
+
+        if (!thread_get(pid)) {
+            continue;
+        }
+        _print(write, arg, ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,"
+               "\"tid\":%u,\"args\":{\"name\":\"%s\"}}", (unsigned)pid,
+               name ? name : "thread");
+    }
+}
+
+void trace_export(trace_write_t write, void *arg)
+{
+    kernel_pid_t running = KERNEL_PID_UNDEF;
+    uint32_t categories = trace_categories;
+    unsigned first;
+    uint64_t ts = 0;
+    uint32_t t_last = 0;
+
+    trace_disable(TRACE_CAT_ALL);
+    size_t n = _entries(&first);
+
+    _print(write, arg, "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n");
+    _export_names(write, arg);
+    for (size_t i = 0; i < n; i++) {
+        const trace_record_t *rec = &tracebuf[(first + i) % CONFIG_TRACE_BUFSIZE];
+
+        /* 64 bit time stamps that do not wrap around, slots are reserved
+         * before the time is taken, so neighbours may be out of order */
+        ts = i ? ts + (int32_t)(rec->time - t_last) : rec->time;
+        t_last = rec->time;
+
+        if (rec->event == TRACE_SCHED_SWITCH) {
+            /* the previous thread is not known if it exited, but there is
+             * only one running thread anyway */
+            if (pid_is_valid(running)) {
+                _print(write, arg, ",\n{\"ph\":\"E\",\"ts\":%" PRIu64
+                       ",\"pid\":0,\"tid\":%u}", ts, (unsigned)running);
+            }
+            running = rec->arg[1];
+            if (pid_is_valid(running)) {
+                _print(write, arg, ",\n{\"name\":\"running\",\"ph\":\"B\","
+                       "\"ts\":%" PRIu64 ",\"pid\":0,\"tid\":%u}",
+                       ts, (unsigned)running);
+            }
+            continue;
+        }
+
+        const trace_event_desc_t *desc = _desc(rec->event);
+
+        if (rec->event == TRACE_USER) {
+            _print(write, arg, ",\n{\"name\":\"trace\",\"ph\":\"i\",\"s\":\"t\","
+                   "\"ts\":%" PRIu64 ",\"pid\":0,\"tid\":%u,"
+                   "\"args\":{\"val\":%" PRIu32 "}}",
+                   ts, (unsigned)rec->pid, rec->arg[0]);
+        }
+        else {
+            _print(write, arg, ",\n{\"name\":\"%s\",\"ph\":\"i\",\"s\":\"t\","
+                   "\"ts\":%" PRIu64 ",\"pid\":0,\"tid\":%u,"
+                   "\"args\":{\"%s\":%" PRIu32 ",\"%s\":%" PRIu32 "}}",
+                   desc->name, ts, (unsigned)rec->pid,
+                   desc->arg_names[0], rec->arg[0],
+                   desc->arg_names[1], rec->arg[1]);
+        }
+    }
+    if (pid_is_valid(running)) {
+        _print(write, arg, ",\n{\"ph\":\"E\",\"ts\":%" PRIu64
+               ",\"pid\":0,\"tid\":%u}", ts, (unsigned)running);
+    }
+    _print(write, arg, "\n]}\n");
+
+    trace_enable(categories);
+}
+
+static void _write_stdio(void *arg, const void *data, size_t len)
+{
+    (void)arg;
+    fwrite(data, 1, len, stdout);
+}
+
+void trace_export_stdio(void)
+{
+    trace_export(_write_stdio, NULL);
+    fflush(stdout);
+}
+
+#if IS_USED(MODULE_VFS)
+static void _write_file(void *arg, const void *data, size_t len)
+{
+    int *fd = arg;
+
+    if ((*fd >= 0) && (vfs_write(*fd, data, len) != (ssize_t)len)) {
+        vfs_close(*fd);
+        *fd = -EIO;
+    }
+}
+
+int trace_export_file(const char *path)
+{
+    int fd = vfs_open(path, O_CREAT | O_TRUNC | O_WRONLY, 0644);
+
+    if (fd < 0) {
+        return fd;
+    }
+    trace_export(_write_file, &fd);
+    if (fd < 0) {
+        return fd;
+    }
+    return vfs_close(fd);
+}
+#endif
+
+void trace_reset(void)
+{
+    atomic_store_explicit(&tracebuf_pos, 0, memory_order_relaxed);
 }
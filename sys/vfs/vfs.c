@@ -15,6 +15,7 @@
  */
 
 #include <errno.h> /* for error codes */
+#include <stdbool.h> /* for bool */
 #include <string.h> /* for strncmp */
 #include <stddef.h> /* for NULL */
 #include <sys/types.h> /* for off_t etc */
@@ -24,9 +25,11 @@
 #include <unistd.h> /* for STDIN_FILENO, STDOUT_FILENO, STDERR_FILENO */
 
 #include "atomic_utils.h"
+#include "bitfield.h"
 #include "clist.h"
 #include "compiler_hints.h"
 #include "container.h"
+#include "irq.h"
 #include "modules.h"
 #include "mutex.h"
 #include "sched.h"
@@ -75,6 +78,32 @@ static vfs_file_t _vfs_open_files[VFS_MAX_OPEN_FILES];
  */
 static clist_node_t _vfs_mounts_list;
 
+/**
+ * @internal
+ * @brief Mounted file systems ordered by descending length of the mount point
+ *
+ * Mount points of the same length are ordered from the most recently mounted
+ * to the least recently mounted one. The first mount point in this list that
+ * is a prefix of a path is the one to use for it.
+ */
+static vfs_mount_t *_vfs_mounts_by_len;
+
+/**
+ * @internal
+ * @brief Number of fds that are not handed out by automatic allocation
+ */
+#define _FD_RESERVED_NUMOF  (STDERR_FILENO + 1)
+
+/**
+ * @internal
+ * @brief Bitmap of the fds in use
+ *
+ * Bit i represents fd (i + _FD_RESERVED_NUMOF) % VFS_MAX_OPEN_FILES, so
+ * that the stdio fds are at the end, where automatic allocation does not look
+ * for a free fd.
+ */
+static BITFIELD(_vfs_fd_used, VFS_MAX_OPEN_FILES);
+
 /**
  * @internal
  * @brief Find an unused entry in the _vfs_open_files array and mark it as used
@@ -83,9 +112,8 @@ static clist_node_t _vfs_mounts_list;
  * corresponding slot in the open files table is already occupied, no iteration
  * is done to find another free number in this case.
  *
- * If the @p fd argument is negative, the algorithm will iterate through the
- * open files table until it find an unused slot and return the number of that
- * slot.
+ * If the @p fd argument is negative, the first unused slot that is not
+ * reserved for stdio is taken from the free fd bitmap and returned.
  *
  * @param[in]  fd  Desired fd number, use VFS_ANY_FD for any free fd
  *
@@ -146,7 +174,6 @@ static inline int _find_mount(vfs_mount_t **mountpp, const char *name, const cha
 static inline int _fd_is_valid(int fd);
 
 static mutex_t _mount_mutex = MUTEX_INIT;
-static mutex_t _open_mutex = MUTEX_INIT;
 
 int vfs_close(int fd)
 {
@@ -292,9 +319,7 @@ int vfs_open(const char *name, int flags, mode_t mode)
         DEBUG("vfs_open: no matching mount\n");
         return res;
     }
-    mutex_lock(&_open_mutex);
     int fd = _init_fd(VFS_ANY_FD, mountp->fs->f_op, mountp, flags, NULL);
-    mutex_unlock(&_open_mutex);
     if (fd < 0) {
         DEBUG("vfs_open: _init_fd: ERR %d!\n", fd);
         /* remember to decrement the open_files count */
@@ -391,6 +416,67 @@ ssize_t vfs_readline(int fd, char *dst, size_t len_max)
     return dst - start;
 }
 
+ssize_t vfs_read_extent(int fd, const void **data, size_t count)
+{
+    DEBUG("vfs_read_extent: %d, %p, %" PRIuSIZE "\n", fd, (void *)data, count);
+    vfs_file_t *filp = NULL;
+
+    int res = _prep_read(fd, data, &filp);
+    if (res) {
+        DEBUG("vfs_read_extent: can't open file - %d\n", res);
+        return res;
+    }
+    if (filp->f_op->read_extent == NULL) {
+        /* driver can't provide direct access */
+        return -ENOTSUP;
+    }
+
+    return filp->f_op->read_extent(filp, data, count);
+}
+
+ssize_t vfs_sendfile(int fd, vfs_sendfile_cb_t send, void *arg, size_t count,
+                     void *buf, size_t buf_len)
+{
+    DEBUG("vfs_sendfile: %d, %" PRIuSIZE "\n", fd, count);
+    bool direct = true;
+    ssize_t sum = 0;
+
+    while (count) {
+        iolist_t data = { .iol_next = NULL };
+        ssize_t res = -ENOTSUP;
+
+        if (direct) {
+            const void *extent;
+            res = vfs_read_extent(fd, &extent, count);
+            data.iol_base = (void *)extent;
+        }
+        if (res == -ENOTSUP && buf != NULL) {
+            /* fall back to copying the data */
+            direct = false;
+            res = vfs_read(fd, buf, count < buf_len ? count : buf_len);
+            data.iol_base = buf;
+        }
+        if (res <= 0) {
+            return sum ? sum : res;
+        }
+        data.iol_len = res;
+
+        ssize_t sent = send(arg, &data);
+        if (sent < 0) {
+            return sent;
+        }
+        sum += sent;
+        if (sent < res) {
+            /* leave the position behind the last byte sent */
+            res = vfs_lseek(fd, sent - res, SEEK_CUR);
+            return res < 0 ? res : sum;
+        }
+        count -= sent;
+    }
+
+    return sum;
+}
+
 ssize_t vfs_write(int fd, const void *src, size_t count)
 {
     DEBUG_NOT_STDOUT(fd, "vfs_write: %d, %p, %" PRIuSIZE "\n", fd, src, count);
@@ -560,6 +646,35 @@ static int check_mount(vfs_mount_t *mountp)
     return 0;
 }
 
+/*
+ * Inserts a mount point into the list ordered by mount point length,
+ * _mount_mutex must be held
+ */
+static void _lookup_insert(vfs_mount_t *mountp)
+{
+    vfs_mount_t **it = &_vfs_mounts_by_len;
+
+    while (*it && ((*it)->mount_point_len > mountp->mount_point_len)) {
+        it = &(*it)->lookup_next;
+    }
+    mountp->lookup_next = *it;
+    *it = mountp;
+}
+
+/*
+ * Removes a mount point from the list ordered by mount point length,
+ * _mount_mutex must be held
+ */
+static void _lookup_remove(vfs_mount_t *mountp)
+{
+    for (vfs_mount_t **it = &_vfs_mounts_by_len; *it; it = &(*it)->lookup_next) {
+        if (*it == mountp) {
+            *it = mountp->lookup_next;
+            break;
+        }
+    }
+}
+
 int vfs_format(vfs_mount_t *mountp)
 {
     DEBUG("vfs_format: %p\n", (void *)mountp);
@@ -600,6 +715,7 @@ int vfs_mount(vfs_mount_t *mountp)
     }
     /* Insert last in list. This property is relied on by vfs_iterate_mount_dirs. */
     clist_rpush(&_vfs_mounts_list, &mountp->list_entry);
+    _lookup_insert(mountp);
     mutex_unlock(&_mount_mutex);
     DEBUG("vfs_mount: mount done\n");
     return 0;
@@ -646,6 +762,7 @@ int vfs_umount(vfs_mount_t *mountp, bool force)
         mutex_unlock(&_mount_mutex);
         return -EINVAL;
     }
+    _lookup_remove(mountp);
     mutex_unlock(&_mount_mutex);
     return 0;
 }
@@ -901,9 +1018,7 @@ int vfs_bind(int fd, int flags, const vfs_file_ops_t *f_op, void *private_data)
     if (f_op == NULL) {
         return -EINVAL;
     }
-    mutex_lock(&_open_mutex);
     fd = _init_fd(fd, f_op, NULL, flags, private_data);
-    mutex_unlock(&_open_mutex);
     if (fd < 0) {
         DEBUG("vfs_bind: _init_fd: ERR %d!\n", fd);
         return fd;
@@ -1075,29 +1190,37 @@ const vfs_file_t *vfs_file_get(int fd)
     }
 }
 
+static inline unsigned _fd_bit(int fd)
+{
+    return (fd + VFS_MAX_OPEN_FILES - _FD_RESERVED_NUMOF) % VFS_MAX_OPEN_FILES;
+}
+
 static inline int _allocate_fd(int fd)
 {
     if (fd < 0) {
-        for (fd = 0; fd < VFS_MAX_OPEN_FILES; ++fd) {
-            if ((fd == STDIN_FILENO) || (fd == STDOUT_FILENO) || (fd == STDERR_FILENO)) {
-                /* Do not auto-allocate the stdio file descriptor numbers to
-                 * avoid conflicts between normal file system users and stdio
-                 * drivers such as stdio_uart, stdio_rtt which need to be able
-                 * to bind to these specific file descriptor numbers. */
-                continue;
-            }
-            if (_vfs_open_files[fd].pid == KERNEL_PID_UNDEF) {
-                break;
-            }
+        /* Do not auto-allocate the stdio file descriptor numbers to avoid
+         * conflicts between normal file system users and stdio drivers such
+         * as stdio_uart, stdio_rtt which need to be able to bind to these
+         * specific file descriptor numbers. */
+        fd = bf_get_unset(_vfs_fd_used, VFS_MAX_OPEN_FILES - _FD_RESERVED_NUMOF);
+        if (fd < 0) {
+            /* The _vfs_open_files array is full */
+            return -ENFILE;
         }
+        fd += _FD_RESERVED_NUMOF;
     }
-    if (fd >= VFS_MAX_OPEN_FILES) {
-        /* The _vfs_open_files array is full */
+    else if (fd >= VFS_MAX_OPEN_FILES) {
         return -ENFILE;
     }
-    else if (_vfs_open_files[fd].pid != KERNEL_PID_UNDEF) {
-        /* The desired fd is already in use */
-        return -EEXIST;
+    else {
+        unsigned state = irq_disable();
+        bool used = bf_isset(_vfs_fd_used, _fd_bit(fd));
+        bf_set(_vfs_fd_used, _fd_bit(fd));
+        irq_restore(state);
+        if (used) {
+            /* The desired fd is already in use */
+            return -EEXIST;
+        }
     }
     kernel_pid_t pid = thread_getpid();
     if (pid == KERNEL_PID_UNDEF) {
@@ -1117,6 +1240,7 @@ static inline void _free_fd(int fd)
         assume(before > 0);
     }
     _vfs_open_files[fd].pid = KERNEL_PID_UNDEF;
+    bf_unset_atomic(_vfs_fd_used, _fd_bit(fd));
 }
 
 static inline int _init_fd(int fd, const vfs_file_ops_t *f_op, vfs_mount_t *mountp, int flags, void *private_data)
@@ -1140,21 +1264,9 @@ static inline int _find_mount(vfs_mount_t **mountpp, const char *name, const cha
     size_t name_len = strlen(name);
     mutex_lock(&_mount_mutex);
 
-    clist_node_t *node = _vfs_mounts_list.next;
-    if (node == NULL) {
-        /* list empty */
-        mutex_unlock(&_mount_mutex);
-        return -ENOENT;
-    }
-    vfs_mount_t *mountp = NULL;
-    do {
-        node = node->next;
-        vfs_mount_t *it = container_of(node, vfs_mount_t, list_entry);
-        size_t len = it->mount_point_len;
-        if (len < longest_match) {
-            /* Already found a longer prefix */
-            continue;
-        }
+    vfs_mount_t *mountp = _vfs_mounts_by_len;
+    for (; mountp != NULL; mountp = mountp->lookup_next) {
+        size_t len = mountp->mount_point_len;
         if (len > name_len) {
             /* path name is shorter than the mount point name */
             continue;
@@ -1163,15 +1275,16 @@ static inline int _find_mount(vfs_mount_t **mountpp, const char *name, const cha
             /* name does not have a directory separator where mount point name ends */
             continue;
         }
-        if (strncmp(name, it->mount_point, len) == 0) {
-            /* mount_point is a prefix of name */
+        if (strncmp(name, mountp->mount_point, len) == 0) {
+            /* mount_point is a prefix of name, and the longest one as the
+             * list is ordered by length */
             /* special check for mount_point == "/" */
             if (len > 1) {
                 longest_match = len;
             }
-            mountp = it;
+            break;
         }
-    } while (node != _vfs_mounts_list.next);
+    }
     if (mountp == NULL) {
         /* not found */
         mutex_unlock(&_mount_mutex);
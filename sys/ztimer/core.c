@@ -33,6 +33,9 @@
 #endif
 #include "ztimer.h"
 #include "log.h"
+#if IS_USED(MODULE_TRACE_ZTIMER)
+#include "trace.h"
+#endif
 
 #define ENABLE_DEBUG 0
 #include "debug.h"
@@ -470,6 +473,10 @@ void ztimer_handler(ztimer_clock_t *clock)
             DEBUG("ztimer_handler(): trigger %p->%p at %" PRIu32 "\n",
                   (void *)entry, (void *)entry->base.next, clock->ops->now(
                       clock));
+#if IS_USED(MODULE_TRACE_ZTIMER)
+            trace_event(TRACE_ZTIMER_FIRE, (uintptr_t)entry,
+                        (uintptr_t)entry->callback);
+#endif
             entry->callback(entry->arg);
 #if MODULE_ZTIMER_ONDEMAND
             no_clock_user_left = ztimer_release(clock);
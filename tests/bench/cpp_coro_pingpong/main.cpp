@@ -0,0 +1,116 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Ping-pong between C++20 coroutines compared to threads
+ *
+ * @}
+ */
+
+#include <cstdio>
+
+#include "benchmark.h"
+#include "riot/condition_variable.hpp"
+#include "riot/coro.hpp"
+#include "riot/mutex.hpp"
+#include "riot/thread.hpp"
+
+#ifndef BENCH_RUNS
+#define BENCH_RUNS          (1000UL)
+#endif
+
+using namespace riot::coro;
+
+static notification _ping;
+static notification _pong;
+static bool _stop;
+
+static task<> _nop()
+{
+  co_return;
+}
+
+static task<> _ponger()
+{
+  while (true) {
+    co_await _pong.wait();
+    if (_stop) {
+      break;
+    }
+    _ping.notify();
+  }
+}
+
+static task<> _pinger()
+{
+  BENCHMARK_RUN("coro task call", BENCH_RUNS, co_await _nop());
+  BENCHMARK_RUN("coro yield", BENCH_RUNS, co_await yield());
+  BENCHMARK_RUN("coro pingpong", BENCH_RUNS,
+                (_pong.notify(), co_await _ping.wait()));
+
+  _stop = true;
+  _pong.notify();
+}
+
+static riot::mutex _mtx;
+static riot::condition_variable _cv_ping;
+static riot::condition_variable _cv_pong;
+static bool _pong_turn;
+
+static void _thread_ponger()
+{
+  riot::unique_lock<riot::mutex> lock(_mtx);
+
+  while (true) {
+    while (!_pong_turn) {
+      _cv_pong.wait(lock);
+    }
+    if (_stop) {
+      break;
+    }
+    _pong_turn = false;
+    _cv_ping.notify_one();
+  }
+}
+
+static void _thread_ping()
+{
+  riot::unique_lock<riot::mutex> lock(_mtx);
+
+  _pong_turn = true;
+  _cv_pong.notify_one();
+  while (_pong_turn) {
+    _cv_ping.wait(lock);
+  }
+}
+
+int main()
+{
+  executor exec;
+
+  puts("main starting");
+
+  exec.spawn(_ponger());
+  exec.spawn(_pinger());
+  exec.run();
+
+  _stop = false;
+  riot::thread other(_thread_ponger);
+
+  BENCHMARK_RUN("thread pingpong", BENCH_RUNS, _thread_ping());
+
+  _stop = true;
+  _thread_ping();
+  other.join();
+
+  return 0;
+}
@@ -0,0 +1,27 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 Freie Universität Berlin
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+from testrunner.utils import expect_benchmark
+
+BENCHMARKS = (
+    "coro task call",
+    "coro yield",
+    "coro pingpong",
+    "thread pingpong",
+)
+
+
+def testfunc(child):
+    for name in BENCHMARKS:
+        expect_benchmark(child, name)
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
@@ -0,0 +1,106 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser General
+ * Public License v2.1. See the file LICENSE in the top level directory for more
+ * details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Reference implementation with the C API
+ *
+ * @}
+ */
+
+#include "net/coap.h"
+#include "net/gnrc/pktbuf.h"
+#include "net/ipv6/hdr.h"
+#include "net/udp.h"
+
+#include "c_api.h"
+
+#define COAP_HDR_SIZE   (4U)
+
+static size_t _coap_payload_len(const uint8_t *msg, size_t len)
+{
+    size_t pos;
+
+    if ((len < COAP_HDR_SIZE) || ((msg[0] >> 6) != COAP_V1) ||
+        ((msg[0] & 0xf) > COAP_TOKEN_LENGTH_MAX) ||
+        (len < COAP_HDR_SIZE + (msg[0] & 0xf))) {
+        return 0;
+    }
+
+    pos = COAP_HDR_SIZE + (msg[0] & 0xf);
+    while ((pos < len) && (msg[pos] != COAP_PAYLOAD_MARKER)) {
+        unsigned delta = msg[pos] >> 4;
+        size_t opt_len = msg[pos] & 0xf;
+
+        pos++;
+        if (delta == 15 || opt_len == 15) {
+            return 0;
+        }
+        pos += (delta == 13) ? 1 : (delta == 14) ? 2 : 0;
+        if (opt_len >= 13) {
+            if (pos + opt_len - 12 > len) {
+                return 0;
+            }
+            opt_len = (opt_len == 13) ? 13U + msg[pos]
+                                      : 269U + ((msg[pos] << 8) | msg[pos + 1]);
+            pos += (opt_len >= 269) ? 2 : 1;
+        }
+        pos += opt_len;
+    }
+    if (pos >= len) {
+        return 0;
+    }
+    return len - pos - COAP_PAYLOAD_MARKER_SIZE;
+}
+
+unsigned parse_c(gnrc_pktsnip_t *pkt)
+{
+    gnrc_pktsnip_t *snip;
+    ipv6_hdr_t *ipv6;
+    udp_hdr_t *udp;
+    const uint8_t *coap;
+
+    snip = gnrc_pktsnip_search_type(pkt, GNRC_NETTYPE_IPV6);
+    if (!snip || snip->size < sizeof(ipv6_hdr_t)) {
+        return 0;
+    }
+    ipv6 = snip->data;
+
+    snip = gnrc_pktsnip_search_type(pkt, GNRC_NETTYPE_UDP);
+    if (!snip || snip->size < sizeof(udp_hdr_t)) {
+        return 0;
+    }
+    udp = snip->data;
+
+    coap = pkt->data;
+    if (pkt->size < COAP_HDR_SIZE) {
+        return 0;
+    }
+
+    return ipv6->hl + byteorder_ntohs(udp->src_port) +
+           ((coap[2] << 8) | coap[3]) + _coap_payload_len(coap, pkt->size);
+}
+
+void share_c(gnrc_pktsnip_t *pkt)
+{
+    gnrc_pktbuf_hold(pkt, 1);
+    gnrc_pktbuf_release(pkt);
+}
+
+size_t iterate_c(gnrc_pktsnip_t *pkt)
+{
+    size_t sum = 0;
+
+    for (gnrc_pktsnip_t *snip = pkt; snip; snip = snip->next) {
+        sum += snip->size;
+    }
+    return sum;
+}
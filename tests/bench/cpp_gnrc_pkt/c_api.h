@@ -0,0 +1,50 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Reference implementation with the C API
+ *
+ * @}
+ */
+
+#ifndef C_API_H
+#define C_API_H
+
+#include "net/gnrc/pkt.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Parse the headers of a received CoAP over UDP packet
+ *
+ * @return  sum of the hop limit, UDP source port, CoAP message ID and CoAP
+ *          payload length, 0 on error
+ */
+unsigned parse_c(gnrc_pktsnip_t *pkt);
+
+/**
+ * @brief   Take and release a reference to a packet
+ */
+void share_c(gnrc_pktsnip_t *pkt);
+
+/**
+ * @brief   Sum up the sizes of the snips of a packet
+ */
+size_t iterate_c(gnrc_pktsnip_t *pkt);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* C_API_H */
@@ -0,0 +1,59 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Implementation with the C++ packet views
+ *
+ * @}
+ */
+
+#include "cpp_api.hpp"
+
+using riot::gnrc::pkt;
+
+unsigned parse_cpp(const pkt& p)
+{
+  ipv6_hdr_t *ipv6 = riot::gnrc::ipv6_hdr(p);
+  if (!ipv6) {
+    return 0;
+  }
+
+  udp_hdr_t *udp = riot::gnrc::udp_hdr(p);
+  if (!udp) {
+    return 0;
+  }
+
+  riot::gnrc::span<uint8_t> payload = p.payload();
+  riot::gnrc::coap_view coap{payload};
+  if (payload.size() < 4) {
+    return 0;
+  }
+
+  return ipv6->hl + byteorder_ntohs(udp->src_port) + coap.msg_id() +
+         (coap.valid() ? coap.payload().size() : 0);
+}
+
+void share_cpp(const pkt& p)
+{
+  pkt other = p.share();
+  (void)other;
+}
+
+size_t iterate_cpp(const pkt& p)
+{
+  size_t sum = 0;
+
+  for (auto s : p) {
+    sum += s.size();
+  }
+  return sum;
+}
@@ -0,0 +1,41 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Implementation with the C++ packet views
+ *
+ * The functions do the same as those of c_api.h.
+ *
+ * @}
+ */
+
+#ifndef CPP_API_HPP
+#define CPP_API_HPP
+
+#include "riot/gnrc/pkt.hpp"
+
+/**
+ * @brief   Parse the headers of a received CoAP over UDP packet
+ */
+unsigned parse_cpp(const riot::gnrc::pkt& p);
+
+/**
+ * @brief   Take and release a reference to a packet
+ */
+void share_cpp(const riot::gnrc::pkt& p);
+
+/**
+ * @brief   Sum up the sizes of the snips of a packet
+ */
+size_t iterate_cpp(const riot::gnrc::pkt& p);
+
+#endif // CPP_API_HPP
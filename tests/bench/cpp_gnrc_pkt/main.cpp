@@ -0,0 +1,89 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       C++ packet views compared to the GNRC C API
+ *
+ * @}
+ */
+
+#include <cstdio>
+
+#include "benchmark.h"
+#include "riot/gnrc/pkt.hpp"
+#include "test_utils/expect.h"
+
+#include "c_api.h"
+#include "cpp_api.hpp"
+
+#ifndef BENCH_RUNS
+#define BENCH_RUNS          (1000UL)
+#endif
+
+using riot::gnrc::pkt;
+
+/* CON GET, message ID 0x1234, token of 2 bytes, Uri-Path "sensors" and
+ * "temperature", 4 bytes of payload */
+static const uint8_t _coap[] = {
+  0x42, 0x01, 0x12, 0x34, 0xca, 0xfe,
+  0xb7, 's', 'e', 'n', 's', 'o', 'r', 's',
+  0x0b, 't', 'e', 'm', 'p', 'e', 'r', 'a', 't', 'u', 'r', 'e',
+  0xff, '2', '1', '.', '5',
+};
+
+static volatile unsigned _sink;
+
+static gnrc_pktsnip_t *_build(void)
+{
+  ipv6_hdr_t ipv6 = {};
+  udp_hdr_t udp = {};
+
+  ipv6_hdr_set_version(&ipv6);
+  ipv6.nh = PROTNUM_UDP;
+  ipv6.hl = 64;
+  udp.src_port = byteorder_htons(5683);
+  udp.dst_port = byteorder_htons(5683);
+
+  /* in the order of a received packet, payload first */
+  gnrc_pktsnip_t *snip = gnrc_pktbuf_add(NULL, &ipv6, sizeof(ipv6),
+                                         GNRC_NETTYPE_IPV6);
+  snip = gnrc_pktbuf_add(snip, &udp, sizeof(udp), GNRC_NETTYPE_UDP);
+  return gnrc_pktbuf_add(snip, _coap, sizeof(_coap), GNRC_NETTYPE_UNDEF);
+}
+
+int main()
+{
+  puts("main starting");
+
+  pkt p{_build()};
+  expect(p.get() != nullptr);
+
+  /* both must get the same result */
+  unsigned expected = 64 + 5683 + 0x1234 + 4;
+  expect(parse_c(p.get()) == expected);
+  expect(parse_cpp(p) == expected);
+  expect(iterate_c(p.get()) == iterate_cpp(p));
+
+  BENCHMARK_RUN("C parse", BENCH_RUNS, _sink = parse_c(p.get()));
+  BENCHMARK_RUN("C++ parse", BENCH_RUNS, _sink = parse_cpp(p));
+  BENCHMARK_RUN("C hold release", BENCH_RUNS, share_c(p.get()));
+  BENCHMARK_RUN("C++ share", BENCH_RUNS, share_cpp(p));
+  BENCHMARK_RUN("C iterate", BENCH_RUNS, _sink = iterate_c(p.get()));
+  BENCHMARK_RUN("C++ iterate", BENCH_RUNS, _sink = iterate_cpp(p));
+  benchmark_print_value("sizeof(riot::gnrc::pkt)", "bytes", sizeof(pkt));
+
+  p.reset();
+
+  puts("SUCCESS");
+
+  return 0;
+}
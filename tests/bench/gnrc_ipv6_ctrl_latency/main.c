@@ -0,0 +1,250 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Measure latency of control packets behind bulk data
+ *
+ * @}
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "mutex.h"
+#include "net/ethernet.h"
+#include "net/ethernet/hdr.h"
+#include "net/gnrc.h"
+#include "net/gnrc/ipv6.h"
+#include "net/gnrc/ipv6/nib.h"
+#include "net/gnrc/netif/ethernet.h"
+#include "net/icmpv6.h"
+#include "net/inet_csum.h"
+#include "net/ipv6/hdr.h"
+#include "net/netdev_test.h"
+#include "net/protnum.h"
+#include "sched.h"
+#include "test_utils/expect.h"
+#include "thread.h"
+#include "ztimer.h"
+
+#ifndef BURST
+#define BURST               (16U)
+#endif
+
+#ifndef ROUNDS
+#define ROUNDS              (1000U)
+#endif
+
+/* a single round should never take that long */
+#define ROUND_TIMEOUT_US    (100000U)
+
+#define PAYLOAD_LEN         (16U)
+
+#define ADDR                { 0x20, 0x01, 0x0d, 0xb8, 0x00, 0x00, 0x00, 0x00, \
+                              0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, }
+#define NBR_MAC             { 0x57, 0x44, 0x33, 0x22, 0x11, 0x00, }
+#define NBR_LINK_LOCAL      { 0xfe, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+                              0x55, 0x44, 0x33, 0xff, 0xfe, 0x22, 0x11, 0x00, }
+#define DATA_SRC            { 0x20, 0x01, 0x0d, 0xb8, 0x00, 0x00, 0xef, 0x01, \
+                              0x02, 0xca, 0x4b, 0xef, 0xf4, 0xc2, 0xde, 0x01, }
+#define DATA_DST            { 0x20, 0x01, 0x0d, 0xb8, 0x00, 0x00, 0xab, 0xcd, \
+                              0x55, 0x44, 0x33, 0xff, 0xfe, 0x22, 0x11, 0x00, }
+#define DATA_DST_PFX_LEN    (64U)
+
+static const uint8_t _mac[] = { 0xce, 0xab, 0xfe, 0xad, 0xf7, 0x26 };
+static const uint8_t _nbr_mac[] = NBR_MAC;
+static const ipv6_addr_t _addr = { .u8 = ADDR };
+static const ipv6_addr_t _nbr_link_local = { .u8 = NBR_LINK_LOCAL };
+static const ipv6_addr_t _data_src = { .u8 = DATA_SRC };
+static const ipv6_addr_t _data_dst = { .u8 = DATA_DST };
+
+static gnrc_netif_t _netif;
+static netdev_test_t _netdev;
+static char _netif_stack[THREAD_STACKSIZE_DEFAULT];
+
+static mutex_t _done = MUTEX_INIT_LOCKED;
+static uint32_t _start;
+static uint32_t _ctrl_us;
+static uint32_t _burst_us;
+static unsigned _forwarded;
+static bool _replied;
+
+static int _get_device_type(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len == sizeof(uint16_t));
+    *((uint16_t *)value) = NETDEV_TYPE_ETHERNET;
+    return sizeof(uint16_t);
+}
+
+static int _get_max_packet_size(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len == sizeof(uint16_t));
+    *((uint16_t *)value) = ETHERNET_DATA_LEN;
+    return sizeof(uint16_t);
+}
+
+static int _get_address(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len >= sizeof(_mac));
+    memcpy(value, _mac, sizeof(_mac));
+    return sizeof(_mac);
+}
+
+static int _send(netdev_t *dev, const iolist_t *iolist)
+{
+    uint8_t frame[sizeof(ethernet_hdr_t) + sizeof(ipv6_hdr_t) + sizeof(icmpv6_hdr_t)];
+    const ethernet_hdr_t *eth = (ethernet_hdr_t *)frame;
+    const ipv6_hdr_t *ipv6 = (ipv6_hdr_t *)(eth + 1);
+    const icmpv6_hdr_t *icmpv6 = (icmpv6_hdr_t *)(ipv6 + 1);
+    size_t len = 0;
+
+    (void)dev;
+    for (const iolist_t *iol = iolist; iol && (len < sizeof(frame));
+         iol = iol->iol_next) {
+        size_t chunk = iol->iol_len;
+
+        if (chunk > (sizeof(frame) - len)) {
+            chunk = sizeof(frame) - len;
+        }
+        memcpy(&frame[len], iol->iol_base, chunk);
+        len += chunk;
+    }
+    /* ignore anything the router sends on its own (e.g. router
+     * advertisements) */
+    if ((len < sizeof(frame)) ||
+        (memcmp(eth->dst, _nbr_mac, sizeof(_nbr_mac)) != 0)) {
+        return iolist_size(iolist);
+    }
+    if ((ipv6->nh == PROTNUM_ICMPV6) && (icmpv6->type == ICMPV6_ECHO_REP)) {
+        _ctrl_us = ztimer_now(ZTIMER_USEC) - _start;
+        _replied = true;
+    }
+    else if (ipv6->nh == PROTNUM_UDP) {
+        _forwarded++;
+    }
+    if (_replied && (_forwarded == BURST)) {
+        _burst_us = ztimer_now(ZTIMER_USEC) - _start;
+        mutex_unlock(&_done);
+    }
+    return iolist_size(iolist);
+}
+
+static void _init_netif(void)
+{
+    netdev_test_setup(&_netdev, NULL);
+    netdev_test_set_get_cb(&_netdev, NETOPT_DEVICE_TYPE, _get_device_type);
+    netdev_test_set_get_cb(&_netdev, NETOPT_MAX_PDU_SIZE, _get_max_packet_size);
+    netdev_test_set_get_cb(&_netdev, NETOPT_ADDRESS, _get_address);
+    netdev_test_set_send_cb(&_netdev, _send);
+    expect(gnrc_netif_ethernet_create(&_netif, _netif_stack,
+                                      sizeof(_netif_stack), GNRC_NETIF_PRIO,
+                                      "mockup_eth",
+                                      &_netdev.netdev.netdev) == 0);
+    expect(gnrc_netif_ipv6_addr_add(&_netif, &_addr, 64,
+                                    GNRC_NETIF_IPV6_ADDRS_FLAGS_STATE_VALID) > 0);
+}
+
+static gnrc_pktsnip_t *_build(const ipv6_addr_t *src, const ipv6_addr_t *dst,
+                              uint8_t nh)
+{
+    gnrc_pktsnip_t *pkt, *netif_hdr;
+    ipv6_hdr_t *ipv6;
+
+    pkt = gnrc_pktbuf_add(NULL, NULL, sizeof(ipv6_hdr_t) + PAYLOAD_LEN,
+                          GNRC_NETTYPE_IPV6);
+    netif_hdr = gnrc_netif_hdr_build(_nbr_mac, sizeof(_nbr_mac),
+                                     _mac, sizeof(_mac));
+    expect(pkt && netif_hdr);
+    gnrc_netif_hdr_set_netif(netif_hdr->data, &_netif);
+    ipv6 = pkt->data;
+    memset(pkt->data, 0, pkt->size);
+    ipv6_hdr_set_version(ipv6);
+    ipv6->len = byteorder_htons(PAYLOAD_LEN);
+    ipv6->nh = nh;
+    ipv6->hl = 64;
+    ipv6->src = *src;
+    ipv6->dst = *dst;
+    return gnrc_pkt_append(pkt, netif_hdr);
+}
+
+static gnrc_pktsnip_t *_build_echo_req(uint16_t seq)
+{
+    gnrc_pktsnip_t *pkt = _build(&_nbr_link_local, &_addr, PROTNUM_ICMPV6);
+    ipv6_hdr_t *ipv6 = pkt->data;
+    icmpv6_echo_t *echo = (icmpv6_echo_t *)(ipv6 + 1);
+    uint16_t csum;
+
+    echo->type = ICMPV6_ECHO_REQ;
+    echo->id = byteorder_htons(0x7e57);
+    echo->seq = byteorder_htons(seq);
+    csum = ipv6_hdr_inet_csum(0, ipv6, PROTNUM_ICMPV6, PAYLOAD_LEN);
+    csum = inet_csum(csum, (uint8_t *)echo, PAYLOAD_LEN);
+    echo->csum = byteorder_htons(~csum);
+    return pkt;
+}
+
+int main(void)
+{
+    uint32_t ctrl_sum = 0, ctrl_max = 0, burst_sum = 0, burst_max = 0;
+    unsigned lost = 0;
+
+    puts("main starting");
+
+    _init_netif();
+    /* define neighbor to forward to and route to it */
+    expect(gnrc_ipv6_nib_nc_set(&_nbr_link_local, _netif.pid,
+                                _nbr_mac, sizeof(_nbr_mac)) == 0);
+    expect(gnrc_ipv6_nib_ft_add(&_data_dst, DATA_DST_PFX_LEN, &_nbr_link_local,
+                                _netif.pid, 0) == 0);
+    /* queue all packets of a round before the IPv6 thread handles them */
+    sched_change_priority(thread_get_active(), GNRC_IPV6_PRIO - 1);
+
+    for (unsigned round = 0; round < ROUNDS; round++) {
+        _forwarded = 0;
+        _replied = false;
+        _start = ztimer_now(ZTIMER_USEC);
+        for (unsigned i = 0; i < BURST; i++) {
+            expect(gnrc_netapi_receive(gnrc_ipv6_pid,
+                                       _build(&_data_src, &_data_dst,
+                                              PROTNUM_UDP)) > 0);
+        }
+        expect(gnrc_netapi_receive(gnrc_ipv6_pid,
+                                   _build_echo_req(round)) > 0);
+        if (ztimer_mutex_lock_timeout(ZTIMER_USEC, &_done,
+                                      ROUND_TIMEOUT_US) != 0) {
+            lost++;
+            continue;
+        }
+        ctrl_sum += _ctrl_us;
+        burst_sum += _burst_us;
+        if (_ctrl_us > ctrl_max) {
+            ctrl_max = _ctrl_us;
+        }
+        if (_burst_us > burst_max) {
+            burst_max = _burst_us;
+        }
+    }
+
+    unsigned done = ROUNDS - lost;
+
+    printf("{ \"burst\" : %u, \"rounds\" : %u, \"lost\" : %u, "
+           "\"ctrl_us\" : { \"avg\" : %" PRIu32 ", \"max\" : %" PRIu32 " }, "
+           "\"burst_us\" : { \"avg\" : %" PRIu32 ", \"max\" : %" PRIu32 " } }\n",
+           BURST, ROUNDS, lost, done ? ctrl_sum / done : 0, ctrl_max,
+           done ? burst_sum / done : 0, burst_max);
+
+    return 0;
+}
@@ -0,0 +1,210 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Measure IPv6 packets forwarded per second
+ *
+ * @}
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "mutex.h"
+#include "net/ethernet.h"
+#include "net/ethernet/hdr.h"
+#include "net/ethertype.h"
+#include "net/gnrc.h"
+#include "net/gnrc/ipv6/nib.h"
+#include "net/gnrc/netif/ethernet.h"
+#include "net/netdev_test.h"
+#include "test_utils/expect.h"
+#include "thread.h"
+#include "ztimer.h"
+
+#ifndef TEST_DURATION_US
+#define TEST_DURATION_US    (1000000U)
+#endif
+
+/* a single frame should never take that long */
+#define FRAME_TIMEOUT_US    (10000U)
+
+#define NETIF_NUMOF         (2U)
+#define IN                  (0U)
+#define OUT                 (1U)
+
+#define SRC_MAC             { 0x3a, 0x31, 0x28, 0x1f, 0x16, 0x0d, }
+#define NBR_MAC             { 0x57, 0x44, 0x33, 0x22, 0x11, 0x00, }
+#define NBR_LINK_LOCAL      { 0xfe, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+                              0x55, 0x44, 0x33, 0xff, 0xfe, 0x22, 0x11, 0x00, }
+#define DST                 { 0x20, 0x01, 0x0d, 0xb8, 0x00, 0x00, 0xab, 0xcd, \
+                              0x55, 0x44, 0x33, 0xff, 0xfe, 0x22, 0x11, 0x00, }
+#define DST_PFX_LEN         (64U)
+/* IPv6 header + payload:     version+TC  FL: 0       plen: 16    NH:17 HL:64 */
+#define L2_PAYLOAD          { 0x60, 0x00, 0x00, 0x00, 0x00, 0x10, 0x11, 0x40, \
+                              /* source: random address */                    \
+                              0x20, 0x01, 0x0d, 0xb8, 0x00, 0x00, 0xef, 0x01, \
+                              0x02, 0xca, 0x4b, 0xef, 0xf4, 0xc2, 0xde, 0x01, \
+                              /* destination: DST */                          \
+                              0x20, 0x01, 0x0d, 0xb8, 0x00, 0x00, 0xab, 0xcd, \
+                              0x55, 0x44, 0x33, 0xff, 0xfe, 0x22, 0x11, 0x00, \
+                              /* random payload of length 16 */               \
+                              0x54, 0xb8, 0x59, 0xaf, 0x3a, 0xb4, 0x5c, 0x85, \
+                              0x1e, 0xce, 0xe2, 0xeb, 0x05, 0x4e, 0xa3, 0x85, }
+
+static const uint8_t _netif_macs[NETIF_NUMOF][ETHERNET_ADDR_LEN] = {
+    { 0xce, 0xab, 0xfe, 0xad, 0xf7, 0x26, },
+    { 0xce, 0xab, 0xfe, 0xad, 0xf7, 0x27, },
+};
+static const uint8_t _src_mac[] = SRC_MAC;
+static const uint8_t _nbr_mac[] = NBR_MAC;
+static const ipv6_addr_t _nbr_link_local = { .u8 = NBR_LINK_LOCAL };
+static const ipv6_addr_t _dst = { .u8 = DST };
+static const uint8_t _l2_payload[] = L2_PAYLOAD;
+
+static gnrc_netif_t _netif[NETIF_NUMOF];
+static netdev_test_t _netdev[NETIF_NUMOF];
+static char _netif_stack[NETIF_NUMOF][THREAD_STACKSIZE_DEFAULT];
+
+static uint8_t _frame[sizeof(ethernet_hdr_t) + sizeof(_l2_payload)];
+static mutex_t _forwarded = MUTEX_INIT_LOCKED;
+
+static unsigned _netdev_idx(netdev_t *dev)
+{
+    for (unsigned i = 0; i < NETIF_NUMOF; i++) {
+        if (dev == &_netdev[i].netdev.netdev) {
+            return i;
+        }
+    }
+    expect(false);
+    return 0;
+}
+
+static int _get_device_type(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len == sizeof(uint16_t));
+    *((uint16_t *)value) = NETDEV_TYPE_ETHERNET;
+    return sizeof(uint16_t);
+}
+
+static int _get_max_packet_size(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len == sizeof(uint16_t));
+    *((uint16_t *)value) = ETHERNET_DATA_LEN;
+    return sizeof(uint16_t);
+}
+
+static int _get_address(netdev_t *dev, void *value, size_t max_len)
+{
+    expect(max_len >= ETHERNET_ADDR_LEN);
+    memcpy(value, _netif_macs[_netdev_idx(dev)], ETHERNET_ADDR_LEN);
+    return ETHERNET_ADDR_LEN;
+}
+
+static void _isr(netdev_t *dev)
+{
+    dev->event_callback(dev, NETDEV_EVENT_RX_COMPLETE);
+}
+
+static int _recv(netdev_t *dev, char *buf, int len, void *info)
+{
+    (void)dev;
+    (void)info;
+    if (buf == NULL) {
+        return sizeof(_frame);
+    }
+    expect((unsigned)len >= sizeof(_frame));
+    memcpy(buf, _frame, sizeof(_frame));
+    return sizeof(_frame);
+}
+
+static int _send(netdev_t *dev, const iolist_t *iolist)
+{
+    const ethernet_hdr_t *hdr = iolist->iol_base;
+    size_t len = iolist_size(iolist);
+
+    (void)dev;
+    /* ignore anything the router sends on its own (e.g. router
+     * advertisements) */
+    if ((len == sizeof(_frame)) &&
+        (memcmp(hdr->dst, _nbr_mac, sizeof(_nbr_mac)) == 0)) {
+        mutex_unlock(&_forwarded);
+    }
+    return len;
+}
+
+static void _init_netif(unsigned idx)
+{
+    netdev_test_t *netdev = &_netdev[idx];
+    gnrc_netif_t *netif = &_netif[idx];
+
+    netdev_test_setup(netdev, NULL);
+    netdev_test_set_get_cb(netdev, NETOPT_DEVICE_TYPE, _get_device_type);
+    netdev_test_set_get_cb(netdev, NETOPT_MAX_PDU_SIZE, _get_max_packet_size);
+    netdev_test_set_get_cb(netdev, NETOPT_ADDRESS, _get_address);
+    if (idx == IN) {
+        netdev_test_set_isr_cb(netdev, _isr);
+        netdev_test_set_recv_cb(netdev, _recv);
+    }
+    else {
+        netdev_test_set_send_cb(netdev, _send);
+    }
+    expect(gnrc_netif_ethernet_create(netif, _netif_stack[idx],
+                                      sizeof(_netif_stack[idx]),
+                                      GNRC_NETIF_PRIO, "mockup_eth",
+                                      &netdev->netdev.netdev) == 0);
+    gnrc_ipv6_nib_init_iface(netif);
+    gnrc_ipv6_nib_iface_up(netif);
+}
+
+int main(void)
+{
+    ethernet_hdr_t *hdr = (ethernet_hdr_t *)_frame;
+    uint32_t n = 0, lost = 0;
+
+    puts("main starting");
+
+    gnrc_ipv6_nib_init();
+    for (unsigned i = 0; i < NETIF_NUMOF; i++) {
+        _init_netif(i);
+    }
+    /* define neighbor to forward to and route to it */
+    expect(gnrc_ipv6_nib_nc_set(&_nbr_link_local, _netif[OUT].pid,
+                                _nbr_mac, sizeof(_nbr_mac)) == 0);
+    expect(gnrc_ipv6_nib_ft_add(&_dst, DST_PFX_LEN, &_nbr_link_local,
+                                _netif[OUT].pid, 0) == 0);
+
+    memcpy(hdr->dst, _netif_macs[IN], ETHERNET_ADDR_LEN);
+    memcpy(hdr->src, _src_mac, sizeof(_src_mac));
+    hdr->type = byteorder_htons(ETHERTYPE_IPV6);
+    memcpy(&_frame[sizeof(ethernet_hdr_t)], _l2_payload, sizeof(_l2_payload));
+
+    uint32_t start = ztimer_now(ZTIMER_USEC);
+
+    while ((ztimer_now(ZTIMER_USEC) - start) < TEST_DURATION_US) {
+        netdev_trigger_event_isr(&_netdev[IN].netdev.netdev);
+        if (ztimer_mutex_lock_timeout(ZTIMER_USEC, &_forwarded,
+                                      FRAME_TIMEOUT_US) == 0) {
+            n++;
+        }
+        else {
+            lost++;
+        }
+    }
+
+    printf("{ \"result\" : %" PRIu32 ", \"lost\" : %" PRIu32 " }\n", n, lost);
+
+    return 0;
+}
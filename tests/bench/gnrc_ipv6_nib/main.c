@@ -0,0 +1,85 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       NIB forwarding table lookup benchmark
+ *
+ * @}
+ */
+
+#include <stdio.h>
+
+#include "benchmark.h"
+#include "net/gnrc/ipv6/nib.h"
+#include "test_utils/expect.h"
+
+#ifndef BENCH_RUNS
+#define BENCH_RUNS          (1000UL)
+#endif
+
+#ifndef NUM_ROUTES
+#define NUM_ROUTES          (64U)
+#endif
+
+/* the interface is never looked at, it does not have to exist */
+#define IFACE               (6)
+
+#define ROUTE_PFX           { 0x20, 0x01, 0x0d, 0xb8, 0x00, 0x00, 0x00, 0x00, \
+                              0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, }
+#define NEXT_HOP            { 0xfe, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+                              0x00, 0x00, 0x00, 0xff, 0xfe, 0x00, 0x00, 0x01, }
+
+static gnrc_ipv6_nib_ft_t _fte;
+
+static void _addr(ipv6_addr_t *addr, unsigned route)
+{
+    *addr = (ipv6_addr_t){ .u8 = ROUTE_PFX };
+    addr->u16[3] = byteorder_htons(route);
+}
+
+static void _ft_get(const ipv6_addr_t *dst)
+{
+    gnrc_ipv6_nib_ft_get(dst, NULL, &_fte);
+}
+
+int main(void)
+{
+    static const ipv6_addr_t next_hop = { .u8 = NEXT_HOP };
+    ipv6_addr_t first, last, other;
+
+    puts("main starting");
+
+    for (unsigned i = 0; i < NUM_ROUTES; i++) {
+        ipv6_addr_t dst;
+
+        _addr(&dst, i);
+        expect(gnrc_ipv6_nib_ft_add(&dst, 64, &next_hop, IFACE, 0) == 0);
+    }
+    expect(gnrc_ipv6_nib_ft_add(NULL, 0, &next_hop, IFACE, 0) == 0);
+
+    _addr(&first, 0);
+    _addr(&last, NUM_ROUTES - 1);
+    _addr(&other, NUM_ROUTES);
+    expect(gnrc_ipv6_nib_ft_get(&last, NULL, &_fte) == 0);
+    expect(_fte.dst_len == 64);
+    expect(gnrc_ipv6_nib_ft_get(&other, NULL, &_fte) == 0);
+    expect(_fte.dst_len == 0);
+
+    BENCHMARK_RUN("gnrc_ipv6_nib_ft_get() first", BENCH_RUNS, _ft_get(&first));
+    BENCHMARK_RUN("gnrc_ipv6_nib_ft_get() last", BENCH_RUNS, _ft_get(&last));
+    BENCHMARK_RUN("gnrc_ipv6_nib_ft_get() default", BENCH_RUNS,
+                  _ft_get(&other));
+
+    puts("SUCCESS");
+
+    return 0;
+}
@@ -0,0 +1,84 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Network registry lookup benchmark
+ *
+ * @}
+ */
+
+#include <stdio.h>
+
+#include "benchmark.h"
+#include "msg.h"
+#include "net/gnrc/netreg.h"
+#include "test_utils/expect.h"
+#include "thread.h"
+
+#ifndef BENCH_RUNS
+#define BENCH_RUNS          (1000UL)
+#endif
+
+#ifndef NUM_ENTRIES
+#define NUM_ENTRIES         (32U)
+#endif
+
+#define TYPE                (GNRC_NETTYPE_UNDEF)
+
+static msg_t _msg_queue[4];
+static gnrc_netreg_entry_t _entries[NUM_ENTRIES];
+static gnrc_netreg_entry_t _extra;
+
+static void _register_unregister(void)
+{
+    gnrc_netreg_register(TYPE, &_extra);
+    gnrc_netreg_unregister(TYPE, &_extra);
+}
+
+static void _lookup(uint32_t demux_ctx)
+{
+    gnrc_netreg_acquire_shared();
+    gnrc_netreg_lookup(TYPE, demux_ctx);
+    gnrc_netreg_release_shared();
+}
+
+int main(void)
+{
+    puts("main starting");
+
+    /* only threads with a message queue may register */
+    msg_init_queue(_msg_queue, ARRAY_SIZE(_msg_queue));
+
+    /* entries are prepended, the first one registered is found last */
+    for (unsigned i = 0; i < NUM_ENTRIES; i++) {
+        gnrc_netreg_entry_init_pid(&_entries[i], i, thread_getpid());
+        expect(gnrc_netreg_register(TYPE, &_entries[i]) == 0);
+    }
+    gnrc_netreg_entry_init_pid(&_extra, NUM_ENTRIES, thread_getpid());
+
+    gnrc_netreg_acquire_shared();
+    expect(gnrc_netreg_lookup(TYPE, 0) == &_entries[0]);
+    expect(gnrc_netreg_lookup(TYPE, NUM_ENTRIES) == NULL);
+    gnrc_netreg_release_shared();
+
+    BENCHMARK_RUN("gnrc_netreg_register() + unregister()", BENCH_RUNS,
+                  _register_unregister());
+    BENCHMARK_RUN("gnrc_netreg_lookup() first", BENCH_RUNS,
+                  _lookup(NUM_ENTRIES - 1));
+    BENCHMARK_RUN("gnrc_netreg_lookup() last", BENCH_RUNS, _lookup(0));
+    BENCHMARK_RUN("gnrc_netreg_lookup() miss", BENCH_RUNS,
+                  _lookup(NUM_ENTRIES));
+
+    puts("SUCCESS");
+
+    return 0;
+}
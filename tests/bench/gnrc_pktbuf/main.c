@@ -0,0 +1,79 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Packet buffer allocation benchmark
+ *
+ * @}
+ */
+
+#include <stdio.h>
+
+#include "benchmark.h"
+#include "net/gnrc/pktbuf.h"
+#include "test_utils/expect.h"
+
+#ifndef BENCH_RUNS
+#define BENCH_RUNS          (1000UL)
+#endif
+
+#define HDR_SIZE            (40U)
+
+static gnrc_pktsnip_t *_pkt;
+
+static void _alloc_release(size_t size)
+{
+    gnrc_pktsnip_t *pkt = gnrc_pktbuf_add(NULL, NULL, size,
+                                          GNRC_NETTYPE_UNDEF);
+
+    gnrc_pktbuf_release(pkt);
+}
+
+static void _add_hdr(void)
+{
+    gnrc_pktsnip_t *pkt = gnrc_pktbuf_add(NULL, NULL, 64, GNRC_NETTYPE_UNDEF);
+
+    pkt = gnrc_pktbuf_add(pkt, NULL, HDR_SIZE, GNRC_NETTYPE_UNDEF);
+    gnrc_pktbuf_release(pkt);
+}
+
+static void _start_write(void)
+{
+    /* a second user forces a copy */
+    gnrc_pktbuf_hold(_pkt, 1);
+    gnrc_pktsnip_t *pkt = gnrc_pktbuf_start_write(_pkt);
+
+    gnrc_pktbuf_release(pkt);
+}
+
+int main(void)
+{
+    puts("main starting");
+
+    /* check the buffer is large enough */
+    _pkt = gnrc_pktbuf_add(NULL, NULL, 1024, GNRC_NETTYPE_UNDEF);
+    expect(_pkt != NULL);
+    gnrc_pktbuf_release(_pkt);
+
+    BENCHMARK_RUN("gnrc_pktbuf_add() 16 B", BENCH_RUNS, _alloc_release(16));
+    BENCHMARK_RUN("gnrc_pktbuf_add() 128 B", BENCH_RUNS, _alloc_release(128));
+    BENCHMARK_RUN("gnrc_pktbuf_add() 1024 B", BENCH_RUNS, _alloc_release(1024));
+    BENCHMARK_RUN("gnrc_pktbuf_add() header", BENCH_RUNS, _add_hdr());
+
+    _pkt = gnrc_pktbuf_add(NULL, NULL, 128, GNRC_NETTYPE_UNDEF);
+    BENCHMARK_RUN("gnrc_pktbuf_start_write()", BENCH_RUNS, _start_write());
+    gnrc_pktbuf_release(_pkt);
+
+    puts("SUCCESS");
+
+    return 0;
+}
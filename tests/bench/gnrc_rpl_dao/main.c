@@ -0,0 +1,193 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Measure CPU time of an RPL DODAG root per received DAO
+ *
+ * @}
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "net/ethernet.h"
+#include "net/gnrc.h"
+#include "net/gnrc/ipv6/nib.h"
+#include "net/gnrc/netif/ethernet.h"
+#include "net/gnrc/rpl.h"
+#include "net/icmpv6.h"
+#include "net/netdev_test.h"
+#include "test_utils/expect.h"
+#include "thread.h"
+#include "ztimer.h"
+
+#ifndef NUM_TARGETS
+#define NUM_TARGETS         (512U)
+#endif
+
+/* direct children of the root the DAOs of all descendants arrive through */
+#define NUM_CHILDREN        (8U)
+#define PATH_LIFETIME       (0xffU)
+
+#define DODAG_ID            { 0x20, 0x01, 0x0d, 0xb8, 0x00, 0x00, 0x00, 0x00, \
+                              0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, }
+#define TARGET_PFX          { 0x20, 0x01, 0x0d, 0xb8, 0x00, 0x00, 0x00, 0x01, \
+                              0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, }
+#define CHILD_LINK_LOCAL    { 0xfe, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+                              0x00, 0x00, 0x00, 0xff, 0xfe, 0x00, 0x00, 0x00, }
+
+typedef struct __attribute__((packed)) {
+    icmpv6_hdr_t icmpv6;
+    gnrc_rpl_dao_t dao;
+    gnrc_rpl_opt_target_t target;
+    gnrc_rpl_opt_transit_t transit;
+} _dao_msg_t;
+
+static const uint8_t _mac[] = { 0xce, 0xab, 0xfe, 0xad, 0xf7, 0x26 };
+static ipv6_addr_t _dodag_id = { .u8 = DODAG_ID };
+
+static gnrc_netif_t _netif;
+static netdev_test_t _netdev;
+static char _netif_stack[THREAD_STACKSIZE_DEFAULT];
+
+static ipv6_addr_t _children[NUM_CHILDREN];
+static _dao_msg_t _msg;
+static uint8_t _dao_seq;
+
+static int _get_device_type(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len == sizeof(uint16_t));
+    *((uint16_t *)value) = NETDEV_TYPE_ETHERNET;
+    return sizeof(uint16_t);
+}
+
+static int _get_max_packet_size(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len == sizeof(uint16_t));
+    *((uint16_t *)value) = ETHERNET_DATA_LEN;
+    return sizeof(uint16_t);
+}
+
+static int _get_address(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len >= sizeof(_mac));
+    memcpy(value, _mac, sizeof(_mac));
+    return sizeof(_mac);
+}
+
+static int _send(netdev_t *dev, const iolist_t *iolist)
+{
+    /* drop DIOs and DAO-ACKs of the root */
+    (void)dev;
+    return iolist_size(iolist);
+}
+
+static void _init_root(void)
+{
+    netdev_test_setup(&_netdev, NULL);
+    netdev_test_set_get_cb(&_netdev, NETOPT_DEVICE_TYPE, _get_device_type);
+    netdev_test_set_get_cb(&_netdev, NETOPT_MAX_PDU_SIZE, _get_max_packet_size);
+    netdev_test_set_get_cb(&_netdev, NETOPT_ADDRESS, _get_address);
+    netdev_test_set_send_cb(&_netdev, _send);
+    expect(gnrc_netif_ethernet_create(&_netif, _netif_stack,
+                                      sizeof(_netif_stack), GNRC_NETIF_PRIO,
+                                      "mockup_eth",
+                                      &_netdev.netdev.netdev) == 0);
+    expect(gnrc_netif_ipv6_addr_add(&_netif, &_dodag_id, 64,
+                                    GNRC_NETIF_IPV6_ADDRS_FLAGS_STATE_VALID) > 0);
+    expect(gnrc_rpl_init(_netif.pid) != KERNEL_PID_UNDEF);
+    expect(gnrc_rpl_root_init(CONFIG_GNRC_RPL_DEFAULT_INSTANCE, &_dodag_id,
+                              false, false) != NULL);
+}
+
+static void _recv_dao(unsigned target, unsigned child)
+{
+    _msg.dao.dao_sequence = _dao_seq++;
+    _msg.target.target.u16[7] = byteorder_htons(target + 1);
+    _msg.transit.path_sequence = _msg.dao.dao_sequence;
+    gnrc_rpl_recv_DAO(&_msg.dao, _netif.pid, &_children[child], &_dodag_id,
+                      sizeof(_msg));
+}
+
+static unsigned _count_routes_via(const ipv6_addr_t *next_hop)
+{
+    gnrc_ipv6_nib_ft_t fte;
+    void *state = NULL;
+    unsigned count = 0;
+
+    while (gnrc_ipv6_nib_ft_iter(next_hop, _netif.pid, &state, &fte)) {
+        if (fte.dst_len == 128) {
+            count++;
+        }
+    }
+    return count;
+}
+
+static void _run_phase(const char *name, unsigned child_offset)
+{
+    uint32_t start = ztimer_now(ZTIMER_USEC);
+
+    for (unsigned i = 0; i < NUM_TARGETS; i++) {
+        _recv_dao(i, (i + child_offset) % NUM_CHILDREN);
+    }
+
+    uint32_t duration = ztimer_now(ZTIMER_USEC) - start;
+
+    printf("{ \"phase\" : \"%s\", \"daos\" : %u, \"ns_per_dao\" : %" PRIu32 " }\n",
+           name, NUM_TARGETS, (uint32_t)(((uint64_t)duration * 1000) / NUM_TARGETS));
+    /* routes via previous children must be gone */
+    for (unsigned i = 0; i < NUM_CHILDREN; i++) {
+        unsigned expected = 0;
+
+        for (unsigned j = 0; j < NUM_TARGETS; j++) {
+            expected += (((j + child_offset) % NUM_CHILDREN) == i);
+        }
+        expect(_count_routes_via(&_children[i]) == expected);
+    }
+}
+
+int main(void)
+{
+    const ipv6_addr_t child = { .u8 = CHILD_LINK_LOCAL };
+    const ipv6_addr_t target_pfx = { .u8 = TARGET_PFX };
+
+    puts("main starting");
+
+    _init_root();
+    for (unsigned i = 0; i < NUM_CHILDREN; i++) {
+        _children[i] = child;
+        _children[i].u8[15] = i + 1;
+    }
+
+    _msg.icmpv6.type = ICMPV6_RPL_CTRL;
+    _msg.icmpv6.code = GNRC_RPL_ICMPV6_CODE_DAO;
+    _msg.dao.instance_id = CONFIG_GNRC_RPL_DEFAULT_INSTANCE;
+    _msg.target.type = GNRC_RPL_OPT_TARGET;
+    _msg.target.length = GNRC_RPL_OPT_TARGET_LEN;
+    _msg.target.prefix_length = 128;
+    _msg.target.target = target_pfx;
+    _msg.transit.type = GNRC_RPL_OPT_TRANSIT;
+    _msg.transit.length = GNRC_RPL_OPT_TRANSIT_INFO_LEN;
+    _msg.transit.path_lifetime = PATH_LIFETIME;
+
+    _run_phase("join", 0);
+    _run_phase("refresh", 0);
+    _run_phase("repair", 1);
+
+    puts("SUCCESS");
+
+    return 0;
+}
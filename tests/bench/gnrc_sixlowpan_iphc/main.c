@@ -0,0 +1,242 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       6LoWPAN IPHC compression and decompression benchmark
+ *
+ * @}
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "benchmark.h"
+#include "msg.h"
+#include "net/gnrc.h"
+#include "net/gnrc/ipv6/hdr.h"
+#include "net/gnrc/netif/ieee802154.h"
+#include "net/gnrc/sixlowpan/iphc.h"
+#include "net/icmpv6.h"
+#include "net/netdev_test.h"
+#include "test_utils/expect.h"
+#include "thread.h"
+
+#ifndef BENCH_RUNS
+#define BENCH_RUNS          (1000UL)
+#endif
+
+#define TEST_SRC            { 0x2a, 0xab, 0xdc, 0x15, 0x54, 0x01, 0x64, 0x79 }
+#define TEST_DST            { 0x5a, 0x9d, 0x93, 0x86, 0x22, 0x08, 0x65, 0x79 }
+/* link-local addresses derived from TEST_SRC and TEST_DST */
+#define TEST_SRC_IPV6       { 0xfe, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+                              0x28, 0xab, 0xdc, 0x15, 0x54, 0x01, 0x64, 0x79 }
+#define TEST_DST_IPV6       { 0xfe, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+                              0x58, 0x9d, 0x93, 0x86, 0x22, 0x08, 0x65, 0x79 }
+#define TEST_PAYLOAD        { \
+        /* Echo request, identifier 0x238f, sequence 2 */ \
+        0x80, 0x00, 0x8e, 0xa0, 0x23, 0x8f, 0x00, 0x02, \
+        0x9d, 0x4b, 0xb2, 0x1c, 0x53, 0x53, 0x53, 0x53, \
+        0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, \
+        0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, \
+    }
+#define TEST_IPHC           { \
+        /* TF elided, NH inline, HLIM 64, SAM and DAM elided */ \
+        0x7a, 0x33, \
+        /* Next header: ICMPv6 */ \
+        0x3a, \
+    }
+
+static const uint8_t _test_src[] = TEST_SRC;
+static const uint8_t _test_dst[] = TEST_DST;
+static const ipv6_addr_t _test_src_ipv6 = { .u8 = TEST_SRC_IPV6 };
+static const ipv6_addr_t _test_dst_ipv6 = { .u8 = TEST_DST_IPV6 };
+static const uint8_t _test_payload[] = TEST_PAYLOAD;
+static const uint8_t _test_iphc[] = TEST_IPHC;
+
+static char _mock_netif_stack[THREAD_STACKSIZE_DEFAULT];
+static netdev_test_t _mock_dev;
+static gnrc_netif_t _netif;
+static unsigned _sent;
+static msg_t _msg_queue[4];
+
+static int _get_netdev_device_type(netdev_t *netdev, void *value,
+                                   size_t max_len)
+{
+    (void)netdev;
+    expect(max_len == sizeof(uint16_t));
+    *((uint16_t *)value) = NETDEV_TYPE_IEEE802154;
+    return sizeof(uint16_t);
+}
+
+static int _get_netdev_proto(netdev_t *netdev, void *value, size_t max_len)
+{
+    (void)netdev;
+    expect(max_len == sizeof(gnrc_nettype_t));
+    *((gnrc_nettype_t *)value) = GNRC_NETTYPE_SIXLOWPAN;
+    return sizeof(gnrc_nettype_t);
+}
+
+static int _get_netdev_max_pdu_size(netdev_t *netdev, void *value,
+                                    size_t max_len)
+{
+    (void)netdev;
+    expect(max_len == sizeof(uint16_t));
+    *((uint16_t *)value) = 102;
+    return sizeof(uint16_t);
+}
+
+static int _get_netdev_src_len(netdev_t *netdev, void *value, size_t max_len)
+{
+    (void)netdev;
+    expect(max_len == sizeof(uint16_t));
+    *((uint16_t *)value) = sizeof(_test_src);
+    return sizeof(uint16_t);
+}
+
+static int _get_netdev_addr_long(netdev_t *netdev, void *value, size_t max_len)
+{
+    (void)netdev;
+    expect(max_len >= sizeof(_test_src));
+    memcpy(value, _test_src, sizeof(_test_src));
+    return sizeof(_test_src);
+}
+
+static int _send(netdev_t *netdev, const iolist_t *iolist)
+{
+    (void)netdev;
+    _sent++;
+    return iolist_size(iolist);
+}
+
+static void _init_mock_netif(void)
+{
+    netdev_test_setup(&_mock_dev, NULL);
+    netdev_test_set_get_cb(&_mock_dev, NETOPT_DEVICE_TYPE,
+                           _get_netdev_device_type);
+    netdev_test_set_get_cb(&_mock_dev, NETOPT_PROTO,
+                           _get_netdev_proto);
+    netdev_test_set_get_cb(&_mock_dev, NETOPT_MAX_PDU_SIZE,
+                           _get_netdev_max_pdu_size);
+    netdev_test_set_get_cb(&_mock_dev, NETOPT_SRC_LEN,
+                           _get_netdev_src_len);
+    netdev_test_set_get_cb(&_mock_dev, NETOPT_ADDRESS_LONG,
+                           _get_netdev_addr_long);
+    netdev_test_set_send_cb(&_mock_dev, _send);
+    expect(gnrc_netif_ieee802154_create(&_netif, _mock_netif_stack,
+                                        sizeof(_mock_netif_stack),
+                                        GNRC_NETIF_PRIO, "mock_netif",
+                                        &_mock_dev.netdev.netdev) == 0);
+}
+
+static gnrc_pktsnip_t *_netif_hdr(const uint8_t *src, const uint8_t *dst)
+{
+    gnrc_pktsnip_t *netif = gnrc_netif_hdr_build(src, sizeof(_test_src),
+                                                 dst, sizeof(_test_dst));
+
+    expect(netif != NULL);
+    gnrc_netif_hdr_set_netif(netif->data, &_netif);
+    return netif;
+}
+
+static gnrc_pktsnip_t *_build_ipv6(void)
+{
+    gnrc_pktsnip_t *pkt = gnrc_pktbuf_add(NULL, _test_payload,
+                                          sizeof(_test_payload),
+                                          GNRC_NETTYPE_ICMPV6);
+    expect(pkt != NULL);
+    pkt = gnrc_ipv6_hdr_build(pkt, &_test_src_ipv6, &_test_dst_ipv6);
+    expect(pkt != NULL);
+
+    ipv6_hdr_t *hdr = pkt->data;
+
+    hdr->len = byteorder_htons(sizeof(_test_payload));
+    hdr->nh = PROTNUM_ICMPV6;
+    hdr->hl = 64;
+
+    gnrc_pktsnip_t *netif = _netif_hdr(_test_src, _test_dst);
+
+    netif->next = pkt;
+    return netif;
+}
+
+static gnrc_pktsnip_t *_build_iphc(void)
+{
+    gnrc_pktsnip_t *netif = _netif_hdr(_test_dst, _test_src);
+    gnrc_pktsnip_t *pkt = gnrc_pktbuf_add(netif, _test_payload,
+                                          sizeof(_test_payload),
+                                          GNRC_NETTYPE_UNDEF);
+    expect(pkt != NULL);
+    pkt = gnrc_pktbuf_add(pkt, _test_iphc, sizeof(_test_iphc),
+                          GNRC_NETTYPE_SIXLOWPAN);
+    expect(pkt != NULL);
+    return pkt;
+}
+
+static void _build_release(void)
+{
+    gnrc_pktbuf_release(_build_ipv6());
+}
+
+static void _send_iphc(void)
+{
+    gnrc_sixlowpan_iphc_send(_build_ipv6(), NULL, 0);
+}
+
+static void _recv_iphc(void)
+{
+    gnrc_sixlowpan_iphc_recv(_build_iphc(), NULL, 0);
+}
+
+/* check once that the frame is decompressed as expected */
+static void _check_recv(void)
+{
+    gnrc_netreg_entry_t entry =
+        GNRC_NETREG_ENTRY_INIT_PID(GNRC_NETREG_DEMUX_CTX_ALL, thread_getpid());
+    msg_t msg;
+
+    gnrc_netreg_register(GNRC_NETTYPE_IPV6, &entry);
+    _recv_iphc();
+    msg_receive(&msg);
+    expect(msg.type == GNRC_NETAPI_MSG_TYPE_RCV);
+
+    gnrc_pktsnip_t *pkt = msg.content.ptr;
+    ipv6_hdr_t *hdr = pkt->data;
+
+    expect(pkt->type == GNRC_NETTYPE_IPV6);
+    expect(ipv6_addr_equal(&hdr->src, &_test_dst_ipv6));
+    expect(ipv6_addr_equal(&hdr->dst, &_test_src_ipv6));
+    expect(hdr->nh == PROTNUM_ICMPV6);
+    expect(hdr->hl == 64);
+    gnrc_pktbuf_release(pkt);
+    gnrc_netreg_unregister(GNRC_NETTYPE_IPV6, &entry);
+}
+
+int main(void)
+{
+    puts("main starting");
+
+    msg_init_queue(_msg_queue, ARRAY_SIZE(_msg_queue));
+    _init_mock_netif();
+    _check_recv();
+
+    unsigned sent = _sent;
+
+    BENCHMARK_RUN("build IPv6 packet", BENCH_RUNS, _build_release());
+    BENCHMARK_RUN("gnrc_sixlowpan_iphc_send()", BENCH_RUNS, _send_iphc());
+    expect(_sent - sent >= BENCH_RUNS *
+           (CONFIG_BENCHMARK_WARMUP + CONFIG_BENCHMARK_SAMPLES));
+    BENCHMARK_RUN("gnrc_sixlowpan_iphc_recv()", BENCH_RUNS, _recv_iphc());
+
+    puts("SUCCESS");
+
+    return 0;
+}
@@ -0,0 +1,121 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Benchmark for the Internet Checksum
+ *
+ * @}
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include "container.h"
+#include "net/inet_csum.h"
+#include "test_utils/expect.h"
+#include "ztimer.h"
+
+#ifndef BENCH_BYTES
+#define BENCH_BYTES     (4UL * 1024 * 1024)
+#endif
+
+/* aligned buffer, with a spare byte to benchmark unaligned access */
+static uint32_t _buf[(1280 / sizeof(uint32_t)) + 1];
+
+/* the byte-by-byte loop inet_csum_slice() used before */
+static uint16_t _bytewise_csum(uint16_t sum, const uint8_t *buf, uint16_t len)
+{
+    uint32_t csum = sum;
+
+    for (unsigned i = 0; i < (len >> 1); buf += 2, i++) {
+        csum += (uint16_t)(*buf << 8) + *(buf + 1);
+    }
+    if (len & 1) {
+        csum += (uint16_t)(*buf << 8);
+    }
+    while (csum >> 16) {
+        uint16_t carry = csum >> 16;
+        csum = (csum & 0xffff) + carry;
+    }
+    return csum;
+}
+
+static uint32_t _kib_per_sec(uint32_t us)
+{
+    return (uint32_t)(((uint64_t)BENCH_BYTES * 1000) / 1024 / us);
+}
+
+static void _bench(uint16_t len, unsigned offset)
+{
+    const uint8_t *buf = (uint8_t *)_buf + offset;
+    unsigned runs = BENCH_BYTES / len;
+    volatile uint16_t sink;
+    uint32_t start, bytewise_us, word_us;
+
+    expect(_bytewise_csum(0, buf, len) == inet_csum(0, buf, len));
+    start = ztimer_now(ZTIMER_USEC);
+    for (unsigned i = 0; i < runs; i++) {
+        sink = _bytewise_csum(i, buf, len);
+    }
+    bytewise_us = ztimer_now(ZTIMER_USEC) - start;
+    start = ztimer_now(ZTIMER_USEC);
+    for (unsigned i = 0; i < runs; i++) {
+        sink = inet_csum(i, buf, len);
+    }
+    word_us = ztimer_now(ZTIMER_USEC) - start;
+    (void)sink;
+    printf("{ \"len\" : %u, \"offset\" : %u, \"bytewise_kib_s\" : %" PRIu32 ", "
+           "\"inet_csum_kib_s\" : %" PRIu32 " }\n", len, offset,
+           _kib_per_sec(bytewise_us), _kib_per_sec(word_us));
+}
+
+static void _bench_update(void)
+{
+    const uint8_t *buf = (uint8_t *)_buf;
+    const uint16_t len = 40;
+    unsigned runs = BENCH_BYTES / len;
+    volatile uint16_t sink;
+    uint16_t csum = ~inet_csum(0, buf, len);
+    uint32_t start, full_us, update_us;
+
+    /* rewrite a 16-bit word, e.g. a hop limit, and fix the checksum */
+    start = ztimer_now(ZTIMER_USEC);
+    for (unsigned i = 0; i < runs; i++) {
+        sink = ~inet_csum(i, buf, len);
+    }
+    full_us = ztimer_now(ZTIMER_USEC) - start;
+    start = ztimer_now(ZTIMER_USEC);
+    for (unsigned i = 0; i < runs; i++) {
+        sink = inet_csum_update16(csum, i, i - 1);
+    }
+    update_us = ztimer_now(ZTIMER_USEC) - start;
+    (void)sink;
+    printf("{ \"rewrites\" : %u, \"recalculate_us\" : %" PRIu32 ", "
+           "\"update_us\" : %" PRIu32 " }\n", runs, full_us, update_us);
+}
+
+int main(void)
+{
+    static const uint16_t lens[] = { 8, 40, 127, 1280 };
+
+    for (unsigned i = 0; i < sizeof(_buf); i++) {
+        ((uint8_t *)_buf)[i] = i * 7;
+    }
+    for (unsigned i = 0; i < ARRAY_SIZE(lens); i++) {
+        _bench(lens[i], 0);
+        _bench(lens[i], 1);
+    }
+    _bench_update();
+    puts("SUCCESS");
+
+    return 0;
+}
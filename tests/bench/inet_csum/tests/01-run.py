@@ -0,0 +1,25 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 Freie Universität Berlin
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+
+def testfunc(child):
+    for length in (8, 40, 127, 1280):
+        for offset in (0, 1):
+            child.expect(r"{{ \"len\" : {}, \"offset\" : {}, "
+                         r"\"bytewise_kib_s\" : \d+, \"inet_csum_kib_s\" : \d+ }}"
+                         .format(length, offset))
+    child.expect(r"{ \"rewrites\" : \d+, \"recalculate_us\" : \d+, "
+                 r"\"update_us\" : \d+ }")
+    child.expect_exact("SUCCESS")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
@@ -0,0 +1,138 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Benchmark of the lock-free ringbuffers against tsrb
+ *
+ * @}
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "benchmark.h"
+#include "lfrb.h"
+#include "test_utils/expect.h"
+#include "tsrb.h"
+
+#ifndef BENCH_RUNS
+#define BENCH_RUNS      (2000UL)
+#endif
+
+#define BUF_SIZE        (256U)
+#define CHUNK_SIZE      (64U)
+#define ELEM_SIZE       (16U)
+
+typedef struct {
+    uint8_t data[ELEM_SIZE];
+} elem_t;
+
+static uint8_t _tsrb_buf[BUF_SIZE];
+static tsrb_t _tsrb = TSRB_INIT(_tsrb_buf);
+
+static uint8_t _lfrb_buf[BUF_SIZE];
+static lfrb_t _lfrb = LFRB_INIT(_lfrb_buf);
+
+static elem_t _elem_buf[BUF_SIZE / ELEM_SIZE];
+static lfrb_t _elem_rb = LFRB_INIT(_elem_buf);
+
+static uint8_t _mpmc_buf[BUF_SIZE];
+static atomic_uint _mpmc_seq[BUF_SIZE];
+static lfrb_mpmc_t _mpmc;
+
+static uint8_t _in[CHUNK_SIZE];
+static uint8_t _out[CHUNK_SIZE];
+
+static void _tsrb_one(void)
+{
+    tsrb_add_one(&_tsrb, _in[0]);
+    _out[0] = tsrb_get_one(&_tsrb);
+}
+
+static void _lfrb_one(void)
+{
+    lfrb_add_one(&_lfrb, _in);
+    lfrb_get_one(&_lfrb, _out);
+}
+
+static void _mpmc_one(void)
+{
+    lfrb_mpmc_add(&_mpmc, _in, 1);
+    lfrb_mpmc_get(&_mpmc, _out, 1);
+}
+
+static void _tsrb_bulk(void)
+{
+    tsrb_add(&_tsrb, _in, CHUNK_SIZE);
+    tsrb_get(&_tsrb, _out, CHUNK_SIZE);
+}
+
+static void _lfrb_bulk(void)
+{
+    lfrb_add(&_lfrb, _in, CHUNK_SIZE);
+    lfrb_get(&_lfrb, _out, CHUNK_SIZE);
+}
+
+static void _mpmc_bulk(void)
+{
+    lfrb_mpmc_add(&_mpmc, _in, CHUNK_SIZE);
+    lfrb_mpmc_get(&_mpmc, _out, CHUNK_SIZE);
+}
+
+/* a tsrb can only hold elements as bytes */
+static void _tsrb_elem(void)
+{
+    tsrb_add(&_tsrb, _in, ELEM_SIZE);
+    tsrb_get(&_tsrb, _out, ELEM_SIZE);
+}
+
+static void _lfrb_elem(void)
+{
+    lfrb_add_one(&_elem_rb, _in);
+    lfrb_get_one(&_elem_rb, _out);
+}
+
+static void _check(void)
+{
+    expect(memcmp(_in, _out, CHUNK_SIZE) == 0);
+    expect(tsrb_empty(&_tsrb));
+    expect(lfrb_empty(&_lfrb));
+    expect(lfrb_empty(&_elem_rb));
+    expect(lfrb_mpmc_avail(&_mpmc) == 0);
+}
+
+int main(void)
+{
+    for (unsigned i = 0; i < CHUNK_SIZE; i++) {
+        _in[i] = i;
+    }
+    lfrb_mpmc_init(&_mpmc, _mpmc_buf, _mpmc_seq, BUF_SIZE, 1);
+
+    BENCHMARK_RUN("tsrb one", BENCH_RUNS, _tsrb_one());
+    BENCHMARK_RUN("lfrb one", BENCH_RUNS, _lfrb_one());
+    BENCHMARK_RUN("lfrb_mpmc one", BENCH_RUNS, _mpmc_one());
+    expect(_out[0] == _in[0]);
+
+    BENCHMARK_RUN("tsrb bulk 64", BENCH_RUNS, _tsrb_bulk());
+    BENCHMARK_RUN("lfrb bulk 64", BENCH_RUNS, _lfrb_bulk());
+    BENCHMARK_RUN("lfrb_mpmc bulk 64", BENCH_RUNS, _mpmc_bulk());
+    _check();
+
+    BENCHMARK_RUN("tsrb elem 16", BENCH_RUNS, _tsrb_elem());
+    BENCHMARK_RUN("lfrb elem 16", BENCH_RUNS, _lfrb_elem());
+    _check();
+
+    puts("SUCCESS");
+
+    return 0;
+}
@@ -0,0 +1,32 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 Freie Universität Berlin
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+from testrunner.utils import expect_benchmark
+
+BENCHMARKS = [
+    "tsrb one",
+    "lfrb one",
+    "lfrb_mpmc one",
+    "tsrb bulk 64",
+    "lfrb bulk 64",
+    "lfrb_mpmc bulk 64",
+    "tsrb elem 16",
+    "lfrb elem 16",
+]
+
+
+def testfunc(child):
+    for name in BENCHMARKS:
+        expect_benchmark(child, name)
+    child.expect_exact("SUCCESS")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
@@ -0,0 +1,197 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Count erase and program operations with and without mtd_cache
+ *
+ * @}
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "container.h"
+#include "mtd.h"
+#include "mtd_cache.h"
+#include "mtd_emulated.h"
+#include "test_utils/expect.h"
+#include "ztimer.h"
+
+#define SECTOR_COUNT        (16U)
+#define PAGES_PER_SECTOR    (8U)
+#define PAGE_SIZE           (512U)
+#define SECTOR_SIZE         (PAGES_PER_SECTOR * PAGE_SIZE)
+#define MEMORY_SIZE         (SECTOR_COUNT * SECTOR_SIZE)
+
+#define CACHE_LINES         (2U)
+
+#define BLOCKS              (64U)
+#define RECORD_SIZE         (64U)
+#define LOG_SECTORS         (4U)
+#define KV_RECORD_SIZE      (32U)
+#define KV_REWRITES         (256U)
+
+MTD_EMULATED_DEV(0, SECTOR_COUNT, PAGES_PER_SECTOR, PAGE_SIZE);
+
+/* forwards to the emulated MTD and counts the operations */
+typedef struct {
+    mtd_dev_t mtd;
+    unsigned erase;
+    unsigned program;
+} _counter_t;
+
+static int _init(mtd_dev_t *mtd)
+{
+    (void)mtd;
+    return mtd_init(&mtd_emulated_dev0.base);
+}
+
+static int _read_page(mtd_dev_t *mtd, void *dest, uint32_t page,
+                      uint32_t offset, uint32_t size)
+{
+    (void)mtd;
+    return _mtd_emulated_driver.read_page(&mtd_emulated_dev0.base, dest, page,
+                                          offset, size);
+}
+
+static int _write_page(mtd_dev_t *mtd, const void *src, uint32_t page,
+                       uint32_t offset, uint32_t size)
+{
+    _counter_t *counter = container_of(mtd, _counter_t, mtd);
+
+    counter->program++;
+    return _mtd_emulated_driver.write_page(&mtd_emulated_dev0.base, src, page,
+                                           offset, size);
+}
+
+static int _erase_sector(mtd_dev_t *mtd, uint32_t sector, uint32_t count)
+{
+    _counter_t *counter = container_of(mtd, _counter_t, mtd);
+
+    counter->erase += count;
+    return _mtd_emulated_driver.erase_sector(&mtd_emulated_dev0.base, sector,
+                                             count);
+}
+
+static const mtd_desc_t _counter_driver = {
+    .init = _init,
+    .read_page = _read_page,
+    .write_page = _write_page,
+    .erase_sector = _erase_sector,
+};
+
+static _counter_t _counter = {
+    .mtd = {
+        .driver = &_counter_driver,
+        .sector_count = SECTOR_COUNT,
+        .pages_per_sector = PAGES_PER_SECTOR,
+        .page_size = PAGE_SIZE,
+        .write_size = 1,
+    },
+};
+
+static mtd_cache_line_t _lines[CACHE_LINES];
+static uint8_t _cache_buf[CACHE_LINES * SECTOR_SIZE];
+static mtd_cache_t _cache = MTD_CACHE_INIT(&_counter.mtd, _lines, _cache_buf);
+
+static uint8_t _data[PAGE_SIZE];
+static uint8_t _direct_result[MEMORY_SIZE];
+
+static void _blocks(mtd_dev_t *mtd)
+{
+    for (unsigned i = 0; i < BLOCKS; i++) {
+        /* data blocks start in the second sector */
+        _data[0] = i;
+        expect(mtd_write_page(mtd, _data, PAGES_PER_SECTOR + i, 0,
+                              PAGE_SIZE) == 0);
+        /* update the allocation table */
+        expect(mtd_write_page(mtd, &_data[0], 0, i * 2, 2) == 0);
+    }
+}
+
+static void _log(mtd_dev_t *mtd)
+{
+    const unsigned records = SECTOR_SIZE / RECORD_SIZE;
+
+    for (unsigned s = 0; s < LOG_SECTORS; s++) {
+        expect(mtd_erase_sector(mtd, s, 1) == 0);
+        for (unsigned i = 0; i < records; i++) {
+            _data[0] = i;
+            expect(mtd_write_page_raw(mtd, _data, s * PAGES_PER_SECTOR,
+                                      i * RECORD_SIZE, RECORD_SIZE) == 0);
+        }
+    }
+}
+
+static void _kv(mtd_dev_t *mtd)
+{
+    for (unsigned i = 0; i < KV_REWRITES; i++) {
+        _data[0] = i;
+        expect(mtd_write_page(mtd, _data, 0, KV_RECORD_SIZE,
+                              KV_RECORD_SIZE) == 0);
+    }
+}
+
+static uint32_t _run(void (*workload)(mtd_dev_t *), mtd_dev_t *mtd)
+{
+    memset(_mtd_emulated_memory0, 0xff, sizeof(_mtd_emulated_memory0));
+    expect(mtd_init(mtd) == 0);
+    _counter.erase = 0;
+    _counter.program = 0;
+
+    uint32_t start = ztimer_now(ZTIMER_USEC);
+
+    workload(mtd);
+    if (mtd == &_cache.mtd) {
+        expect(mtd_cache_flush(&_cache) == 0);
+    }
+    return ztimer_now(ZTIMER_USEC) - start;
+}
+
+static void _bench(const char *name, void (*workload)(mtd_dev_t *))
+{
+    uint32_t direct_us, cached_us;
+    unsigned erase, program;
+
+    direct_us = _run(workload, &_counter.mtd);
+    erase = _counter.erase;
+    program = _counter.program;
+    memcpy(_direct_result, _mtd_emulated_memory0, sizeof(_direct_result));
+
+    cached_us = _run(workload, &_cache.mtd);
+    expect(memcmp(_direct_result, _mtd_emulated_memory0,
+                  sizeof(_direct_result)) == 0);
+
+    printf("{ \"workload\" : \"%s\", "
+           "\"direct\" : { \"erase\" : %u, \"program\" : %u, \"us\" : %" PRIu32 " }, "
+           "\"cached\" : { \"erase\" : %u, \"program\" : %u, \"us\" : %" PRIu32 " } }\n",
+           name, erase, program, direct_us,
+           _counter.erase, _counter.program, cached_us);
+}
+
+int main(void)
+{
+    puts("main starting");
+
+    for (unsigned i = 0; i < sizeof(_data); i++) {
+        _data[i] = i;
+    }
+
+    _bench("blocks", _blocks);
+    _bench("log", _log);
+    _bench("kv", _kv);
+
+    puts("SUCCESS");
+
+    return 0;
+}
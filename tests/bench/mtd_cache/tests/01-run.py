@@ -0,0 +1,23 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 Freie Universität Berlin
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+
+def testfunc(child):
+    for workload in ("blocks", "log", "kv"):
+        child.expect(r"{{ \"workload\" : \"{}\", "
+                     r"\"direct\" : {{ \"erase\" : \d+, \"program\" : \d+, \"us\" : \d+ }}, "
+                     r"\"cached\" : {{ \"erase\" : \d+, \"program\" : \d+, \"us\" : \d+ }} }}"
+                     .format(workload))
+    child.expect_exact("SUCCESS")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
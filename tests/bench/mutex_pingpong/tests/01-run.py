@@ -9,10 +9,11 @@
 
 import sys
 from testrunner import run
+from testrunner.utils import expect_benchmark
 
 
 def testfunc(child):
-    child.expect(r"{ \"result\" : \d+(, \"ticks\" : \d+)? }")
+    expect_benchmark(child, "mutex_unlock pingpong")
 
 
 if __name__ == "__main__":
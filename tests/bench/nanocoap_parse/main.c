@@ -0,0 +1,89 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       nanocoap message parser benchmark
+ *
+ * @}
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "benchmark.h"
+#include "net/nanocoap.h"
+#include "test_utils/expect.h"
+
+#ifndef BENCH_RUNS
+#define BENCH_RUNS          (10000UL)
+#endif
+
+#define PAYLOAD_LEN         (64U)
+
+/* GET /riot/value, non-confirmable with a 2 byte token */
+static uint8_t _get[] = {
+    0x52, 0x01, 0x9e, 0x6b, 0x35, 0x61, 0xb4, 0x72,
+    0x69, 0x6f, 0x74, 0x05, 0x76, 0x61, 0x6c, 0x75,
+    0x65
+};
+static uint8_t _post[128];
+static size_t _post_len;
+static coap_pkt_t _pkt;
+static uint8_t _uri[CONFIG_NANOCOAP_URI_MAX];
+
+static void _build_post(void)
+{
+    static const uint8_t token[] = { 0xde, 0xad, 0xbe, 0xef };
+    coap_hdr_t *hdr = (coap_hdr_t *)_post;
+    ssize_t len = coap_build_hdr(hdr, COAP_TYPE_CON, token, sizeof(token),
+                                 COAP_METHOD_POST, 0x1234);
+
+    expect(len > 0);
+    coap_pkt_init(&_pkt, _post, sizeof(_post), len);
+    coap_opt_add_string(&_pkt, COAP_OPT_URI_HOST, "sensor.example", '\0');
+    coap_opt_add_uri_path(&_pkt, "/sensors/temp/0");
+    coap_opt_add_format(&_pkt, COAP_FORMAT_CBOR);
+    coap_opt_add_uri_query(&_pkt, "unit", "C");
+    coap_opt_add_uri_query(&_pkt, "n", "10");
+    coap_opt_add_uint(&_pkt, COAP_OPT_BLOCK2, 0x06);
+    len = coap_opt_finish(&_pkt, COAP_OPT_FINISH_PAYLOAD);
+    expect((len > 0) && (_pkt.payload_len >= PAYLOAD_LEN));
+    memset(_pkt.payload, 0x53, PAYLOAD_LEN);
+    _post_len = len + PAYLOAD_LEN;
+}
+
+int main(void)
+{
+    puts("main starting");
+
+    _build_post();
+
+    expect(coap_parse(&_pkt, _get, sizeof(_get)) == 0);
+    expect(coap_get_uri_path(&_pkt, _uri) > 0);
+    expect(!strcmp((char *)_uri, "/riot/value"));
+
+    expect(coap_parse(&_pkt, _post, _post_len) == 0);
+    expect(coap_get_uri_path(&_pkt, _uri) > 0);
+    expect(!strcmp((char *)_uri, "/sensors/temp/0"));
+    expect(_pkt.payload_len == PAYLOAD_LEN);
+
+    BENCHMARK_RUN("coap_parse() GET", BENCH_RUNS,
+                  coap_parse(&_pkt, _get, sizeof(_get)));
+    BENCHMARK_RUN("coap_parse() POST", BENCH_RUNS,
+                  coap_parse(&_pkt, _post, _post_len));
+    BENCHMARK_RUN("coap_get_uri_path()", BENCH_RUNS,
+                  coap_get_uri_path(&_pkt, _uri));
+
+    puts("SUCCESS");
+
+    return 0;
+}
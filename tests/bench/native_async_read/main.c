@@ -0,0 +1,207 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Measure latency and packet rate of native's async read
+ *
+ * @}
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "irq.h"
+#include "mutex.h"
+#include "net/ieee802154/radio.h"
+#include "socket_zep.h"
+#include "socket_zep_params.h"
+#include "test_utils/expect.h"
+#include "ztimer.h"
+
+#ifndef ROUNDS
+#define ROUNDS              (1000U)
+#endif
+
+#ifndef BURST
+#define BURST               (32U)
+#endif
+
+#ifndef TEST_DURATION_US
+#define TEST_DURATION_US    (1000000U)
+#endif
+
+/* a frame should never take that long */
+#define FRAME_TIMEOUT_US    (100000U)
+
+#define FRAME_LEN           (32U)
+#define CHANNEL             (26U)
+
+static socket_zep_t _zep[SOCKET_ZEP_MAX];
+static ieee802154_dev_t _radio[SOCKET_ZEP_MAX];
+
+/* write() of the host that does not get interrupted by RIOT */
+extern ssize_t _native_write(int fd, const void *buf, size_t count);
+
+#define TX  (&_radio[0])
+#define RX  (&_radio[1])
+
+static mutex_t _done = MUTEX_INIT_LOCKED;
+static volatile unsigned _received;
+static volatile unsigned _expected;
+static uint64_t _latency_sum;
+static uint32_t _latency_min;
+static uint32_t _latency_max;
+
+static void _radio_cb(ieee802154_dev_t *dev, ieee802154_trx_ev_t status)
+{
+    uint8_t frame[FRAME_LEN];
+    uint32_t now = ztimer_now(ZTIMER_USEC);
+
+    if (dev != RX || status != IEEE802154_RADIO_INDICATION_RX_DONE) {
+        return;
+    }
+
+    if (ieee802154_radio_len(dev) == FRAME_LEN &&
+        ieee802154_radio_read(dev, frame, sizeof(frame), NULL) == FRAME_LEN) {
+        uint32_t sent;
+
+        memcpy(&sent, &frame[3], sizeof(sent));
+        uint32_t latency = now - sent;
+
+        _latency_sum += latency;
+        _latency_min = latency < _latency_min ? latency : _latency_min;
+        _latency_max = latency > _latency_max ? latency : _latency_max;
+
+        if (++_received == _expected) {
+            mutex_unlock(&_done);
+        }
+    }
+
+    /* picks up frames that are already waiting */
+    ieee802154_radio_set_idle(dev, true);
+    ieee802154_radio_set_rx(dev);
+}
+
+static void _send(uint8_t seq)
+{
+    uint8_t frame[FRAME_LEN] = { 0x01, 0x00, seq };
+    uint32_t now = ztimer_now(ZTIMER_USEC);
+    iolist_t iol = { .iol_base = frame, .iol_len = sizeof(frame) };
+
+    memcpy(&frame[3], &now, sizeof(now));
+
+    /* fills in the ZEP header, the frame is written without airtime */
+    expect(ieee802154_radio_write(TX, &iol) == 0);
+    expect(_native_write(_zep[0].sock_fd, _zep[0].snd_buf,
+                         _zep[0].snd_len) == _zep[0].snd_len);
+}
+
+/* returns the number of frames that did not arrive */
+static unsigned _wait(void)
+{
+    if (ztimer_mutex_lock_timeout(ZTIMER_USEC, &_done, FRAME_TIMEOUT_US) == 0) {
+        return 0;
+    }
+
+    unsigned state = irq_disable();
+    unsigned lost = _expected - _received;
+
+    /* late frames must not wake up the next round */
+    _expected = 0;
+    mutex_trylock(&_done);
+    irq_restore(state);
+
+    return lost;
+}
+
+static void _reset(void)
+{
+    _received = 0;
+    _latency_sum = 0;
+    _latency_min = UINT32_MAX;
+    _latency_max = 0;
+}
+
+static void _bench_latency(void)
+{
+    unsigned lost = 0;
+
+    _reset();
+    for (unsigned i = 0; i < ROUNDS; i++) {
+        _expected = _received + 1;
+        _send(i);
+        lost += _wait();
+    }
+
+    printf("{ \"rounds\" : %u, \"lost\" : %u, "
+           "\"latency_us\" : { \"min\" : %" PRIu32 ", \"avg\" : %" PRIu32
+           ", \"max\" : %" PRIu32 " } }\n", ROUNDS, lost,
+           _latency_min, (uint32_t)(_latency_sum / (_received ? _received : 1)),
+           _latency_max);
+}
+
+static void _bench_pps(void)
+{
+    unsigned lost = 0;
+    uint8_t seq = 0;
+
+    _reset();
+    uint32_t start = ztimer_now(ZTIMER_USEC);
+    uint32_t elapsed;
+
+    do {
+        _expected = _received + BURST;
+        for (unsigned i = 0; i < BURST; i++) {
+            _send(seq++);
+        }
+        lost += _wait();
+        elapsed = ztimer_now(ZTIMER_USEC) - start;
+    } while (elapsed < TEST_DURATION_US);
+
+    printf("{ \"burst\" : %u, \"pps\" : %" PRIu32 ", \"lost\" : %u }\n", BURST,
+           (uint32_t)((uint64_t)_received * US_PER_SEC / elapsed), lost);
+}
+
+static void _init_radio(ieee802154_dev_t *radio, socket_zep_t *zep,
+                        const socket_zep_params_t *params)
+{
+    ieee802154_phy_conf_t conf = {
+        .phy_mode = IEEE802154_PHY_OQPSK,
+        .channel = CHANNEL,
+        .page = 0,
+        .pow = 0,
+    };
+
+    socket_zep_hal_setup(zep, radio);
+    socket_zep_setup(zep, params);
+    radio->cb = _radio_cb;
+
+    expect(ieee802154_radio_request_on(radio) == 0);
+    while (ieee802154_radio_confirm_on(radio) == -EAGAIN) {}
+    expect(ieee802154_radio_config_phy(radio, &conf) == 0);
+    expect(ieee802154_radio_set_frame_filter_mode(radio,
+                                                  IEEE802154_FILTER_PROMISC) == 0);
+}
+
+int main(void)
+{
+    for (unsigned i = 0; i < SOCKET_ZEP_MAX; i++) {
+        _init_radio(&_radio[i], &_zep[i], &socket_zep_params[i]);
+    }
+    expect(ieee802154_radio_set_rx(RX) == 0);
+
+    _bench_latency();
+    _bench_pps();
+
+    return 0;
+}
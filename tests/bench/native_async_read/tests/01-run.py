@@ -0,0 +1,23 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 Freie Universität Berlin
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+
+def testfunc(child):
+    child.expect(r"{ \"rounds\" : (\d+), \"lost\" : (\d+), "
+                 r"\"latency_us\" : { \"min\" : \d+, \"avg\" : \d+, "
+                 r"\"max\" : \d+ } }")
+    assert int(child.match.group(1)) > int(child.match.group(2))
+    child.expect(r"{ \"burst\" : \d+, \"pps\" : (\d+), \"lost\" : \d+ }")
+    assert int(child.match.group(1)) > 0
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
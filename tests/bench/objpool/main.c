@@ -0,0 +1,244 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Benchmark of the thread-safe object pool against memarray
+ *
+ * @}
+ */
+
+#include <stdatomic.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "benchmark.h"
+#include "container.h"
+#include "irq.h"
+#include "memarray.h"
+#include "mutex.h"
+#include "objpool.h"
+#include "test_utils/expect.h"
+#include "thread.h"
+#include "thread_flags.h"
+#include "ztimer.h"
+
+#ifndef BENCH_RUNS
+#define BENCH_RUNS      (2000UL)
+#endif
+
+#ifndef WORKER_OPS
+#define WORKER_OPS      (20000UL)
+#endif
+
+#define WORKER_NUMOF    (4U)
+#define WORKER_HOLD     (2U)
+#define NUM_OBJS        (WORKER_NUMOF * (WORKER_HOLD + CONFIG_OBJPOOL_CACHE_SIZE))
+
+#define FLAG_START      (0x1)
+#define FLAG_DONE       (0x2)
+
+typedef struct {
+    kernel_pid_t owner;
+    uint32_t seq;
+} obj_t;
+
+typedef struct {
+    const char *name;
+    void (*init)(void);
+    void *(*alloc)(void);
+    void (*free)(void *obj);
+} variant_t;
+
+static obj_t _objs[NUM_OBJS];
+static memarray_t _memarray;
+static mutex_t _lock = MUTEX_INIT;
+static objpool_t _pool;
+static objpool_cache_t _caches[MAXTHREADS];
+
+static char _stacks[WORKER_NUMOF][THREAD_STACKSIZE_DEFAULT];
+static thread_t *_workers[WORKER_NUMOF];
+static thread_t *_main;
+static const variant_t *_variant;
+static atomic_uint _failures;
+static atomic_uint _running;
+
+static void _memarray_init(void)
+{
+    memarray_init(&_memarray, _objs, sizeof(obj_t), NUM_OBJS);
+}
+
+static void *_memarray_mutex_alloc(void)
+{
+    mutex_lock(&_lock);
+    void *obj = memarray_alloc(&_memarray);
+    mutex_unlock(&_lock);
+    return obj;
+}
+
+static void _memarray_mutex_free(void *obj)
+{
+    mutex_lock(&_lock);
+    memarray_free(&_memarray, obj);
+    mutex_unlock(&_lock);
+}
+
+static void *_memarray_irq_alloc(void)
+{
+    unsigned state = irq_disable();
+    void *obj = memarray_alloc(&_memarray);
+    irq_restore(state);
+    return obj;
+}
+
+static void _memarray_irq_free(void *obj)
+{
+    unsigned state = irq_disable();
+    memarray_free(&_memarray, obj);
+    irq_restore(state);
+}
+
+static void _objpool_init(void)
+{
+    objpool_init(&_pool, _objs, sizeof(obj_t), NUM_OBJS);
+}
+
+static void _objpool_cache_init(void)
+{
+    _objpool_init();
+    objpool_cache_init(&_pool, _caches);
+}
+
+static void *_objpool_alloc(void)
+{
+    return objpool_alloc(&_pool);
+}
+
+static void _objpool_free(void *obj)
+{
+    objpool_free(&_pool, obj);
+}
+
+static const variant_t _variants[] = {
+    { "memarray mutex", _memarray_init, _memarray_mutex_alloc,
+      _memarray_mutex_free },
+    { "memarray irq", _memarray_init, _memarray_irq_alloc, _memarray_irq_free },
+    { "objpool", _objpool_init, _objpool_alloc, _objpool_free },
+    { "objpool cache", _objpool_cache_init, _objpool_alloc, _objpool_free },
+};
+
+static void _alloc_free(const variant_t *v)
+{
+    v->free(v->alloc());
+}
+
+static void _work(const variant_t *v)
+{
+    kernel_pid_t pid = thread_getpid();
+    obj_t *held[WORKER_HOLD];
+
+    for (uint32_t seq = 0; seq < WORKER_OPS; seq++) {
+        for (unsigned i = 0; i < WORKER_HOLD; i++) {
+            held[i] = v->alloc();
+            if (!held[i]) {
+                atomic_fetch_add(&_failures, 1);
+                continue;
+            }
+            held[i]->owner = pid;
+            held[i]->seq = seq;
+        }
+        /* no other thread got the same objects in between */
+        for (unsigned i = 0; i < WORKER_HOLD; i++) {
+            if (held[i]) {
+                expect((held[i]->owner == pid) && (held[i]->seq == seq));
+                v->free(held[i]);
+            }
+        }
+    }
+    if (v->init == _objpool_cache_init) {
+        objpool_cache_flush(&_pool);
+    }
+}
+
+static void *_worker(void *arg)
+{
+    (void)arg;
+
+    while (1) {
+        thread_flags_wait_any(FLAG_START);
+        _work(_variant);
+        if (atomic_fetch_sub(&_running, 1) == 1) {
+            thread_flags_set(_main, FLAG_DONE);
+        }
+    }
+
+    return NULL;
+}
+
+static void _contention(const variant_t *v)
+{
+    char name[32];
+
+    _variant = v;
+    atomic_store(&_failures, 0);
+    atomic_store(&_running, WORKER_NUMOF);
+    v->init();
+
+    /* the workers have a lower priority, they start when main waits */
+    uint32_t start = ztimer_now(ZTIMER_USEC);
+    for (unsigned i = 0; i < WORKER_NUMOF; i++) {
+        thread_flags_set(_workers[i], FLAG_START);
+    }
+    thread_flags_wait_any(FLAG_DONE);
+    uint32_t time = ztimer_now(ZTIMER_USEC) - start;
+
+    snprintf(name, sizeof(name), "%s %ux", v->name, WORKER_NUMOF);
+    benchmark_print_time(time, WORKER_NUMOF * WORKER_OPS * WORKER_HOLD, name);
+    expect(atomic_load(&_failures) == 0);
+}
+
+int main(void)
+{
+    objpool_stats_t stats;
+
+    ztimer_acquire(ZTIMER_USEC);
+
+    _main = thread_get_active();
+    for (unsigned i = 0; i < WORKER_NUMOF; i++) {
+        kernel_pid_t pid = thread_create(_stacks[i], sizeof(_stacks[i]),
+                                         THREAD_PRIORITY_MAIN + 1, 0,
+                                         _worker, NULL, "worker");
+        _workers[i] = thread_get(pid);
+    }
+
+    for (unsigned i = 0; i < ARRAY_SIZE(_variants); i++) {
+        const variant_t *v = &_variants[i];
+
+        v->init();
+        BENCHMARK_RUN(v->name, BENCH_RUNS, _alloc_free(v));
+    }
+
+    for (unsigned i = 0; i < ARRAY_SIZE(_variants); i++) {
+        _contention(&_variants[i]);
+    }
+
+    expect(objpool_available(&_pool) == NUM_OBJS);
+    objpool_get_stats(&_pool, &stats);
+    expect(stats.in_use == 0);
+    expect(stats.high_water <= WORKER_NUMOF * WORKER_HOLD);
+    benchmark_print_value("objpool high water", "objs", stats.high_water);
+
+    ztimer_release(ZTIMER_USEC);
+    puts("SUCCESS");
+
+    return 0;
+}
@@ -0,0 +1,111 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Benchmark for the CRC32 implementations
+ *
+ * @}
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include "checksum/crc32.h"
+#include "container.h"
+#include "modules.h"
+#include "test_utils/expect.h"
+#include "ztimer.h"
+
+#ifndef BENCH_BYTES
+#define BENCH_BYTES     (4UL * 1024 * 1024)
+#endif
+
+#if IS_USED(MODULE_CRC32_HW)
+#define CRC32_IMPL      "hw"
+#elif IS_USED(MODULE_CRC32_SLICE8)
+#define CRC32_IMPL      "slice8"
+#elif IS_USED(MODULE_CRC32_SLICE4)
+#define CRC32_IMPL      "slice4"
+#elif IS_USED(MODULE_CRC32_FAST)
+#define CRC32_IMPL      "fast"
+#else
+#define CRC32_IMPL      "bitwise"
+#endif
+
+/* with a spare byte to benchmark unaligned access */
+static uint32_t _buf[(4096 / sizeof(uint32_t)) + 1];
+
+/* the bitwise loop of the default implementation */
+static uint32_t _bitwise_crc32(const uint8_t *buf, size_t len)
+{
+    uint32_t crc = ~0U;
+
+    while (len--) {
+        crc ^= *buf++;
+        for (unsigned i = 0; i < 8; i++) {
+            crc = (crc >> 1) ^ (crc & 1) * 0xEDB88320;
+        }
+    }
+    return ~crc;
+}
+
+/* MiB/s times 100 */
+static uint32_t _mib_s_100(uint32_t bytes, uint32_t us)
+{
+    return (uint32_t)(((uint64_t)bytes * 100 * 1000000) / (1024 * 1024) / us);
+}
+
+static void _bench(size_t len, unsigned offset)
+{
+    const uint8_t *buf = (uint8_t *)_buf + offset;
+    unsigned runs = BENCH_BYTES / len;
+    volatile uint32_t sink;
+    uint32_t start, bitwise_us, crc32_us, bitwise, impl;
+
+    expect(_bitwise_crc32(buf, len) == crc32(buf, len));
+    /* the bitwise loop is slow, a fraction of the data is enough */
+    start = ztimer_now(ZTIMER_USEC);
+    for (unsigned i = 0; i < (runs + 7) / 8; i++) {
+        sink = _bitwise_crc32(buf, len);
+    }
+    bitwise_us = ztimer_now(ZTIMER_USEC) - start;
+    start = ztimer_now(ZTIMER_USEC);
+    for (unsigned i = 0; i < runs; i++) {
+        sink = crc32(buf, len);
+    }
+    crc32_us = ztimer_now(ZTIMER_USEC) - start;
+    (void)sink;
+
+    bitwise = _mib_s_100(((runs + 7) / 8) * len, bitwise_us + 1);
+    impl = _mib_s_100(runs * len, crc32_us + 1);
+    printf("{ \"impl\" : \"%s\", \"len\" : %u, \"offset\" : %u, "
+           "\"bitwise_mib_s\" : %" PRIu32 ".%02" PRIu32 ", "
+           "\"crc32_mib_s\" : %" PRIu32 ".%02" PRIu32 " }\n",
+           CRC32_IMPL, (unsigned)len, offset, bitwise / 100, bitwise % 100,
+           impl / 100, impl % 100);
+}
+
+int main(void)
+{
+    static const uint16_t lens[] = { 16, 64, 256, 4096 };
+
+    for (unsigned i = 0; i < sizeof(_buf); i++) {
+        ((uint8_t *)_buf)[i] = i * 7;
+    }
+    for (unsigned i = 0; i < ARRAY_SIZE(lens); i++) {
+        _bench(lens[i], 0);
+        _bench(lens[i], 1);
+    }
+    puts("SUCCESS");
+
+    return 0;
+}
@@ -0,0 +1,23 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 Freie Universität Berlin
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+
+def testfunc(child):
+    for length in (16, 64, 256, 4096):
+        for offset in (0, 1):
+            child.expect(r"{{ \"impl\" : \"\w+\", \"len\" : {}, \"offset\" : {}, "
+                         r"\"bitwise_mib_s\" : \d+\.\d+, \"crc32_mib_s\" : \d+\.\d+ }}"
+                         .format(length, offset))
+    child.expect_exact("SUCCESS")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
@@ -33,6 +33,7 @@
 #include <stdlib.h>
 #include <time.h>
 
+#include "benchmark.h"
 #include "xtimer.h"
 #include "thread.h"
 #include "msg.h"
@@ -95,9 +96,9 @@ static void *slacker_thread(void *arg)
     return NULL;
 }
 
-static volatile int32_t _min_drift, _max_drift, _min_jitter, _max_jitter;
-static volatile int32_t _final_drift;
-static volatile uint32_t _total_jitter, _samples;
+static int32_t _drift[TEST_TIME];
+static int32_t _jitter[TEST_TIME];
+static volatile unsigned _samples;
 
 /* This thread will print the drift to stdout once per second */
 void *worker_thread(void *arg)
@@ -130,21 +131,11 @@ void *worker_thread(void *arg)
             int32_t drift = now - expected;
             expected = last + TEST_HZ * test_interval;
             int32_t jitter = now - expected;
-            if (jitter < _min_jitter) {
-                _min_jitter = jitter;
+            if (_samples < TEST_TIME) {
+                _drift[_samples] = drift;
+                _jitter[_samples] = jitter;
+                _samples++;
             }
-            if (jitter > _max_jitter) {
-                _max_jitter = jitter;
-            }
-            if (drift < _min_drift) {
-                _min_drift = drift;
-            }
-            if (drift > _max_drift) {
-                _max_drift = drift;
-            }
-            _final_drift = drift;
-            _total_jitter += labs(jitter);
-            _samples++;
 
             last = now;
             puts(".");
@@ -202,10 +193,28 @@ int main(void)
         msg_send(&m, pid3);
     }
 
-    printf("drift: min=%" PRIi32 " max=%" PRIi32 " final=%" PRIi32 "\n",
-           _min_drift, _max_drift, _final_drift);
-    printf("jitter: min=%" PRIi32 " max=%" PRIi32 " abs avg=%" PRIi32 "\n",
-           _min_jitter, _max_jitter, _total_jitter / _samples);
+    unsigned samples = _samples;
+    int32_t final_drift = _drift[samples - 1];
+    uint32_t total_jitter = 0;
+
+    for (unsigned i = 0; i < samples; i++) {
+        total_jitter += labs(_jitter[i]);
+    }
+
+    benchmark_result_t res = {
+        .name = "drift",
+        .unit = "us",
+        .runs = 1,
+        .samples = samples,
+    };
+    benchmark_stats(&res.time, _drift, samples);
+    benchmark_print_result(&res);
+    benchmark_print_value("final drift", "us", final_drift);
+
+    res.name = "jitter";
+    benchmark_stats(&res.time, _jitter, samples);
+    benchmark_print_result(&res);
+    benchmark_print_value("jitter abs avg", "us", total_jitter / samples);
 
     puts("[DONE]");
 }
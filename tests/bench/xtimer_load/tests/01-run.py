@@ -11,6 +11,7 @@
 
 import sys
 from testrunner import run
+from testrunner.utils import expect_benchmark
 
 
 def testfunc(child):
@@ -19,8 +20,10 @@ def testfunc(child):
     for _ in range(10):
         child.expect_exact(".\r\n")
 
-    child.expect(r"drift: min=-?\d+ max=-?\d+ final=-?\d+\r\n")
-    child.expect(r"jitter: min=-?\d+ max=-?\d+ abs avg=\d+\r\n")
+    expect_benchmark(child, "drift")
+    expect_benchmark(child, "final drift")
+    expect_benchmark(child, "jitter")
+    expect_benchmark(child, "jitter abs avg")
 
     child.expect_exact("[DONE]\r\n")
 
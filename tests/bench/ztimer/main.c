@@ -22,6 +22,7 @@
 
 #include "test_utils/expect.h"
 
+#include "benchmark.h"
 #include "msg.h"
 #include "thread.h"
 #include "ztimer.h"
@@ -42,8 +43,10 @@
 #define BASE    (10000000LU)
 #endif
 
+/* a repeated benchmark sets the same timer again and again for all of its
+ * samples, it must not pass its neighbours while doing so */
 #ifndef SPREAD
-#define SPREAD  (10LU)
+#define SPREAD  (1000LU)
 #endif
 
 static ztimer_t _timers[NUMOF_TIMERS];
@@ -58,9 +61,10 @@ static unsigned _triggers;
  * The test assumes that first, middle and last will always end up in at the
  * same index within the timer queue.  In order to compensate for the time that
  * previous operations take themselves, the interval is corrected. The
- * variables "start" and "_base" are used for that.
+ * variables "_start" and "_base" are used for that.
  */
-uint32_t _base;
+static uint32_t _start;
+static uint32_t _base;
 
 static void _callback(void *arg) {
     unsigned *triggers = arg;
@@ -86,17 +90,29 @@ static void _timer_remove(unsigned n)
     ztimer_remove(ZTIMER, &_timers[n]);
 }
 
-static void _print_result(const char *desc, unsigned n, uint32_t total)
+static void _timer_set_remove(unsigned n)
 {
-    printf("%30s %8"PRIu32" / %u = %"PRIu32"\n", desc, total, n, total/n);
+    _timer_set(n);
+    _timer_remove(n);
+}
+
+static void _timer_remove_set(unsigned n)
+{
+    _timer_remove(n);
+    _timer_set(n);
+}
+
+/* compensate for the time the previous benchmarks took */
+static void _correct_base(void)
+{
+    _base = BASE - (ztimer_now(ZTIMER) - _start);
 }
 
 int main(void)
 {
     puts("ztimer benchmark application.\n");
 
-    unsigned n;
-    uint32_t before, diff, start;
+    uint32_t before, diff;
 
     /* initializing timer structs */
     for (unsigned int n = 0; n < NUMOF_TIMERS; n++) {
@@ -104,191 +120,106 @@ int main(void)
         _timers[n].arg = &_triggers;
     }
 
-    start = ztimer_now(ZTIMER_USEC);
+    _start = ztimer_now(ZTIMER);
 
     /*
      * test setting one set timer REPEAT times
      *
      */
     _base = BASE;
-    before = ztimer_now(ZTIMER_USEC);
-    for (n = 0; n < REPEAT; n++) {
-        _timer_set(0);
-    }
-
-    diff = ztimer_now(ZTIMER_USEC) - before;
-
-    _print_result("set() one", REPEAT, diff);
+    BENCHMARK_RUN("set() one", REPEAT, _timer_set(0));
     expect(!_triggers);
 
     /*
      * test removing one unset timer REPEAT times
      *
      */
-    before = ztimer_now(ZTIMER_USEC);
-    for (n = 0; n < REPEAT; n++) {
-        _timer_remove(0);
-    }
-
-    diff = ztimer_now(ZTIMER_USEC) - before;
-
-    _print_result("remove() one", REPEAT, diff);
+    BENCHMARK_RUN("remove() one", REPEAT, _timer_remove(0));
     expect(!_triggers);
 
     /*
      * test setting / removing one timer REPEAT times
      *
      */
-    before = ztimer_now(ZTIMER_USEC);
-    _base = BASE  - (before - start);
-    for (n = 0; n < REPEAT; n++) {
-        _timer_set(0);
-        _timer_remove(0);
-    }
-
-    diff = ztimer_now(ZTIMER_USEC) - before;
-
-    _print_result("set() + remove() one", REPEAT, diff);
+    _correct_base();
+    BENCHMARK_RUN("set() + remove() one", REPEAT, _timer_set_remove(0));
     expect(!_triggers);
 
     /*
      * test setting NUMOF_TIMERS timers with increasing targets
      *
+     * This can only be done once, so there are no statistics.
      */
+    _correct_base();
+    ztimer_acquire(ZTIMER_USEC);
     before = ztimer_now(ZTIMER_USEC);
-    _base = BASE  - (before - start);
     for (unsigned int n = 0; n < NUMOF_TIMERS; n++) {
         _timer_set(n);
     }
-
     diff = ztimer_now(ZTIMER_USEC) - before;
+    ztimer_release(ZTIMER_USEC);
 
-    _print_result("set() many increasing target", NUMOF_TIMERS, diff);
+    benchmark_print_time(diff, NUMOF_TIMERS, "set() many increasing target");
     expect(!_triggers);
 
     /*
-     * test re-setting first timer REPEAT times
+     * test re-setting first, middle and last timer REPEAT times
      *
      */
-    before = ztimer_now(ZTIMER_USEC);
-    _base = BASE  - (before - start);
-    for (n = 0; n < REPEAT; n++) {
-        _timer_set(0);
-    }
-
-    diff = ztimer_now(ZTIMER_USEC) - before;
-
-    _print_result("re-set()  first", REPEAT, diff);
+    _correct_base();
+    BENCHMARK_RUN("re-set() first", REPEAT, _timer_set(0));
     expect(!_triggers);
 
-    /*
-     * test setting middle timer REPEAT times
-     *
-     */
-    before = ztimer_now(ZTIMER_USEC);
-    _base = BASE  - (before - start);
-    for (n = 0; n < REPEAT; n++) {
-        _timer_set(NUMOF_TIMERS/2);
-    }
-
-    diff = ztimer_now(ZTIMER_USEC) - before;
-
-    _print_result("re-set() middle", REPEAT, diff);
+    _correct_base();
+    BENCHMARK_RUN("re-set() middle", REPEAT, _timer_set(NUMOF_TIMERS / 2));
     expect(!_triggers);
 
-    /*
-     * test setting last timer REPEAT times
-     *
-     */
-    before = ztimer_now(ZTIMER_USEC);
-    _base = BASE  - (before - start);
-    for (n = 0; n < REPEAT; n++) {
-        _timer_set(NUMOF_TIMERS - 1);
-    }
-
-    diff = ztimer_now(ZTIMER_USEC) - before;
-
-    _print_result("re-set()   last", REPEAT, diff);
+    _correct_base();
+    BENCHMARK_RUN("re-set() last", REPEAT, _timer_set(NUMOF_TIMERS - 1));
     expect(!_triggers);
 
     /*
-     * test removing / setting first timer REPEAT times
+     * test removing / setting first, middle and last timer REPEAT times
      *
      */
-    before = ztimer_now(ZTIMER_USEC);
-    _base = BASE  - (before - start);
-    for (n = 0; n < REPEAT; n++) {
-        _timer_remove(0);
-        _timer_set(0);
-    }
-
-    diff = ztimer_now(ZTIMER_USEC) - before;
-
-    _print_result("remove() + set()  first", REPEAT, diff);
+    _correct_base();
+    BENCHMARK_RUN("remove() + set() first", REPEAT, _timer_remove_set(0));
     expect(!_triggers);
 
-    /*
-     * test removing / setting middle timer REPEAT times
-     *
-     */
-    before = ztimer_now(ZTIMER_USEC);
-    _base = BASE  - (before - start);
-    for (n = 0; n < REPEAT; n++) {
-        _timer_remove(NUMOF_TIMERS/2);
-        _timer_set(NUMOF_TIMERS/2);
-    }
-
-    diff = ztimer_now(ZTIMER_USEC) - before;
-
-    _print_result("remove() + set() middle", REPEAT, diff);
+    _correct_base();
+    BENCHMARK_RUN("remove() + set() middle", REPEAT,
+                  _timer_remove_set(NUMOF_TIMERS / 2));
     expect(!_triggers);
 
-    /*
-     * test removing / setting last timer REPEAT times
-     *
-     */
-    before = ztimer_now(ZTIMER_USEC);
-    _base = BASE  - (before - start);
-    for (n = 0; n < REPEAT; n++) {
-        _timer_remove(NUMOF_TIMERS - 1);
-        _timer_set(NUMOF_TIMERS - 1);
-    }
-
-    diff = ztimer_now(ZTIMER_USEC) - before;
-
-    _print_result("remove() + set()   last", REPEAT, diff);
+    _correct_base();
+    BENCHMARK_RUN("remove() + set() last", REPEAT,
+                  _timer_remove_set(NUMOF_TIMERS - 1));
     expect(!_triggers);
 
     /*
      * test removing NUMOF_TIMERS timers (latest first)
      *
+     * This can only be done once, so there are no statistics.
      */
+    ztimer_acquire(ZTIMER_USEC);
     before = ztimer_now(ZTIMER_USEC);
-    for (n = 0; n < NUMOF_TIMERS; n++) {
+    for (unsigned n = 0; n < NUMOF_TIMERS; n++) {
         _timer_remove(NUMOF_TIMERS - n - 1);
     }
-
     diff = ztimer_now(ZTIMER_USEC) - before;
+    ztimer_release(ZTIMER_USEC);
 
-    _print_result("remove() many decreasing", NUMOF_TIMERS, diff);
+    benchmark_print_time(diff, NUMOF_TIMERS, "remove() many decreasing");
     expect(!_triggers);
 
     /*
      * test ztimer_now()
      *
      */
-    before = ztimer_now(ZTIMER_USEC);
-    n = REPEAT;
-    while (n--) {
-        ztimer_now(ZTIMER);
-    }
-
-    diff = ztimer_now(ZTIMER_USEC) - before;
-
-    _print_result("ztimer_now()", REPEAT, diff);
+    BENCHMARK_RUN("ztimer_now()", REPEAT, ztimer_now(ZTIMER));
     expect(!_triggers);
 
-    _print_result("sizeof(ztimer_t)", NUMOF_TIMERS, sizeof(_timers));
+    benchmark_print_value("sizeof(ztimer_t)", "bytes", sizeof(ztimer_t));
 
     puts("done.");
 
@@ -8,12 +8,30 @@
 
 import sys
 from testrunner import run
+from testrunner.utils import expect_benchmark
+
+BENCHMARKS = [
+    "set() one",
+    "remove() one",
+    "set() + remove() one",
+    "set() many increasing target",
+    "re-set() first",
+    "re-set() middle",
+    "re-set() last",
+    "remove() + set() first",
+    "remove() + set() middle",
+    "remove() + set() last",
+    "remove() many decreasing",
+    "ztimer_now()",
+]
 
 
 def testfunc(child):
     child.expect_exact("ztimer benchmark application.\r\n")
-    for i in range(13):
-        child.expect(r"\s+[\w() _\+]+\s+\d+ / \d+ = \d+\r\n")
+    for name in BENCHMARKS:
+        expect_benchmark(child, name)
+    res = expect_benchmark(child, "sizeof(ztimer_t)")
+    assert res["unit"] == "bytes"
 
     child.expect_exact("done.\r\n")
 
@@ -0,0 +1,96 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Profile the packet buffer and msg hot path with native_prof
+ *
+ * @}
+ */
+
+#include <stdio.h>
+
+#include "msg.h"
+#include "native_prof.h"
+#include "net/gnrc/pktbuf.h"
+#include "test_utils/expect.h"
+#include "thread.h"
+#include "ztimer.h"
+
+#ifndef TEST_DURATION_US
+#define TEST_DURATION_US    (300000U)
+#endif
+
+#define PAYLOAD_LEN         (64U)
+
+static char _echo_stack[THREAD_STACKSIZE_DEFAULT];
+static char _worker_stack[THREAD_STACKSIZE_DEFAULT];
+static kernel_pid_t _echo_pid;
+static unsigned _rounds;
+
+static void *_echo(void *arg)
+{
+    (void)arg;
+    msg_t msg;
+
+    while (1) {
+        msg_receive(&msg);
+        gnrc_pktbuf_release(msg.content.ptr);
+        msg_reply(&msg, &msg);
+    }
+
+    return NULL;
+}
+
+static void *_worker(void *arg)
+{
+    (void)arg;
+    uint8_t payload[PAYLOAD_LEN] = { 0 };
+    uint32_t start = ztimer_now(ZTIMER_USEC);
+
+    while (ztimer_now(ZTIMER_USEC) - start < TEST_DURATION_US) {
+        msg_t msg, reply;
+        gnrc_pktsnip_t *pkt = gnrc_pktbuf_add(NULL, payload, sizeof(payload),
+                                              GNRC_NETTYPE_UNDEF);
+
+        expect(pkt != NULL);
+        msg.content.ptr = pkt;
+        msg_send_receive(&msg, &reply, _echo_pid);
+        _rounds++;
+    }
+
+    return NULL;
+}
+
+int main(void)
+{
+    native_prof_stats_t stats;
+
+    _echo_pid = thread_create(_echo_stack, sizeof(_echo_stack),
+                              THREAD_PRIORITY_MAIN - 2, 0, _echo, NULL, "echo");
+
+    native_prof_start();
+    /* runs until done, as it has a higher priority than main */
+    thread_create(_worker_stack, sizeof(_worker_stack),
+                  THREAD_PRIORITY_MAIN - 1, 0, _worker, NULL, "worker");
+    native_prof_stop();
+
+    native_prof_get_stats(&stats);
+    printf("rounds: %u, samples: %" PRIu32 ", dropped: %" PRIu32
+           ", stacks: %" PRIu32 "\n", _rounds, stats.samples, stats.dropped,
+           stats.stacks);
+
+    puts("profile start");
+    native_prof_export_stdio();
+    puts("profile end");
+
+    return 0;
+}
@@ -0,0 +1,62 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 Freie Universität Berlin
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import os
+import subprocess
+import sys
+
+from testrunner import run
+
+RIOTBASE = os.getenv("RIOTBASE", os.path.abspath(
+    os.path.join(os.path.dirname(__file__), "../../../..")))
+NATIVE_PROF = os.path.join(RIOTBASE, "dist/tools/native_prof/native_prof.py")
+
+# 300 ms of ping-pong at one sample per ms of CPU time, with plenty of margin
+MIN_SAMPLES = 10
+
+
+def testfunc(child):
+    child.expect(r"rounds: (\d+), samples: (\d+), dropped: (\d+), stacks: (\d+)\r\n")
+    rounds, samples, dropped, stacks = (int(g) for g in child.match.groups())
+    assert rounds > 0
+    assert samples >= MIN_SAMPLES, samples
+    assert dropped == 0, dropped
+
+    child.expect_exact("profile start\r\n")
+    child.expect_exact("profile end\r\n")
+    profile = child.before
+    assert len(profile.splitlines()) == stacks
+
+    folded = subprocess.run([NATIVE_PROF, os.environ["ELFFILE"]],
+                            input=profile, capture_output=True, text=True,
+                            check=True).stdout
+    print(folded, end="")
+    counts = {}
+    for line in folded.splitlines():
+        stack, count = line.rsplit(" ", 1)
+        counts[stack] = int(count)
+    assert sum(counts.values()) == samples
+
+    def samples_in(thread, func):
+        return sum(c for s, c in counts.items()
+                   if s.startswith(thread + ";") and func in s.split(";"))
+
+    # samples are tagged with the thread that was running
+    assert samples_in("worker", "_worker") > 0
+    assert samples_in("echo", "_echo") > 0
+    assert samples_in("echo", "_worker") == 0
+    assert samples_in("worker", "_echo") == 0
+    # and show the hot path
+    assert samples_in("worker", "msg_send_receive") > 0
+    assert samples_in("echo", "msg_receive") > 0
+
+    print("All tests successful")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
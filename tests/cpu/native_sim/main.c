@@ -0,0 +1,142 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Exchange frames between native instances in virtual time
+ *
+ * @}
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/types.h>
+
+#include "mutex.h"
+#include "net/ieee802154/radio.h"
+#include "socket_zep.h"
+#include "socket_zep_params.h"
+#include "test_utils/expect.h"
+#include "ztimer.h"
+
+#ifndef ROUNDS
+#define ROUNDS      (5U)
+#endif
+
+#define PERIOD_US   (1000000U)
+#define FRAME_LEN   (16U)
+#define CHANNEL     (26U)
+
+/* id given with -i */
+extern pid_t _native_id;
+
+static socket_zep_t _zep;
+static ieee802154_dev_t _radio;
+
+static mutex_t _tx_done = MUTEX_INIT_LOCKED;
+
+static struct {
+    uint32_t sent;
+    uint32_t recv;
+    uint8_t src;
+} _rx[2 * ROUNDS];
+static volatile unsigned _rx_numof;
+
+static void _radio_cb(ieee802154_dev_t *dev, ieee802154_trx_ev_t status)
+{
+    uint8_t frame[FRAME_LEN];
+
+    switch (status) {
+    case IEEE802154_RADIO_CONFIRM_TX_DONE:
+        mutex_unlock(&_tx_done);
+        break;
+    case IEEE802154_RADIO_INDICATION_RX_DONE:
+        if (ieee802154_radio_len(dev) == FRAME_LEN &&
+            ieee802154_radio_read(dev, frame, sizeof(frame), NULL) == FRAME_LEN &&
+            _rx_numof < ARRAY_SIZE(_rx)) {
+            _rx[_rx_numof].recv = ztimer_now(ZTIMER_USEC);
+            _rx[_rx_numof].src = frame[3];
+            memcpy(&_rx[_rx_numof].sent, &frame[4], sizeof(uint32_t));
+            _rx_numof++;
+        }
+        ieee802154_radio_set_idle(dev, true);
+        ieee802154_radio_set_rx(dev);
+        break;
+    default:
+        break;
+    }
+}
+
+static void _send(void)
+{
+    uint8_t frame[FRAME_LEN] = { 0x01, 0x00, 0x00, _native_id };
+    uint32_t now = ztimer_now(ZTIMER_USEC);
+    iolist_t iol = { .iol_base = frame, .iol_len = sizeof(frame) };
+
+    memcpy(&frame[4], &now, sizeof(now));
+
+    expect(ieee802154_radio_set_idle(&_radio, true) == 0);
+    expect(ieee802154_radio_write(&_radio, &iol) == 0);
+    expect(ieee802154_radio_request_transmit(&_radio) == 0);
+    mutex_lock(&_tx_done);
+    expect(ieee802154_radio_confirm_transmit(&_radio, NULL) == 0);
+    expect(ieee802154_radio_set_rx(&_radio) == 0);
+
+    printf("node %u: sent at %" PRIu32 "\n", (unsigned)_native_id, now);
+}
+
+static void _init_radio(void)
+{
+    ieee802154_phy_conf_t conf = {
+        .phy_mode = IEEE802154_PHY_OQPSK,
+        .channel = CHANNEL,
+        .page = 0,
+        .pow = 0,
+    };
+    uint8_t addr_long[IEEE802154_LONG_ADDRESS_LEN] = { 0x02, [7] = _native_id };
+
+    socket_zep_hal_setup(&_zep, &_radio);
+    socket_zep_setup(&_zep, &socket_zep_params[0]);
+    _radio.cb = _radio_cb;
+
+    expect(ieee802154_radio_request_on(&_radio) == 0);
+    while (ieee802154_radio_confirm_on(&_radio) == -EAGAIN) {}
+    expect(ieee802154_radio_config_phy(&_radio, &conf) == 0);
+    expect(ieee802154_radio_set_frame_filter_mode(&_radio,
+                                                  IEEE802154_FILTER_PROMISC) == 0);
+    /* introduces the node to the dispatcher */
+    expect(ieee802154_radio_config_addr_filter(&_radio, IEEE802154_AF_EXT_ADDR,
+                                               addr_long) == 0);
+    expect(ieee802154_radio_set_rx(&_radio) == 0);
+}
+
+int main(void)
+{
+    _init_radio();
+
+    /* nodes take turns within each period */
+    ztimer_sleep(ZTIMER_USEC, _native_id * (PERIOD_US / 10));
+
+    for (unsigned i = 0; i < ROUNDS; i++) {
+        _send();
+        ztimer_sleep(ZTIMER_USEC, PERIOD_US);
+    }
+
+    for (unsigned i = 0; i < _rx_numof; i++) {
+        printf("node %u: from %u sent at %" PRIu32 " received at %" PRIu32 "\n",
+               (unsigned)_native_id, _rx[i].src, _rx[i].sent, _rx[i].recv);
+    }
+    printf("node %u: done at %" PRIu32 "\n", (unsigned)_native_id,
+           ztimer_now(ZTIMER_USEC));
+
+    return 0;
+}
@@ -0,0 +1,89 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 Freie Universität Berlin
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import os
+import re
+import subprocess
+import sys
+import time
+
+from testrunner import run
+
+RIOTBASE = os.getenv("RIOTBASE", os.path.abspath(
+    os.path.join(os.path.dirname(__file__), "../../../..")))
+ZEP_DISPATCH = os.path.join(RIOTBASE, "dist/tools/zep_dispatch/bin/zep_dispatch")
+ZEP_PORT = os.getenv("ZEP_PORT", "17780")
+SIM_PORT = os.getenv("SIM_PORT", "17781")
+SIM_LATENCY = int(os.getenv("SIM_LATENCY", "1000"))
+ROUNDS = 5
+
+# the whole run takes about 5 s of virtual time, the limit is a safeguard
+SIM_END = 10
+
+
+def testfunc(child):
+    sent = []
+    for _ in range(ROUNDS):
+        child.expect(r"node 1: sent at (\d+)\r\n")
+        sent.append(int(child.match.group(1)))
+
+    delays = set()
+    for _ in range(ROUNDS):
+        child.expect(r"node 1: from 2 sent at (\d+) received at (\d+)\r\n")
+        delays.add(int(child.match.group(2)) - int(child.match.group(1)))
+    child.expect(r"node 1: done at (\d+)\r\n")
+
+    # frames are delayed by their airtime and the latency, nothing else
+    assert len(delays) == 1, delays
+    assert delays.pop() >= SIM_LATENCY
+    # the period of the rounds is exact in virtual time
+    assert all(b - a == sent[1] - sent[0] for a, b in zip(sent, sent[1:]))
+
+
+def check_speed(dispatcher):
+    # the dispatcher ends the simulation once both nodes exited
+    out, _ = dispatcher.communicate(timeout=10)
+    print(out, end="")
+    match = re.search(r"simulated (\S+) s in (\S+) s", out)
+    assert match, "no statistics"
+    virtual, wall = float(match.group(1)), float(match.group(2))
+    assert ROUNDS < virtual < SIM_END, virtual
+    # nodes do not wait for time to pass
+    assert wall < virtual / 2, wall
+
+    print("All tests successful")
+
+
+def main():
+    elf = os.environ["ELFFILE"]
+    zep = "127.0.0.1:" + ZEP_PORT
+    sim = "127.0.0.1:" + SIM_PORT
+    procs = []
+
+    try:
+        dispatcher = subprocess.Popen(
+            [ZEP_DISPATCH, "-S", SIM_PORT, "-n", "2", "-l", str(SIM_LATENCY),
+             "-T", str(SIM_END), "127.0.0.1", ZEP_PORT],
+            stdout=subprocess.PIPE, universal_newlines=True)
+        procs.append(dispatcher)
+        # give the dispatcher time to listen
+        time.sleep(0.5)
+        procs.append(subprocess.Popen([elf, "-i", "2", "-S", sim, "-z", zep],
+                                      stdout=subprocess.DEVNULL))
+        res = run(testfunc)
+        if res == 0:
+            check_speed(dispatcher)
+        return res
+    finally:
+        for proc in procs:
+            proc.kill()
+            proc.wait()
+
+
+if __name__ == "__main__":
+    sys.exit(main())
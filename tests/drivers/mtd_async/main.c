@@ -0,0 +1,261 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       mtd_async module test
+ *
+ * @}
+ */
+
+#include <stdint.h>
+#include <errno.h>
+#include <string.h>
+
+#include "embUnit.h"
+#include "mtd.h"
+#include "mtd_async.h"
+#include "mutex.h"
+#include "thread.h"
+
+/* Test mock object implementing a simple RAM-based mtd that logs operations */
+#define SECTOR_COUNT        8
+#define PAGE_PER_SECTOR     4
+#define PAGE_SIZE           64
+#define SECTOR_SIZE         (PAGE_PER_SECTOR * PAGE_SIZE)
+
+#define MEMORY_SIZE         (SECTOR_COUNT * SECTOR_SIZE)
+
+#define LOG_SIZE            16
+
+static uint8_t _dummy_memory[MEMORY_SIZE];
+
+static char _log[LOG_SIZE];
+static unsigned _log_len;
+
+static char _done[LOG_SIZE];
+static unsigned _done_len;
+
+static int _init(mtd_dev_t *dev)
+{
+    (void)dev;
+
+    return 0;
+}
+
+static int _read_page(mtd_dev_t *dev, void *buff, uint32_t page, uint32_t offset, uint32_t size)
+{
+    uint32_t addr = page * dev->page_size + offset;
+
+    if (addr + size > sizeof(_dummy_memory)) {
+        return -EOVERFLOW;
+    }
+    memcpy(buff, _dummy_memory + addr, size);
+    _log[_log_len++] = 'r';
+
+    return size;
+}
+
+static int _write_page(mtd_dev_t *dev, const void *buff, uint32_t page, uint32_t offset, uint32_t size)
+{
+    uint32_t addr = page * dev->page_size + offset;
+
+    if (addr + size > sizeof(_dummy_memory)) {
+        return -EOVERFLOW;
+    }
+    memcpy(_dummy_memory + addr, buff, size);
+    _log[_log_len++] = 'w';
+
+    return size;
+}
+
+static int _erase_sector(mtd_dev_t *dev, uint32_t sector, uint32_t count)
+{
+    (void)dev;
+
+    memset(_dummy_memory + sector * SECTOR_SIZE, 0xff, count * SECTOR_SIZE);
+    /* log the number of sectors erased at once */
+    _log[_log_len++] = '0' + count;
+
+    return 0;
+}
+
+static const mtd_desc_t driver = {
+    .init = _init,
+    .read_page = _read_page,
+    .write_page = _write_page,
+    .erase_sector = _erase_sector,
+};
+
+static mtd_dev_t _dev = {
+    .driver = &driver,
+    .sector_count = SECTOR_COUNT,
+    .pages_per_sector = PAGE_PER_SECTOR,
+    .page_size = PAGE_SIZE,
+    .write_size = 1,
+};
+
+static mtd_async_t _async;
+static mtd_async_req_t _reqs[4];
+
+static uint8_t _buffer[PAGE_SIZE];
+
+static void _cb(mtd_async_req_t *req, int res)
+{
+    TEST_ASSERT_EQUAL_INT(0, res);
+    _done[_done_len++] = '0' + (req - _reqs);
+}
+
+static void _process_all(void)
+{
+    while (mtd_async_process(&_async)) {}
+}
+
+static void setup(void)
+{
+    memset(_dummy_memory, 0, sizeof(_dummy_memory));
+    memset(_log, 0, sizeof(_log));
+    memset(_done, 0, sizeof(_done));
+    _log_len = 0;
+    _done_len = 0;
+    mtd_init(&_dev);
+    mtd_async_init(&_async, &_dev, NULL, 0, 0, NULL);
+}
+
+static void test_mtd_async_write_read(void)
+{
+    static const char data[] = "Hello, async MTD!";
+
+    mtd_async_write_page_raw(&_async, &_reqs[0], data, 1, 8, sizeof(data),
+                             _cb, NULL);
+    mtd_async_read_page(&_async, &_reqs[1], _buffer, 1, 8, sizeof(data),
+                        _cb, NULL);
+    TEST_ASSERT_EQUAL_INT(0, _log_len);
+
+    _process_all();
+    /* the read overlaps with the write, so it has to wait */
+    TEST_ASSERT_EQUAL_STRING("wr", _log);
+    TEST_ASSERT_EQUAL_STRING("01", _done);
+    TEST_ASSERT_EQUAL_STRING(data, (char *)_buffer);
+}
+
+static void test_mtd_async_read_first(void)
+{
+    static const uint8_t data[16] = { 0x42 };
+
+    mtd_async_erase_sector(&_async, &_reqs[0], 0, 1, _cb, NULL);
+    mtd_async_write_page_raw(&_async, &_reqs[1], data, 0, 0, sizeof(data),
+                             _cb, NULL);
+    mtd_async_read_page(&_async, &_reqs[2], _buffer, PAGE_PER_SECTOR, 0,
+                        sizeof(_buffer), _cb, NULL);
+
+    _process_all();
+    /* the read does not overlap and is moved ahead */
+    TEST_ASSERT_EQUAL_STRING("r1w", _log);
+    TEST_ASSERT_EQUAL_STRING("201", _done);
+    TEST_ASSERT_EQUAL_INT(0x42, _dummy_memory[0]);
+    TEST_ASSERT_EQUAL_INT(0xff, _dummy_memory[sizeof(data)]);
+}
+
+static void test_mtd_async_erase_merge(void)
+{
+    mtd_async_erase_sector(&_async, &_reqs[0], 2, 1, _cb, NULL);
+    mtd_async_erase_sector(&_async, &_reqs[1], 3, 1, _cb, NULL);
+    mtd_async_erase_sector(&_async, &_reqs[2], 6, 1, _cb, NULL);
+
+    _process_all();
+    /* the last request does not continue the others */
+    TEST_ASSERT_EQUAL_STRING("21", _log);
+    TEST_ASSERT_EQUAL_STRING("012", _done);
+    TEST_ASSERT_EQUAL_INT(0, _dummy_memory[2 * SECTOR_SIZE - 1]);
+    TEST_ASSERT_EQUAL_INT(0xff, _dummy_memory[2 * SECTOR_SIZE]);
+    TEST_ASSERT_EQUAL_INT(0xff, _dummy_memory[4 * SECTOR_SIZE - 1]);
+    TEST_ASSERT_EQUAL_INT(0, _dummy_memory[4 * SECTOR_SIZE]);
+}
+
+static void test_mtd_async_erase_chunks(void)
+{
+    /* the test is built with CONFIG_MTD_ASYNC_ERASE_SECTORS_MAX=2 */
+    mtd_async_erase_sector(&_async, &_reqs[0], 0, 6, _cb, NULL);
+    TEST_ASSERT(mtd_async_process(&_async));
+    TEST_ASSERT_EQUAL_STRING("", _done);
+
+    /* a read arriving during a long erase is served between chunks */
+    mtd_async_read_page(&_async, &_reqs[1], _buffer, 6 * PAGE_PER_SECTOR, 0,
+                        sizeof(_buffer), _cb, NULL);
+    _process_all();
+    TEST_ASSERT_EQUAL_STRING("2r22", _log);
+    TEST_ASSERT_EQUAL_STRING("10", _done);
+}
+
+static void test_mtd_async_erase_split(void)
+{
+    mtd_async_erase_sector(&_async, &_reqs[0], 0, 4, _cb, NULL);
+    mtd_async_read_page(&_async, &_reqs[1], _buffer, 3 * PAGE_PER_SECTOR, 0,
+                        sizeof(_buffer), _cb, NULL);
+
+    _process_all();
+    /* the read has to wait for the erase, but it is not merged */
+    TEST_ASSERT_EQUAL_STRING("1111r", _log);
+    TEST_ASSERT_EQUAL_STRING("01", _done);
+    TEST_ASSERT_EQUAL_INT(0xff, _buffer[0]);
+}
+
+static char _stack[THREAD_STACKSIZE_DEFAULT];
+static mutex_t _thread_done = MUTEX_INIT_LOCKED;
+
+static void _thread_cb(mtd_async_req_t *req, int res)
+{
+    _cb(req, res);
+    if (req->arg) {
+        mutex_unlock(&_thread_done);
+    }
+}
+
+static void test_mtd_async_thread(void)
+{
+    static const uint8_t data[4] = { 1, 2, 3, 4 };
+
+    mtd_async_init(&_async, &_dev, _stack, sizeof(_stack),
+                   THREAD_PRIORITY_MAIN - 1, "mtd_async");
+    mtd_async_write_page_raw(&_async, &_reqs[0], data, 5, 0, sizeof(data),
+                             _thread_cb, NULL);
+    mtd_async_read_page(&_async, &_reqs[1], _buffer, 5, 0, sizeof(data),
+                        _thread_cb, &_thread_done);
+    mutex_lock(&_thread_done);
+    TEST_ASSERT_EQUAL_STRING("01", _done);
+    TEST_ASSERT_EQUAL_INT(0, memcmp(data, _buffer, sizeof(data)));
+}
+
+Test *tests_mtd_async_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_mtd_async_write_read),
+        new_TestFixture(test_mtd_async_read_first),
+        new_TestFixture(test_mtd_async_erase_merge),
+        new_TestFixture(test_mtd_async_erase_chunks),
+        new_TestFixture(test_mtd_async_erase_split),
+        new_TestFixture(test_mtd_async_thread),
+    };
+
+    EMB_UNIT_TESTCALLER(mtd_async_tests, setup, NULL, fixtures);
+
+    return (Test *)&mtd_async_tests;
+}
+
+int main(void)
+{
+    TESTS_START();
+    TESTS_RUN(tests_mtd_async_tests());
+    TESTS_END();
+    return 0;
+}
+/** @} */
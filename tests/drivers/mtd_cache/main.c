@@ -0,0 +1,291 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       mtd_cache module test
+ *
+ * @}
+ */
+
+#include <stdint.h>
+#include <errno.h>
+#include <string.h>
+
+#include "embUnit.h"
+#include "macros/utils.h"
+#include "mtd.h"
+#include "mtd_cache.h"
+
+/* Test mock object implementing a simple RAM-based mtd that needs erasing */
+#define SECTOR_COUNT        8
+#define PAGE_PER_SECTOR     4
+#define PAGE_SIZE           64
+#define WRITE_SIZE          4
+#define SECTOR_SIZE         (PAGE_PER_SECTOR * PAGE_SIZE)
+
+#define MEMORY_SIZE         (SECTOR_COUNT * SECTOR_SIZE)
+
+#define CACHE_LINES         2
+
+static uint8_t _dummy_memory[MEMORY_SIZE];
+static unsigned _erase_count;
+static unsigned _program_count;
+
+static uint8_t _buffer[SECTOR_SIZE];
+
+static int _init(mtd_dev_t *dev)
+{
+    (void)dev;
+
+    return 0;
+}
+
+static int _read_page(mtd_dev_t *dev, void *buff, uint32_t page, uint32_t offset, uint32_t size)
+{
+    uint32_t addr = page * dev->page_size + offset;
+
+    if (addr + size > sizeof(_dummy_memory)) {
+        return -EOVERFLOW;
+    }
+    memcpy(buff, _dummy_memory + addr, size);
+
+    return size;
+}
+
+static int _write_page(mtd_dev_t *dev, const void *buff, uint32_t page, uint32_t offset, uint32_t size)
+{
+    uint32_t addr = page * dev->page_size + offset;
+    const uint8_t *data = buff;
+
+    if (addr + size > sizeof(_dummy_memory)) {
+        return -EOVERFLOW;
+    }
+    if ((addr % WRITE_SIZE) || (size % WRITE_SIZE)) {
+        return -EINVAL;
+    }
+    /* programming can only be done on erased memory */
+    for (unsigned i = 0; i < size; i++) {
+        if (_dummy_memory[addr + i] != 0xff) {
+            return -EIO;
+        }
+        _dummy_memory[addr + i] = data[i];
+    }
+    _program_count++;
+
+    return size;
+}
+
+static int _erase_sector(mtd_dev_t *dev, uint32_t sector, uint32_t count)
+{
+    uint32_t addr = sector * dev->page_size * dev->pages_per_sector;
+
+    if (sector + count > dev->sector_count) {
+        return -EOVERFLOW;
+    }
+    memset(_dummy_memory + addr, 0xff, count * SECTOR_SIZE);
+    _erase_count += count;
+
+    return 0;
+}
+
+static const mtd_desc_t driver = {
+    .init = _init,
+    .read_page = _read_page,
+    .write_page = _write_page,
+    .erase_sector = _erase_sector,
+};
+
+static mtd_dev_t _dev = {
+    .driver = &driver,
+    .sector_count = SECTOR_COUNT,
+    .pages_per_sector = PAGE_PER_SECTOR,
+    .page_size = PAGE_SIZE,
+    .write_size = WRITE_SIZE,
+};
+
+static mtd_cache_line_t _lines[CACHE_LINES];
+static uint8_t _cache_buf[CACHE_LINES * SECTOR_SIZE];
+
+static mtd_cache_t _cache = MTD_CACHE_INIT(&_dev, _lines, _cache_buf);
+
+static mtd_dev_t *dev = &_cache.mtd;
+
+static void _fill(uint8_t *buf, size_t len, uint8_t seed)
+{
+    for (unsigned i = 0; i < len; i++) {
+        buf[i] = seed + i;
+    }
+}
+
+static void setup(void)
+{
+    memset(_dummy_memory, 0xff, sizeof(_dummy_memory));
+    mtd_init(dev);
+    _erase_count = 0;
+    _program_count = 0;
+}
+
+static void test_mtd_init(void)
+{
+    TEST_ASSERT_EQUAL_INT(SECTOR_COUNT, dev->sector_count);
+    TEST_ASSERT_EQUAL_INT(PAGE_PER_SECTOR, dev->pages_per_sector);
+    TEST_ASSERT_EQUAL_INT(PAGE_SIZE, dev->page_size);
+    TEST_ASSERT_EQUAL_INT(1, dev->write_size);
+}
+
+static void test_mtd_write_coalesce(void)
+{
+    uint8_t data[SECTOR_SIZE];
+
+    _fill(data, sizeof(data), 0x10);
+    /* unaligned writes are fine on the cache */
+    for (unsigned pos = 0; pos < 128; pos += 7) {
+        TEST_ASSERT_EQUAL_INT(0, mtd_write_page_raw(dev, data + pos, 0, pos,
+                                                    MIN(7U, 128 - pos)));
+    }
+    TEST_ASSERT_EQUAL_INT(0, _program_count);
+    TEST_ASSERT_EQUAL_INT(0xff, _dummy_memory[0]);
+
+    TEST_ASSERT_EQUAL_INT(0, mtd_read_page(dev, _buffer, 0, 0, 128));
+    TEST_ASSERT_EQUAL_INT(0, memcmp(data, _buffer, 128));
+
+    TEST_ASSERT_EQUAL_INT(0, mtd_cache_flush(&_cache));
+    TEST_ASSERT_EQUAL_INT(0, _erase_count);
+    TEST_ASSERT_EQUAL_INT(1, _program_count);
+    TEST_ASSERT_EQUAL_INT(0, memcmp(data, _dummy_memory, 128));
+
+    /* nothing left to write back */
+    TEST_ASSERT_EQUAL_INT(0, mtd_cache_flush(&_cache));
+    TEST_ASSERT_EQUAL_INT(1, _program_count);
+}
+
+static void test_mtd_append(void)
+{
+    uint8_t data[64];
+
+    _fill(data, sizeof(data), 0x20);
+    TEST_ASSERT_EQUAL_INT(0, mtd_write_page_raw(dev, data, 1, 0, 32));
+    TEST_ASSERT_EQUAL_INT(0, mtd_cache_flush(&_cache));
+    TEST_ASSERT_EQUAL_INT(0, mtd_write_page_raw(dev, data + 32, 1, 32, 32));
+    TEST_ASSERT_EQUAL_INT(0, mtd_cache_flush(&_cache));
+
+    /* appending to erased memory needs no erase */
+    TEST_ASSERT_EQUAL_INT(0, _erase_count);
+    TEST_ASSERT_EQUAL_INT(2, _program_count);
+    TEST_ASSERT_EQUAL_INT(0, memcmp(data, _dummy_memory + PAGE_SIZE, 64));
+}
+
+static void test_mtd_overwrite(void)
+{
+    uint8_t data[SECTOR_SIZE];
+
+    _fill(data, sizeof(data), 0x30);
+    TEST_ASSERT_EQUAL_INT(0, mtd_write_page_raw(dev, data, 4, 0, SECTOR_SIZE));
+    TEST_ASSERT_EQUAL_INT(0, mtd_cache_flush(&_cache));
+    TEST_ASSERT_EQUAL_INT(0, _erase_count);
+
+    /* overwriting programmed data erases the sector once */
+    for (unsigned i = 0; i < 4; i++) {
+        data[i * 8] = 0x55;
+        TEST_ASSERT_EQUAL_INT(0, mtd_write_page(dev, &data[i * 8], 4, i * 8, 1));
+    }
+    TEST_ASSERT_EQUAL_INT(0, mtd_cache_flush(&_cache));
+    TEST_ASSERT_EQUAL_INT(1, _erase_count);
+    TEST_ASSERT_EQUAL_INT(2, _program_count);
+    TEST_ASSERT_EQUAL_INT(0, memcmp(data, _dummy_memory + SECTOR_SIZE, SECTOR_SIZE));
+}
+
+static void test_mtd_erase_deferred(void)
+{
+    uint8_t data[32];
+
+    _fill(data, sizeof(data), 0x40);
+    memset(_dummy_memory + 2 * SECTOR_SIZE, 0, SECTOR_SIZE);
+
+    TEST_ASSERT_EQUAL_INT(0, mtd_write_page_raw(dev, data, 8, 0, sizeof(data)));
+    TEST_ASSERT_EQUAL_INT(0, mtd_erase_sector(dev, 2, 1));
+    TEST_ASSERT_EQUAL_INT(0, _erase_count);
+    TEST_ASSERT_EQUAL_INT(0, mtd_read_page(dev, _buffer, 8, 0, sizeof(data)));
+    TEST_ASSERT_EQUAL_INT(0xff, _buffer[0]);
+
+    TEST_ASSERT_EQUAL_INT(0, mtd_write_page_raw(dev, data, 9, 0, sizeof(data)));
+    TEST_ASSERT_EQUAL_INT(0, mtd_cache_flush(&_cache));
+    TEST_ASSERT_EQUAL_INT(1, _erase_count);
+    TEST_ASSERT_EQUAL_INT(1, _program_count);
+    TEST_ASSERT_EQUAL_INT(0xff, _dummy_memory[2 * SECTOR_SIZE]);
+    TEST_ASSERT_EQUAL_INT(0, memcmp(data, _dummy_memory + 2 * SECTOR_SIZE + PAGE_SIZE,
+                                    sizeof(data)));
+
+    /* uncached sectors are erased right away */
+    TEST_ASSERT_EQUAL_INT(0, mtd_erase_sector(dev, 7, 1));
+    TEST_ASSERT_EQUAL_INT(2, _erase_count);
+}
+
+static void test_mtd_evict(void)
+{
+    uint8_t data[16];
+
+    _fill(data, sizeof(data), 0x50);
+    TEST_ASSERT_EQUAL_INT(0, mtd_write_page_raw(dev, data, 0, 0, sizeof(data)));
+    TEST_ASSERT_EQUAL_INT(0, mtd_write_page_raw(dev, data, 4, 0, sizeof(data)));
+    /* sector 0 becomes the most recently used one */
+    TEST_ASSERT_EQUAL_INT(0, mtd_read_page(dev, _buffer, 0, 0, sizeof(data)));
+    TEST_ASSERT_EQUAL_INT(0, _program_count);
+
+    /* sector 1 is evicted */
+    TEST_ASSERT_EQUAL_INT(0, mtd_write_page_raw(dev, data, 8, 0, sizeof(data)));
+    TEST_ASSERT_EQUAL_INT(1, _program_count);
+    TEST_ASSERT_EQUAL_INT(0xff, _dummy_memory[0]);
+    TEST_ASSERT_EQUAL_INT(0, memcmp(data, _dummy_memory + SECTOR_SIZE, sizeof(data)));
+
+    /* uncached sectors are read from the backing device */
+    TEST_ASSERT_EQUAL_INT(0, mtd_read_page(dev, _buffer, 4, 0, sizeof(data)));
+    TEST_ASSERT_EQUAL_INT(0, memcmp(data, _buffer, sizeof(data)));
+}
+
+static void test_mtd_power_down(void)
+{
+    uint8_t data[16];
+
+    _fill(data, sizeof(data), 0x60);
+    TEST_ASSERT_EQUAL_INT(0, mtd_write_page_raw(dev, data, 12, 0, sizeof(data)));
+    TEST_ASSERT_EQUAL_INT(0, _program_count);
+    mtd_power(dev, MTD_POWER_DOWN);
+    TEST_ASSERT_EQUAL_INT(1, _program_count);
+    TEST_ASSERT_EQUAL_INT(0, memcmp(data, _dummy_memory + 3 * SECTOR_SIZE, sizeof(data)));
+}
+
+Test *tests_mtd_cache_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_mtd_init),
+        new_TestFixture(test_mtd_write_coalesce),
+        new_TestFixture(test_mtd_append),
+        new_TestFixture(test_mtd_overwrite),
+        new_TestFixture(test_mtd_erase_deferred),
+        new_TestFixture(test_mtd_evict),
+        new_TestFixture(test_mtd_power_down),
+    };
+
+    EMB_UNIT_TESTCALLER(mtd_cache_tests, setup, NULL, fixtures);
+
+    return (Test *)&mtd_cache_tests;
+}
+
+int main(void)
+{
+    TESTS_START();
+    TESTS_RUN(tests_mtd_cache_tests());
+    TESTS_END();
+    return 0;
+}
+/** @} */
@@ -0,0 +1,344 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Tests route installation of an RPL DODAG root from DAOs
+ *
+ * @}
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "embUnit.h"
+#include "net/ethernet.h"
+#include "net/gnrc.h"
+#include "net/gnrc/ipv6/nib.h"
+#include "net/gnrc/netif/ethernet.h"
+#include "net/gnrc/rpl.h"
+#include "net/icmpv6.h"
+#include "net/netdev_test.h"
+#include "test_utils/expect.h"
+#include "thread.h"
+#include "ztimer.h"
+
+/* more targets than hash buckets and wheel slots */
+#define NUM_TARGETS         (32U)
+#define NUM_CHILDREN        (2U)
+/* in seconds, as CONFIG_GNRC_RPL_LIFETIME_UNIT is 1 */
+#define LONG_LIFETIME       (0xffU)
+#define MSG_SIZE            (sizeof(icmpv6_hdr_t) + sizeof(gnrc_rpl_dao_t) + \
+                             (NUM_TARGETS * sizeof(gnrc_rpl_opt_target_t)) + \
+                             sizeof(gnrc_rpl_opt_transit_t))
+
+#define DODAG_ID            { 0x20, 0x01, 0x0d, 0xb8, 0x00, 0x00, 0x00, 0x00, \
+                              0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, }
+#define TARGET_PFX          { 0x20, 0x01, 0x0d, 0xb8, 0x00, 0x00, 0x00, 0x01, \
+                              0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, }
+#define CHILD_LINK_LOCAL    { 0xfe, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+                              0x00, 0x00, 0x00, 0xff, 0xfe, 0x00, 0x00, 0x00, }
+
+static const uint8_t _mac[] = { 0xce, 0xab, 0xfe, 0xad, 0xf7, 0x26 };
+static ipv6_addr_t _dodag_id = { .u8 = DODAG_ID };
+
+static gnrc_netif_t _netif;
+static netdev_test_t _netdev;
+static char _netif_stack[THREAD_STACKSIZE_DEFAULT];
+
+static ipv6_addr_t _children[NUM_CHILDREN];
+static uint8_t _msg[MSG_SIZE];
+static size_t _msg_len;
+static uint8_t _dao_seq;
+
+static int _get_device_type(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len == sizeof(uint16_t));
+    *((uint16_t *)value) = NETDEV_TYPE_ETHERNET;
+    return sizeof(uint16_t);
+}
+
+static int _get_max_packet_size(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len == sizeof(uint16_t));
+    *((uint16_t *)value) = ETHERNET_DATA_LEN;
+    return sizeof(uint16_t);
+}
+
+static int _get_address(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len >= sizeof(_mac));
+    memcpy(value, _mac, sizeof(_mac));
+    return sizeof(_mac);
+}
+
+static int _send(netdev_t *dev, const iolist_t *iolist)
+{
+    /* drop DIOs of the root */
+    (void)dev;
+    return iolist_size(iolist);
+}
+
+static void _init_root(void)
+{
+    const ipv6_addr_t child = { .u8 = CHILD_LINK_LOCAL };
+
+    netdev_test_setup(&_netdev, NULL);
+    netdev_test_set_get_cb(&_netdev, NETOPT_DEVICE_TYPE, _get_device_type);
+    netdev_test_set_get_cb(&_netdev, NETOPT_MAX_PDU_SIZE, _get_max_packet_size);
+    netdev_test_set_get_cb(&_netdev, NETOPT_ADDRESS, _get_address);
+    netdev_test_set_send_cb(&_netdev, _send);
+    expect(gnrc_netif_ethernet_create(&_netif, _netif_stack,
+                                      sizeof(_netif_stack), GNRC_NETIF_PRIO,
+                                      "mockup_eth",
+                                      &_netdev.netdev.netdev) == 0);
+    expect(gnrc_netif_ipv6_addr_add(&_netif, &_dodag_id, 64,
+                                    GNRC_NETIF_IPV6_ADDRS_FLAGS_STATE_VALID) > 0);
+    expect(gnrc_rpl_init(_netif.pid) != KERNEL_PID_UNDEF);
+    expect(gnrc_rpl_root_init(CONFIG_GNRC_RPL_DEFAULT_INSTANCE, &_dodag_id,
+                              false, false) != NULL);
+    for (unsigned i = 0; i < NUM_CHILDREN; i++) {
+        _children[i] = child;
+        _children[i].u8[15] = i + 1;
+    }
+}
+
+static void _get_target(ipv6_addr_t *addr, unsigned target)
+{
+    static const ipv6_addr_t target_pfx = { .u8 = TARGET_PFX };
+
+    *addr = target_pfx;
+    addr->u16[7] = byteorder_htons(target + 1);
+}
+
+static void _dao_start(void)
+{
+    icmpv6_hdr_t *icmpv6 = (icmpv6_hdr_t *)_msg;
+    gnrc_rpl_dao_t *dao = (gnrc_rpl_dao_t *)(icmpv6 + 1);
+
+    memset(_msg, 0, sizeof(_msg));
+    icmpv6->type = ICMPV6_RPL_CTRL;
+    icmpv6->code = GNRC_RPL_ICMPV6_CODE_DAO;
+    dao->instance_id = CONFIG_GNRC_RPL_DEFAULT_INSTANCE;
+    dao->dao_sequence = _dao_seq++;
+    _msg_len = sizeof(*icmpv6) + sizeof(*dao);
+}
+
+static void _dao_add_target(unsigned target)
+{
+    gnrc_rpl_opt_target_t *opt = (gnrc_rpl_opt_target_t *)&_msg[_msg_len];
+
+    expect((_msg_len + sizeof(*opt)) <= sizeof(_msg));
+    opt->type = GNRC_RPL_OPT_TARGET;
+    opt->length = GNRC_RPL_OPT_TARGET_LEN;
+    opt->prefix_length = 128;
+    _get_target(&opt->target, target);
+    _msg_len += sizeof(*opt);
+}
+
+static void _dao_add_transit(uint8_t path_lifetime)
+{
+    gnrc_rpl_opt_transit_t *opt = (gnrc_rpl_opt_transit_t *)&_msg[_msg_len];
+
+    expect((_msg_len + sizeof(*opt)) <= sizeof(_msg));
+    opt->type = GNRC_RPL_OPT_TRANSIT;
+    opt->length = GNRC_RPL_OPT_TRANSIT_INFO_LEN;
+    opt->path_sequence = _dao_seq;
+    opt->path_lifetime = path_lifetime;
+    _msg_len += sizeof(*opt);
+}
+
+static void _dao_recv(unsigned child)
+{
+    gnrc_rpl_recv_DAO((gnrc_rpl_dao_t *)&_msg[sizeof(icmpv6_hdr_t)],
+                      _netif.pid, &_children[child], &_dodag_id, _msg_len);
+}
+
+/* sends a DAO for a single target with its own transit information */
+static void _recv_dao(unsigned target, unsigned child, uint8_t path_lifetime)
+{
+    _dao_start();
+    _dao_add_target(target);
+    _dao_add_transit(path_lifetime);
+    _dao_recv(child);
+}
+
+static unsigned _count_routes(const ipv6_addr_t *next_hop)
+{
+    gnrc_ipv6_nib_ft_t fte;
+    void *state = NULL;
+    unsigned count = 0;
+
+    while (gnrc_ipv6_nib_ft_iter(next_hop, _netif.pid, &state, &fte)) {
+        if (fte.dst_len == 128) {
+            count++;
+        }
+    }
+    return count;
+}
+
+static bool _has_route(unsigned target, unsigned child)
+{
+    gnrc_ipv6_nib_ft_t fte;
+    ipv6_addr_t dst;
+
+    _get_target(&dst, target);
+    return (gnrc_ipv6_nib_ft_get(&dst, NULL, &fte) == 0) &&
+           (fte.dst_len == 128) &&
+           ipv6_addr_equal(&fte.next_hop, &_children[child]);
+}
+
+static void set_up(void)
+{
+    ipv6_addr_t dst;
+
+    for (unsigned i = 0; i < NUM_TARGETS; i++) {
+        _get_target(&dst, i);
+        gnrc_ipv6_nib_ft_del(&dst, 128);
+    }
+}
+
+/*
+ * Receives one DAO with all targets sharing a single transit information
+ * option.
+ * Expected result: all targets are routed via the sender of the DAO
+ */
+static void test_dao__targets_share_transit(void)
+{
+    _dao_start();
+    for (unsigned i = 0; i < NUM_TARGETS; i++) {
+        _dao_add_target(i);
+    }
+    _dao_add_transit(LONG_LIFETIME);
+    _dao_recv(0);
+    TEST_ASSERT_EQUAL_INT(NUM_TARGETS, _count_routes(&_children[0]));
+    for (unsigned i = 0; i < NUM_TARGETS; i++) {
+        TEST_ASSERT(_has_route(i, 0));
+    }
+}
+
+/*
+ * Receives one DAO with targets but without transit information option.
+ * Expected result: the targets are still routed via the sender of the DAO
+ */
+static void test_dao__targets_wo_transit(void)
+{
+    _dao_start();
+    _dao_add_target(0);
+    _dao_add_target(1);
+    _dao_recv(0);
+    TEST_ASSERT_EQUAL_INT(2, _count_routes(&_children[0]));
+    TEST_ASSERT(_has_route(0, 0));
+    TEST_ASSERT(_has_route(1, 0));
+}
+
+/*
+ * Receives DAOs for all targets twice from the same child.
+ * Expected result: each target has exactly one route
+ */
+static void test_dao__refresh(void)
+{
+    for (unsigned round = 0; round < 2; round++) {
+        for (unsigned i = 0; i < NUM_TARGETS; i++) {
+            _recv_dao(i, 0, LONG_LIFETIME);
+        }
+    }
+    TEST_ASSERT_EQUAL_INT(NUM_TARGETS, _count_routes(&_children[0]));
+    TEST_ASSERT_EQUAL_INT(NUM_TARGETS, _count_routes(NULL));
+}
+
+/*
+ * Receives DAOs for all targets from the first child, then for every second
+ * target from the second child.
+ * Expected result: the routes of the re-announced targets moved to the second
+ * child, all others still go via the first child
+ */
+static void test_dao__repair(void)
+{
+    for (unsigned i = 0; i < NUM_TARGETS; i++) {
+        _recv_dao(i, 0, LONG_LIFETIME);
+    }
+    for (unsigned i = 0; i < NUM_TARGETS; i += 2) {
+        _recv_dao(i, 1, LONG_LIFETIME);
+    }
+    TEST_ASSERT_EQUAL_INT(NUM_TARGETS / 2, _count_routes(&_children[0]));
+    TEST_ASSERT_EQUAL_INT(NUM_TARGETS / 2, _count_routes(&_children[1]));
+    for (unsigned i = 0; i < NUM_TARGETS; i++) {
+        TEST_ASSERT(_has_route(i, (i + 1) % 2));
+    }
+}
+
+/*
+ * Receives DAOs with a path lifetime of 1s and 2s for half the targets each.
+ * Expected result: the routes expire after their lifetime, but not before
+ */
+static void test_dao__expiry(void)
+{
+    for (unsigned i = 0; i < NUM_TARGETS; i++) {
+        _recv_dao(i, 0, (i % 2) + 1);
+    }
+    TEST_ASSERT_EQUAL_INT(NUM_TARGETS, _count_routes(&_children[0]));
+    ztimer_sleep(ZTIMER_MSEC, 1500);
+    TEST_ASSERT_EQUAL_INT(NUM_TARGETS / 2, _count_routes(&_children[0]));
+    for (unsigned i = 1; i < NUM_TARGETS; i += 2) {
+        TEST_ASSERT(_has_route(i, 0));
+    }
+    ztimer_sleep(ZTIMER_MSEC, 1000);
+    TEST_ASSERT_EQUAL_INT(0, _count_routes(&_children[0]));
+}
+
+/*
+ * Receives DAOs with a path lifetime of 1s and refreshes them with a long
+ * lifetime before they expire.
+ * Expected result: the refreshed routes do not expire
+ */
+static void test_dao__expiry_refreshed(void)
+{
+    for (unsigned i = 0; i < NUM_TARGETS; i++) {
+        _recv_dao(i, 0, 1);
+    }
+    ztimer_sleep(ZTIMER_MSEC, 500);
+    for (unsigned i = 0; i < NUM_TARGETS; i++) {
+        _recv_dao(i, 0, LONG_LIFETIME);
+    }
+    ztimer_sleep(ZTIMER_MSEC, 1000);
+    TEST_ASSERT_EQUAL_INT(NUM_TARGETS, _count_routes(&_children[0]));
+}
+
+static Test *tests_gnrc_rpl_dao(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_dao__targets_share_transit),
+        new_TestFixture(test_dao__targets_wo_transit),
+        new_TestFixture(test_dao__refresh),
+        new_TestFixture(test_dao__repair),
+        new_TestFixture(test_dao__expiry),
+        new_TestFixture(test_dao__expiry_refreshed),
+    };
+
+    EMB_UNIT_TESTCALLER(tests, set_up, NULL, fixtures);
+
+    return (Test *)&tests;
+}
+
+int main(void)
+{
+    _init_root();
+    TESTS_START();
+    TESTS_RUN(tests_gnrc_rpl_dao());
+    TESTS_END();
+
+    return 0;
+}
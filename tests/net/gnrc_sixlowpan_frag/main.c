@@ -19,10 +19,12 @@
  */
 
 #include "embUnit.h"
+#include "modules.h"
 #include "net/gnrc/pktbuf.h"
 #include "net/gnrc/netreg.h"
 #include "net/gnrc/sixlowpan/frag.h"
 #include "net/gnrc/sixlowpan/frag/rb.h"
+#include "net/gnrc/sixlowpan/frag/stats.h"
 #include "xtimer.h"
 
 #define TEST_NETIF_HDR_SRC      { 0xb3, 0x47, 0x60, 0x49, \
@@ -387,6 +389,7 @@ static void test_rbuf_add__full_rbuf(void)
 {
     gnrc_pktsnip_t *pkt;
     const gnrc_sixlowpan_frag_rb_t *rbuf;
+    unsigned evicted = gnrc_sixlowpan_frag_stats_get()->rbuf_evicted;
 
     for (unsigned i = 0; i < CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE; i++) {
         pkt = gnrc_pktbuf_add(NULL, _fragment1, sizeof(_fragment1),
@@ -404,6 +407,9 @@ static void test_rbuf_add__full_rbuf(void)
     TEST_ASSERT_NOT_NULL(gnrc_sixlowpan_frag_rb_add(
             &_test_netif_hdr.hdr, pkt, TEST_FRAGMENT1_OFFSET, TEST_PAGE
         ));
+    /* oldest entry was overridden */
+    TEST_ASSERT_EQUAL_INT(evicted + 1,
+                          gnrc_sixlowpan_frag_stats_get()->rbuf_evicted);
     rbuf = gnrc_sixlowpan_frag_rb_array();
     for (unsigned i = 0; i < CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE; i++) {
         const gnrc_sixlowpan_frag_rb_t *entry = &rbuf[i];
@@ -536,6 +542,161 @@ static void test_rbuf_add__overlap_rhs(void)
     _check_pktbuf(NULL);
 }
 
+#if IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_RB_HASH)
+static void test_rbuf_add__hash_collisions(void)
+{
+    const gnrc_sixlowpan_frag_rb_t *entry;
+    const uint16_t mid_tag = TEST_TAG + (CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE / 2);
+    const uint16_t new_tag = TEST_TAG + CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE;
+
+    /* the Makefile sets a single hash bucket, so all entries share one chain */
+    for (unsigned i = 0; i < CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE; i++) {
+        gnrc_pktsnip_t *pkt;
+
+        _set_fragment_tag(_fragment1, TEST_TAG + i);
+        pkt = gnrc_pktbuf_add(NULL, _fragment1, sizeof(_fragment1),
+                              GNRC_NETTYPE_SIXLOWPAN);
+        TEST_ASSERT_NOT_NULL(pkt);
+        TEST_ASSERT_NOT_NULL(gnrc_sixlowpan_frag_rb_add(
+            &_test_netif_hdr.hdr, pkt, TEST_FRAGMENT1_OFFSET, TEST_PAGE
+        ));
+    }
+    for (unsigned i = 0; i < CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE; i++) {
+        TEST_ASSERT_NOT_NULL((entry = gnrc_sixlowpan_frag_rb_get_by_datagram(
+            &_test_netif_hdr.hdr, TEST_TAG + i
+        )));
+        TEST_ASSERT_EQUAL_INT(TEST_TAG + i, entry->super.tag);
+    }
+    TEST_ASSERT(!gnrc_sixlowpan_frag_rb_exists(&_test_netif_hdr.hdr, new_tag));
+
+    /* remove an entry from the middle of the chain */
+    gnrc_sixlowpan_frag_rb_rm_by_datagram(&_test_netif_hdr.hdr, mid_tag);
+    TEST_ASSERT(!gnrc_sixlowpan_frag_rb_exists(&_test_netif_hdr.hdr, mid_tag));
+    for (unsigned i = 0; i < CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE; i++) {
+        if ((TEST_TAG + i) != mid_tag) {
+            TEST_ASSERT(gnrc_sixlowpan_frag_rb_exists(&_test_netif_hdr.hdr,
+                                                      TEST_TAG + i));
+        }
+    }
+
+    /* the free slot is re-chained for a new datagram */
+    _set_fragment_tag(_fragment1, new_tag);
+    gnrc_pktsnip_t *pkt = gnrc_pktbuf_add(NULL, _fragment1, sizeof(_fragment1),
+                                          GNRC_NETTYPE_SIXLOWPAN);
+    TEST_ASSERT_NOT_NULL(pkt);
+    TEST_ASSERT_NOT_NULL((entry = gnrc_sixlowpan_frag_rb_add(
+            &_test_netif_hdr.hdr, pkt, TEST_FRAGMENT1_OFFSET, TEST_PAGE
+        )));
+    TEST_ASSERT(entry == gnrc_sixlowpan_frag_rb_get_by_datagram(
+                    &_test_netif_hdr.hdr, new_tag));
+    TEST_ASSERT(!gnrc_sixlowpan_frag_rb_exists(&_test_netif_hdr.hdr, mid_tag));
+    for (unsigned i = 0; i < CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE; i++) {
+        if ((TEST_TAG + i) != mid_tag) {
+            TEST_ASSERT(gnrc_sixlowpan_frag_rb_exists(&_test_netif_hdr.hdr,
+                                                      TEST_TAG + i));
+        }
+    }
+
+    /* entries of another source are not found in the shared chain */
+    _test_netif_hdr.src[0] ^= 0xff;
+    TEST_ASSERT(!gnrc_sixlowpan_frag_rb_exists(&_test_netif_hdr.hdr, new_tag));
+    _test_netif_hdr.src[0] ^= 0xff;
+
+    entry = gnrc_sixlowpan_frag_rb_array();
+    for (unsigned i = 0; i < CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE; i++) {
+        if (!gnrc_sixlowpan_frag_rb_entry_empty(&entry[i])) {
+            gnrc_pktbuf_release(entry[i].pkt);
+        }
+    }
+    _check_pktbuf(NULL);
+}
+#endif  /* IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_RB_HASH) */
+
+#if IS_ACTIVE(CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_MERGE_INTS)
+static void test_rbuf_add__merge_ints(void)
+{
+    static const size_t contained_offset = TEST_FRAGMENT2_OFFSET + 8U;
+    gnrc_pktsnip_t *pkt1 = gnrc_pktbuf_add(NULL, _fragment1, sizeof(_fragment1),
+                                           GNRC_NETTYPE_SIXLOWPAN);
+    gnrc_pktsnip_t *pkt3 = gnrc_pktbuf_add(NULL, _fragment3, sizeof(_fragment3),
+                                           GNRC_NETTYPE_SIXLOWPAN);
+    gnrc_pktsnip_t *pkt2 = gnrc_pktbuf_add(NULL, _fragment2, sizeof(_fragment2),
+                                           GNRC_NETTYPE_SIXLOWPAN);
+    gnrc_pktsnip_t *pkt;
+    gnrc_sixlowpan_frag_rb_t *entry;
+
+    TEST_ASSERT_NOT_NULL(pkt1);
+    TEST_ASSERT_NOT_NULL(gnrc_sixlowpan_frag_rb_add(
+            &_test_netif_hdr.hdr, pkt1, TEST_FRAGMENT1_OFFSET, TEST_PAGE
+        ));
+    TEST_ASSERT_NOT_NULL(pkt3);
+    TEST_ASSERT_NOT_NULL((entry = gnrc_sixlowpan_frag_rb_add(
+            &_test_netif_hdr.hdr, pkt3, TEST_FRAGMENT3_OFFSET, TEST_PAGE
+        )));
+    /* not adjacent: two intervals */
+    TEST_ASSERT_NOT_NULL(entry->super.ints);
+    TEST_ASSERT_NOT_NULL(entry->super.ints->next);
+    TEST_ASSERT_NULL(entry->super.ints->next->next);
+
+    /* fragment 2 closes the gap, both intervals are merged into one */
+    TEST_ASSERT_NOT_NULL(pkt2);
+    TEST_ASSERT(entry == gnrc_sixlowpan_frag_rb_add(
+            &_test_netif_hdr.hdr, pkt2, TEST_FRAGMENT2_OFFSET, TEST_PAGE
+        ));
+    _test_entry(entry, TEST_FRAGMENT4_OFFSET,
+                TEST_FRAGMENT1_OFFSET, TEST_FRAGMENT4_OFFSET - 1);
+
+    /* a fragment within the run, even with other bounds, is a duplicate */
+    _set_fragment_offset(_fragment2, contained_offset);
+    pkt = gnrc_pktbuf_add(NULL, _fragment2, sizeof(_fragment2),
+                          GNRC_NETTYPE_SIXLOWPAN);
+    TEST_ASSERT_NOT_NULL(pkt);
+    TEST_ASSERT(entry == gnrc_sixlowpan_frag_rb_add(
+            &_test_netif_hdr.hdr, pkt, contained_offset, TEST_PAGE
+        ));
+    _test_entry(entry, TEST_FRAGMENT4_OFFSET,
+                TEST_FRAGMENT1_OFFSET, TEST_FRAGMENT4_OFFSET - 1);
+    _check_pktbuf(entry);
+}
+
+static void test_rbuf_add__merge_ints_overlap(void)
+{
+    static const size_t overlap_offset = TEST_FRAGMENT3_OFFSET - 8U;
+    gnrc_pktsnip_t *pkt1 = gnrc_pktbuf_add(NULL, _fragment1, sizeof(_fragment1),
+                                           GNRC_NETTYPE_SIXLOWPAN);
+    gnrc_pktsnip_t *pkt2 = gnrc_pktbuf_add(NULL, _fragment2, sizeof(_fragment2),
+                                           GNRC_NETTYPE_SIXLOWPAN);
+    gnrc_pktsnip_t *pkt3;
+    gnrc_sixlowpan_frag_rb_t *entry;
+
+    TEST_ASSERT_NOT_NULL(pkt1);
+    TEST_ASSERT_NOT_NULL(gnrc_sixlowpan_frag_rb_add(
+            &_test_netif_hdr.hdr, pkt1, TEST_FRAGMENT1_OFFSET, TEST_PAGE
+        ));
+    TEST_ASSERT_NOT_NULL(pkt2);
+    TEST_ASSERT_NOT_NULL((entry = gnrc_sixlowpan_frag_rb_add(
+            &_test_netif_hdr.hdr, pkt2, TEST_FRAGMENT2_OFFSET, TEST_PAGE
+        )));
+    _test_entry(entry, TEST_FRAGMENT3_OFFSET,
+                TEST_FRAGMENT1_OFFSET, TEST_FRAGMENT3_OFFSET - 1);
+
+    /* fragment 3 moved into the end of the merged run overlaps it partially,
+     * so reassembly starts over with that fragment only
+     * https://tools.ietf.org/html/rfc4944#section-5.3 */
+    _set_fragment_offset(_fragment3, overlap_offset);
+    pkt3 = gnrc_pktbuf_add(NULL, _fragment3, sizeof(_fragment3),
+                           GNRC_NETTYPE_SIXLOWPAN);
+    TEST_ASSERT_NOT_NULL(pkt3);
+    TEST_ASSERT_NOT_NULL((entry = gnrc_sixlowpan_frag_rb_add(
+            &_test_netif_hdr.hdr, pkt3, overlap_offset, TEST_PAGE
+        )));
+    _test_entry(entry, TEST_FRAGMENT4_OFFSET - TEST_FRAGMENT3_OFFSET,
+                (unsigned)overlap_offset,
+                (unsigned)(TEST_FRAGMENT4_OFFSET - 8U - 1));
+    _check_pktbuf(entry);
+}
+#endif  /* IS_ACTIVE(CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_MERGE_INTS) */
+
 static void test_rbuf_get_by_dg(void)
 {
     const gnrc_sixlowpan_frag_rb_t *entry;
@@ -602,6 +763,7 @@ static void test_rbuf_gc__manually(void)
     gnrc_pktsnip_t *pkt = gnrc_pktbuf_add(NULL, _fragment1, sizeof(_fragment1),
                                           GNRC_NETTYPE_SIXLOWPAN);
     gnrc_sixlowpan_frag_rb_t *entry;
+    unsigned timeouts = gnrc_sixlowpan_frag_stats_get()->rbuf_timeout;
 
     TEST_ASSERT_NOT_NULL(pkt);
     TEST_ASSERT_NOT_NULL((entry = gnrc_sixlowpan_frag_rb_add(
@@ -611,6 +773,8 @@ static void test_rbuf_gc__manually(void)
     /* set arrival CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_TIMEOUT_US into the past */
     entry->super.arrival -= CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_TIMEOUT_US;
     gnrc_sixlowpan_frag_rb_gc();
+    TEST_ASSERT_EQUAL_INT(timeouts + 1,
+                          gnrc_sixlowpan_frag_stats_get()->rbuf_timeout);
     /* reassembly buffer is now empty */
     TEST_ASSERT_NULL(_first_non_empty_rbuf());
     _check_pktbuf(NULL);
@@ -650,6 +814,13 @@ static void run_unittests(void)
         new_TestFixture(test_rbuf_add__too_big_fragment),
         new_TestFixture(test_rbuf_add__overlap_lhs),
         new_TestFixture(test_rbuf_add__overlap_rhs),
+#if IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_RB_HASH)
+        new_TestFixture(test_rbuf_add__hash_collisions),
+#endif
+#if IS_ACTIVE(CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_MERGE_INTS)
+        new_TestFixture(test_rbuf_add__merge_ints),
+        new_TestFixture(test_rbuf_add__merge_ints_overlap),
+#endif
         new_TestFixture(test_rbuf_get_by_dg),
         new_TestFixture(test_rbuf_exists),
         new_TestFixture(test_rbuf_rm_by_dg),
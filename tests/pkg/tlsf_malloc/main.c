@@ -0,0 +1,152 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Test application for the statistics, arenas and tags of
+ *              tlsf-malloc
+ *
+ * @}
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "architecture.h"
+#include "shell.h"
+#include "test_utils/expect.h"
+#include "thread.h"
+#include "tlsf-malloc.h"
+
+#define FRAG_NUMOF      (16U)
+#define FRAG_SIZE       (256U)
+#define ARENA_SIZE      (16U * 1024)
+#define ARENA_CHUNK     (512U)
+#define ARENA_CHUNKS    (ARENA_SIZE / ARENA_CHUNK)
+
+static uint8_t _arena_mem[ARENA_SIZE] __attribute__((aligned(8)));
+static tlsf_malloc_arena_t _arena;
+
+static void *_frag[FRAG_NUMOF];
+static void *_chunks[ARENA_CHUNKS];
+
+static void _check_stats(const tlsf_malloc_arena_t *arena,
+                         tlsf_malloc_stats_t *stats)
+{
+    unsigned sum = 0;
+
+    tlsf_malloc_get_stats(arena, stats);
+    for (unsigned i = 0; i < CONFIG_TLSF_MALLOC_HIST_BINS; i++) {
+        sum += stats->hist[i];
+    }
+    expect(sum == stats->free_blocks);
+    expect(stats->largest_free <= stats->free);
+}
+
+static void _test_fragmentation(void)
+{
+    tlsf_malloc_stats_t before;
+    tlsf_malloc_stats_t after;
+
+    _check_stats(NULL, &before);
+    for (unsigned i = 0; i < FRAG_NUMOF; i++) {
+        _frag[i] = malloc(FRAG_SIZE);
+        expect(_frag[i] != NULL);
+    }
+    /* free every other block, leaving holes that can not be merged */
+    for (unsigned i = 0; i < FRAG_NUMOF; i += 2) {
+        free(_frag[i]);
+        _frag[i] = NULL;
+    }
+    _check_stats(NULL, &after);
+    expect(after.used_blocks >= before.used_blocks + FRAG_NUMOF / 2);
+    expect(after.free_blocks >= before.free_blocks + FRAG_NUMOF / 2 - 1);
+    printf("fragmented: %u free blocks, largest %" PRIuSIZE " of %" PRIuSIZE
+           " bytes\n", after.free_blocks, after.largest_free, after.free);
+
+    for (unsigned i = 1; i < FRAG_NUMOF; i += 2) {
+        free(_frag[i]);
+        _frag[i] = NULL;
+    }
+    _check_stats(NULL, &after);
+    expect(after.used_blocks == before.used_blocks);
+    expect(after.free_blocks == before.free_blocks);
+}
+
+static void _test_arena(void)
+{
+    tlsf_malloc_stats_t stats;
+    unsigned numof = 0;
+
+    /* no room for the control block */
+    expect(tlsf_malloc_arena_init(&_arena, "small", _arena_mem,
+                                  tlsf_size()) == -1);
+    expect(tlsf_malloc_arena_init(&_arena, "arena", _arena_mem,
+                                  sizeof(_arena_mem)) == 0);
+    /* no output while the arena is set, stdio may allocate */
+    tlsf_malloc_arena_set(thread_getpid(), &_arena);
+    while (numof < ARENA_CHUNKS) {
+        _chunks[numof] = malloc(ARENA_CHUNK);
+        if (_chunks[numof] == NULL) {
+            break;
+        }
+        numof++;
+    }
+    tlsf_malloc_arena_set(thread_getpid(), NULL);
+
+    /* the arena is full, the global heap is not used */
+    expect((numof > 0) && (numof < ARENA_CHUNKS));
+    for (unsigned i = 0; i < numof; i++) {
+        expect(((uint8_t *)_chunks[i] >= _arena_mem) &&
+               ((uint8_t *)_chunks[i] < _arena_mem + sizeof(_arena_mem)));
+    }
+    _check_stats(&_arena, &stats);
+    expect(stats.failures == 1);
+    expect(stats.used_blocks == numof);
+    printf("arena: %u chunks of %u bytes\n", numof, ARENA_CHUNK);
+
+    /* keep one allocation to be listed by "heap allocs" */
+    for (unsigned i = 1; i < numof; i++) {
+        free(_chunks[i]);
+    }
+    _check_stats(&_arena, &stats);
+    expect(stats.used_blocks == 1);
+}
+
+static void _test_tag(void)
+{
+    tlsf_malloc_tag_t tag;
+    void *ptr = malloc(42);
+
+    expect(ptr != NULL);
+    tlsf_malloc_get_tag(ptr, &tag);
+    expect(tag.pid == thread_getpid());
+    expect(tag.pc != 0);
+    printf("tag: pid %" PRIkernel_pid ", pc 0x%" PRIxPTR "\n", tag.pid, tag.pc);
+    free(ptr);
+
+    tlsf_malloc_get_tag(_chunks[0], &tag);
+    expect(tag.pid == thread_getpid());
+}
+
+int main(void)
+{
+    _test_fragmentation();
+    _test_arena();
+    _test_tag();
+    puts("[SUCCESS]");
+
+    char line_buf[SHELL_DEFAULT_BUFSIZE];
+    shell_run(NULL, line_buf, SHELL_DEFAULT_BUFSIZE);
+
+    return 0;
+}
@@ -0,0 +1,27 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 Freie Universität Berlin
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+
+def testfunc(child):
+    child.expect_exact("[SUCCESS]")
+    child.sendline("heap")
+    child.expect(r"heap: \d+ \(used \d+, free \d+\) \[bytes\]")
+    child.expect(r"blocks: \d+ used, \d+ free, largest free \d+, "
+                 r"failed allocations \d+")
+    child.expect(r"arena: \d+ \(used \d+, free \d+\) \[bytes\]")
+    child.expect(r"failed allocations 1\r\n")
+    child.sendline("heap allocs")
+    child.expect_exact("arena:")
+    child.expect(r"0x[0-9a-f]+ +512 bytes  pc 0x[0-9a-f]+  pid \d+")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
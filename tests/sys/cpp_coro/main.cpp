@@ -0,0 +1,210 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Test application for C++20 coroutines
+ *
+ * @}
+ */
+
+#include <cstdio>
+#include <cstring>
+
+#include "thread.h"
+#include "ztimer.h"
+
+#include "net/ipv6/addr.h"
+#include "riot/coro.hpp"
+#include "riot/coro/udp.hpp"
+
+using namespace riot::coro;
+
+#define TEST_FLAG       (0x2)
+#define UDP_PORT        (4711)
+
+static bool _failed;
+static char _order[8];
+static unsigned _order_len;
+
+static void _check(bool cond, const char *msg)
+{
+  if (!cond) {
+    printf("FAILED: %s\n", msg);
+    _failed = true;
+  }
+}
+
+static void _record(char c)
+{
+  if (_order_len < sizeof(_order) - 1) {
+    _order[_order_len++] = c;
+  }
+}
+
+static void _reset_order()
+{
+  memset(_order, 0, sizeof(_order));
+  _order_len = 0;
+}
+
+/* tasks returning values */
+
+static task<int> _add(int a, int b)
+{
+  co_await yield();
+  co_return a + b;
+}
+
+static task<> _test_result()
+{
+  int sum = co_await _add(1, 2);
+  sum += co_await _add(sum, 4);
+  _check(sum == 10, "result");
+  puts("result: done");
+}
+
+/* sleeping tasks wake up in the order of their timeouts */
+
+static task<> _sleeper(char name, uint32_t ms)
+{
+  co_await sleep(ZTIMER_MSEC, ms);
+  _record(name);
+}
+
+/* the mutex is handed over in FIFO order */
+
+static mutex _mtx;
+
+static task<> _locker(char name)
+{
+  co_await _mtx.lock();
+  _record(name);
+  co_await sleep(ZTIMER_MSEC, 5);
+  _record(name);
+  _mtx.unlock();
+}
+
+/* notification from another task */
+
+static notification _note;
+
+static task<> _waiter()
+{
+  co_await _note.wait();
+  _record('w');
+}
+
+static task<> _notifier()
+{
+  _record('n');
+  _note.notify();
+  co_return;
+}
+
+/* thread flags set from an interrupt handler */
+
+static void _set_flag(void *arg)
+{
+  thread_flags_set(static_cast<thread_t *>(arg), TEST_FLAG);
+}
+
+static task<> _test_flags()
+{
+  ztimer_t timer = {};
+  timer.callback = _set_flag;
+  timer.arg = thread_get_active();
+  ztimer_set(ZTIMER_MSEC, &timer, 10);
+
+  thread_flags_t flags = co_await wait_flags_any(TEST_FLAG);
+  _check(flags == TEST_FLAG, "flags");
+  puts("flags: done");
+}
+
+/* UDP over the loopback address */
+
+static task<> _udp_server(executor& exec)
+{
+  sock_udp_ep_t local = SOCK_IPV6_EP_ANY;
+  local.port = UDP_PORT;
+  udp_sock sock;
+  char buf[16];
+  sock_udp_ep_t remote;
+
+  _check(sock.create(exec, &local) == 0, "server create");
+  ssize_t res = co_await sock.recv(buf, sizeof(buf), &remote);
+  _check(res == 4 && !memcmp(buf, "ping", 4), "server recv");
+  _check(sock.send("pong", 4, &remote) == 4, "server send");
+}
+
+static task<> _udp_client(executor& exec)
+{
+  sock_udp_ep_t local = SOCK_IPV6_EP_ANY;
+  sock_udp_ep_t remote = SOCK_IPV6_EP_ANY;
+  udp_sock sock;
+  char buf[16];
+
+  memcpy(remote.addr.ipv6, &ipv6_addr_loopback, sizeof(remote.addr.ipv6));
+  remote.port = UDP_PORT;
+  local.port = UDP_PORT + 1;
+
+  _check(sock.create(exec, &local) == 0, "client create");
+  /* let the server wait for the packet first */
+  co_await sleep(ZTIMER_MSEC, 10);
+  _check(sock.send("ping", 4, &remote) == 4, "client send");
+  ssize_t res = co_await sock.recv(buf, sizeof(buf));
+  _check(res == 4 && !memcmp(buf, "pong", 4), "client recv");
+  puts("udp: done");
+}
+
+int main()
+{
+  executor exec;
+
+  puts("START");
+
+  exec.spawn(_test_result());
+  exec.run();
+
+  _reset_order();
+  exec.spawn(_sleeper('a', 30));
+  exec.spawn(_sleeper('b', 10));
+  exec.spawn(_sleeper('c', 20));
+  exec.run();
+  _check(!strcmp(_order, "bca"), "sleep order");
+  puts("sleep: done");
+
+  _reset_order();
+  exec.spawn(_locker('a'));
+  exec.spawn(_locker('b'));
+  exec.spawn(_locker('c'));
+  exec.run();
+  _check(!strcmp(_order, "aabbcc"), "mutex order");
+  puts("mutex: done");
+
+  _reset_order();
+  exec.spawn(_waiter());
+  exec.spawn(_notifier());
+  exec.run();
+  _check(!strcmp(_order, "nw"), "notification");
+  puts("notification: done");
+
+  exec.spawn(_test_flags());
+  exec.run();
+
+  exec.spawn(_udp_server(exec));
+  exec.spawn(_udp_client(exec));
+  exec.run();
+
+  puts(_failed ? "FAILURE" : "SUCCESS");
+
+  return 0;
+}
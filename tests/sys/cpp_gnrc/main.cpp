@@ -0,0 +1,331 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Tests the C++ packet views of cpp_gnrc
+ *
+ * @}
+ */
+
+#include <cstring>
+#include <utility>
+
+#include "embUnit.h"
+#include "net/gnrc/pktbuf.h"
+#include "riot/gnrc/pkt.hpp"
+
+using riot::gnrc::coap_view;
+using riot::gnrc::pkt;
+using riot::gnrc::span;
+
+/* CON GET, message ID 0x1234, token 0xcafe */
+#define COAP_HDR        0x42, 0x01, 0x12, 0x34, 0xca, 0xfe
+#define COAP_HDR_LEN    (6U)
+
+static coap_view _view(const uint8_t *msg, std::size_t len)
+{
+  return coap_view{span<const uint8_t>{msg, len}};
+}
+
+static bool _equals(span<const uint8_t> s, const uint8_t *data,
+                    std::size_t len)
+{
+  return (s.size() == len) && (memcmp(s.data(), data, len) == 0);
+}
+
+static gnrc_pktsnip_t *_alloc(std::size_t size = 8)
+{
+  return gnrc_pktbuf_add(NULL, NULL, size, GNRC_NETTYPE_UNDEF);
+}
+
+static void tear_down(void)
+{
+  TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+static void test_coap_view__fixed_hdr(void)
+{
+  static const uint8_t msg[] = { COAP_HDR };
+  static const uint8_t token[] = { 0xca, 0xfe };
+  coap_view coap = _view(msg, sizeof(msg));
+
+  TEST_ASSERT(coap.valid());
+  TEST_ASSERT_EQUAL_INT(COAP_V1, coap.version());
+  TEST_ASSERT_EQUAL_INT(COAP_TYPE_CON, coap.type());
+  TEST_ASSERT_EQUAL_INT(2, coap.token_len());
+  TEST_ASSERT_EQUAL_INT(COAP_METHOD_GET, coap.code());
+  TEST_ASSERT_EQUAL_INT(0x1234, coap.msg_id());
+  TEST_ASSERT(_equals(coap.token(), token, sizeof(token)));
+  TEST_ASSERT(coap.options().empty());
+  TEST_ASSERT(coap.payload().empty());
+}
+
+static void test_coap_view__invalid(void)
+{
+  /* too short for the fixed header */
+  static const uint8_t msg1[] = { 0x40, 0x01, 0x12 };
+  /* version 2 */
+  static const uint8_t msg2[] = { 0x80, 0x01, 0x12, 0x34 };
+  /* token length 9 */
+  static const uint8_t msg3[] = { 0x49, 0x01, 0x12, 0x34, 0, 0, 0, 0, 0, 0,
+                                  0, 0, 0 };
+  /* token truncated */
+  static const uint8_t msg4[] = { 0x44, 0x01, 0x12, 0x34, 0xca, 0xfe };
+
+  TEST_ASSERT(!_view(msg1, sizeof(msg1)).valid());
+  TEST_ASSERT(!_view(msg2, sizeof(msg2)).valid());
+  TEST_ASSERT(!_view(msg3, sizeof(msg3)).valid());
+  TEST_ASSERT(!_view(msg4, sizeof(msg4)).valid());
+}
+
+static void test_coap_view__options_payload(void)
+{
+  /* Uri-Path "a" and "bc", then payload */
+  static const uint8_t msg[] = { COAP_HDR, 0xb1, 'a', 0x02, 'b', 'c',
+                                 0xff, 'x', 'y' };
+  static const uint8_t payload[] = { 'x', 'y' };
+  coap_view coap = _view(msg, sizeof(msg));
+
+  TEST_ASSERT(coap.valid());
+  TEST_ASSERT(_equals(coap.options(), &msg[COAP_HDR_LEN], 5));
+  TEST_ASSERT(_equals(coap.payload(), payload, sizeof(payload)));
+}
+
+static void test_coap_view__options_no_payload(void)
+{
+  static const uint8_t msg[] = { COAP_HDR, 0xb1, 'a', 0x02, 'b', 'c' };
+  coap_view coap = _view(msg, sizeof(msg));
+
+  TEST_ASSERT(_equals(coap.options(), &msg[COAP_HDR_LEN], 5));
+  TEST_ASSERT(coap.payload().empty());
+}
+
+static void test_coap_view__payload_only(void)
+{
+  static const uint8_t msg[] = { COAP_HDR, 0xff, 'x' };
+  static const uint8_t payload[] = { 'x' };
+  coap_view coap = _view(msg, sizeof(msg));
+
+  TEST_ASSERT(coap.options().empty());
+  TEST_ASSERT(_equals(coap.payload(), payload, sizeof(payload)));
+}
+
+static void test_coap_view__bare_payload_marker(void)
+{
+  static const uint8_t msg[] = { COAP_HDR, 0xb1, 'a', 0xff };
+  coap_view coap = _view(msg, sizeof(msg));
+
+  TEST_ASSERT(_equals(coap.options(), &msg[COAP_HDR_LEN], 2));
+  TEST_ASSERT(coap.payload().empty());
+}
+
+static void test_coap_view__ext_delta(void)
+{
+  /* delta 13 + 1, then delta 269 + 2 with one byte each */
+  static const uint8_t msg[] = { COAP_HDR, 0xd1, 0x01, 'a',
+                                 0xe1, 0x00, 0x02, 'b', 0xff, 'x' };
+  static const uint8_t payload[] = { 'x' };
+  coap_view coap = _view(msg, sizeof(msg));
+
+  TEST_ASSERT(_equals(coap.options(), &msg[COAP_HDR_LEN], 7));
+  TEST_ASSERT(_equals(coap.payload(), payload, sizeof(payload)));
+}
+
+static void test_coap_view__ext_len13(void)
+{
+  /* length 13 + 2 */
+  uint8_t msg[COAP_HDR_LEN + 2 + 15 + 2] = { COAP_HDR, 0xbd, 0x02 };
+
+  memset(&msg[COAP_HDR_LEN + 2], 'a', 15);
+  msg[sizeof(msg) - 2] = 0xff;
+  msg[sizeof(msg) - 1] = 'x';
+
+  coap_view coap = _view(msg, sizeof(msg));
+
+  TEST_ASSERT_EQUAL_INT(2 + 15, coap.options().size());
+  TEST_ASSERT_EQUAL_INT(1, coap.payload().size());
+  TEST_ASSERT_EQUAL_INT('x', coap.payload()[0]);
+}
+
+static void test_coap_view__ext_len14(void)
+{
+  /* length 269 + 3 */
+  static uint8_t msg[COAP_HDR_LEN + 3 + 272 + 2] = { COAP_HDR, 0xbe, 0x00,
+                                                     0x03 };
+
+  memset(&msg[COAP_HDR_LEN + 3], 0xff, 272);
+  msg[sizeof(msg) - 2] = 0xff;
+  msg[sizeof(msg) - 1] = 'x';
+
+  coap_view coap = _view(msg, sizeof(msg));
+
+  /* option values consisting of 0xff are not mistaken for the marker */
+  TEST_ASSERT_EQUAL_INT(3 + 272, coap.options().size());
+  TEST_ASSERT_EQUAL_INT(1, coap.payload().size());
+  TEST_ASSERT_EQUAL_INT('x', coap.payload()[0]);
+}
+
+static void test_coap_view__truncated_value(void)
+{
+  /* option of length 5, but only 3 bytes left containing a marker */
+  static const uint8_t msg[] = { COAP_HDR, 0xb5, 'a', 0xff, 'x' };
+  coap_view coap = _view(msg, sizeof(msg));
+
+  TEST_ASSERT_EQUAL_INT(4, coap.options().size());
+  TEST_ASSERT(coap.payload().empty());
+}
+
+static void test_coap_view__truncated_ext_len(void)
+{
+  /* 2 byte extended length, but only one byte left */
+  static const uint8_t msg[] = { COAP_HDR, 0xbe, 0x00 };
+  coap_view coap = _view(msg, sizeof(msg));
+
+  TEST_ASSERT_EQUAL_INT(2, coap.options().size());
+  TEST_ASSERT(coap.payload().empty());
+}
+
+static void test_coap_view__reserved_nibble(void)
+{
+  /* delta 15 without length 15 is a message format error */
+  static const uint8_t msg[] = { COAP_HDR, 0xf1, 'a', 0xff, 'x' };
+  coap_view coap = _view(msg, sizeof(msg));
+
+  TEST_ASSERT(coap.payload().empty());
+}
+
+static void test_pkt__release_on_destruction(void)
+{
+  {
+    pkt p{_alloc()};
+
+    TEST_ASSERT(static_cast<bool>(p));
+    TEST_ASSERT(!gnrc_pktbuf_is_empty());
+  }
+  TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+static void test_pkt__share(void)
+{
+  pkt p{_alloc()};
+  {
+    pkt other = p.share();
+
+    TEST_ASSERT(other.get() == p.get());
+    TEST_ASSERT_EQUAL_INT(2, p.get()->users);
+  }
+  TEST_ASSERT_EQUAL_INT(1, p.get()->users);
+}
+
+static void test_pkt__move(void)
+{
+  pkt p{_alloc()};
+  gnrc_pktsnip_t *snip = p.get();
+  pkt moved{std::move(p)};
+
+  TEST_ASSERT(!p);
+  TEST_ASSERT(moved.get() == snip);
+  TEST_ASSERT_EQUAL_INT(1, snip->users);
+
+  /* the packet held by the target of the assignment is released */
+  pkt assigned{_alloc()};
+
+  assigned = std::move(moved);
+  TEST_ASSERT(!moved);
+  TEST_ASSERT(assigned.get() == snip);
+  TEST_ASSERT_EQUAL_INT(1, snip->users);
+}
+
+static void test_pkt__release(void)
+{
+  pkt p{_alloc()};
+  gnrc_pktsnip_t *snip = p.release();
+
+  TEST_ASSERT(!p);
+  TEST_ASSERT_EQUAL_INT(1, snip->users);
+  gnrc_pktbuf_release(snip);
+}
+
+static void test_pkt__start_write_unshared(void)
+{
+  pkt p{_alloc()};
+  gnrc_pktsnip_t *snip = p.get();
+
+  TEST_ASSERT(p.start_write());
+  TEST_ASSERT(p.get() == snip);
+  TEST_ASSERT_EQUAL_INT(1, snip->users);
+}
+
+static void test_pkt__start_write_shared(void)
+{
+  pkt p{_alloc()};
+  pkt other = p.share();
+
+  TEST_ASSERT(other.start_write());
+  TEST_ASSERT(other.get() != p.get());
+  TEST_ASSERT_EQUAL_INT(1, p.get()->users);
+  TEST_ASSERT_EQUAL_INT(1, other.get()->users);
+}
+
+static void test_pkt__start_write_no_space(void)
+{
+  /* there is no space for a copy of more than half the packet buffer */
+  pkt p{_alloc((CONFIG_GNRC_PKTBUF_SIZE / 2) + 64)};
+
+  TEST_ASSERT(static_cast<bool>(p));
+
+  pkt other = p.share();
+  gnrc_pktsnip_t *snip = p.get();
+
+  TEST_ASSERT(!other.start_write());
+  /* the reference is kept, so both are released on destruction */
+  TEST_ASSERT(other.get() == snip);
+  TEST_ASSERT_EQUAL_INT(2, snip->users);
+}
+
+static Test *tests_cpp_gnrc(void)
+{
+  EMB_UNIT_TESTFIXTURES(fixtures) {
+    new_TestFixture(test_coap_view__fixed_hdr),
+    new_TestFixture(test_coap_view__invalid),
+    new_TestFixture(test_coap_view__options_payload),
+    new_TestFixture(test_coap_view__options_no_payload),
+    new_TestFixture(test_coap_view__payload_only),
+    new_TestFixture(test_coap_view__bare_payload_marker),
+    new_TestFixture(test_coap_view__ext_delta),
+    new_TestFixture(test_coap_view__ext_len13),
+    new_TestFixture(test_coap_view__ext_len14),
+    new_TestFixture(test_coap_view__truncated_value),
+    new_TestFixture(test_coap_view__truncated_ext_len),
+    new_TestFixture(test_coap_view__reserved_nibble),
+    new_TestFixture(test_pkt__release_on_destruction),
+    new_TestFixture(test_pkt__share),
+    new_TestFixture(test_pkt__move),
+    new_TestFixture(test_pkt__release),
+    new_TestFixture(test_pkt__start_write_unshared),
+    new_TestFixture(test_pkt__start_write_shared),
+    new_TestFixture(test_pkt__start_write_no_space),
+  };
+
+  EMB_UNIT_TESTCALLER(tests, NULL, tear_down, fixtures);
+
+  return (Test *)&tests;
+}
+
+int main()
+{
+  TESTS_START();
+  TESTS_RUN(tests_cpp_gnrc());
+  TESTS_END();
+
+  return 0;
+}
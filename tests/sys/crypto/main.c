@@ -7,10 +7,17 @@
  * directory for more details.
  */
 
+#include "kernel_defines.h"
+
 #include "tests-crypto.h"
 
 int main(void)
 {
+#if IS_ACTIVE(BENCH_CRYPTO)
+    bench_crypto_sha256();
+    bench_crypto_aes();
+#endif
+
     TESTS_START();
     TESTS_RUN(tests_crypto_helper_tests());
     TESTS_RUN(tests_crypto_chacha_tests());
@@ -23,6 +30,7 @@ int main(void)
     TESTS_RUN(tests_crypto_modes_ecb_tests());
     TESTS_RUN(tests_crypto_modes_cbc_tests());
     TESTS_RUN(tests_crypto_modes_ctr_tests());
+    TESTS_RUN(tests_crypto_sha256_tests());
     TESTS_END();
     return 0;
 }
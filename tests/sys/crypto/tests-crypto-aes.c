@@ -6,13 +6,37 @@
  * directory for more details.
  */
 
+#include <inttypes.h>
+#include <stdio.h>
 #include <string.h>
 #include <limits.h>
 
 #include "embUnit.h"
 #include "crypto/aes.h"
+#include "crypto/ciphers.h"
+#include "crypto/modes/ccm.h"
+#include "crypto/modes/ctr.h"
+#include "modules.h"
+#include "periph_conf.h"
+#include "ztimer.h"
 #include "tests-crypto.h"
 
+#ifndef BENCH_AES_BYTES
+#define BENCH_AES_BYTES     1024UL
+#endif
+
+#ifndef BENCH_AES_RUNS
+#define BENCH_AES_RUNS      256UL
+#endif
+
+#if IS_USED(MODULE_CRYPTO_AES_HW)
+#define _IMPL_NAME     "hw"
+#elif IS_USED(MODULE_CRYPTO_AES_UNROLL)
+#define _IMPL_NAME     "unroll"
+#else
+#define _IMPL_NAME     "default"
+#endif
+
 static uint8_t TEST_0_KEY[] = {
     0x0, 0x1, 0x2, 0x3, 0x4, 0x5, 0x6, 0x7,
     0x8, 0x9, 0xA, 0xB, 0xC, 0xD, 0xE, 0xF
@@ -87,6 +111,50 @@ static void test_crypto_aes_decrypt(void)
                                      AES_BLOCK_SIZE), "wrong plaintext");
 }
 
+static void test_crypto_aes_encrypt_blocks(void)
+{
+    /* covers the four block interleaving of hardware backends and the tail */
+    enum { BLOCKS = 7 };
+    static uint8_t plain[BLOCKS * AES_BLOCK_SIZE];
+    static uint8_t expected[BLOCKS * AES_BLOCK_SIZE];
+    static uint8_t data[BLOCKS * AES_BLOCK_SIZE];
+    static const uint8_t key_256[32] = { 0x42 };
+    cipher_context_t ctx;
+
+    for (unsigned i = 0; i < sizeof(plain); i++) {
+        plain[i] = i * 13;
+    }
+
+    for (unsigned k = 0; k < 2; k++) {
+        if (k == 0) {
+            TEST_ASSERT_EQUAL_INT(1, aes_init(&ctx, TEST_0_KEY,
+                                              sizeof(TEST_0_KEY)));
+        }
+        else {
+            TEST_ASSERT_EQUAL_INT(1, aes_init(&ctx, key_256, sizeof(key_256)));
+        }
+
+        for (unsigned i = 0; i < BLOCKS; i++) {
+            TEST_ASSERT_EQUAL_INT(1, aes_encrypt(&ctx,
+                                                 &plain[i * AES_BLOCK_SIZE],
+                                                 &expected[i * AES_BLOCK_SIZE]));
+        }
+
+        TEST_ASSERT_EQUAL_INT(1, aes_encrypt_blocks(&ctx, plain, data, BLOCKS));
+        TEST_ASSERT(compare(expected, data, sizeof(data)));
+
+        /* in place */
+        memcpy(data, plain, sizeof(data));
+        TEST_ASSERT_EQUAL_INT(1, aes_encrypt_blocks(&ctx, data, data, BLOCKS));
+        TEST_ASSERT(compare(expected, data, sizeof(data)));
+    }
+
+    /* the first block must still match the known answer */
+    TEST_ASSERT_EQUAL_INT(1, aes_init(&ctx, TEST_0_KEY, sizeof(TEST_0_KEY)));
+    TEST_ASSERT_EQUAL_INT(1, aes_encrypt_blocks(&ctx, TEST_0_INP, data, 1));
+    TEST_ASSERT(compare(TEST_0_ENC, data, AES_BLOCK_SIZE));
+}
+
 static void test_crypto_aes_init_key_length(void)
 {
     cipher_context_t ctx;
@@ -100,11 +168,64 @@ static void test_crypto_aes_init_key_length(void)
     TEST_ASSERT_EQUAL_INT(CIPHER_ERR_INVALID_KEY_SIZE, err);
 }
 
+#if IS_ACTIVE(BENCH_CRYPTO)
+static void _print_bench(const char *mode, uint32_t us)
+{
+    /* cycles per byte times 100, based on the nominal core clock */
+    uint32_t cpb = ((uint64_t)us * (CLOCK_CORECLOCK / 10000)) /
+                   (BENCH_AES_BYTES * BENCH_AES_RUNS);
+
+    printf("{ \"aes128\" : \"%s\", \"mode\" : \"%s\", \"bytes\" : %lu, "
+           "\"us\" : %" PRIu32 ", \"cycles_per_byte\" : %" PRIu32 ".%02" PRIu32
+           " }\n", _IMPL_NAME, mode, BENCH_AES_BYTES * BENCH_AES_RUNS, us,
+           cpb / 100, cpb % 100);
+}
+
+void bench_crypto_aes(void)
+{
+    static uint8_t buf[BENCH_AES_BYTES + 16];
+    uint8_t nonce[16] = { 0 };
+    cipher_t cipher;
+    uint32_t start;
+
+    cipher_init(&cipher, CIPHER_AES, TEST_0_KEY, sizeof(TEST_0_KEY));
+
+    start = ztimer_now(ZTIMER_USEC);
+    for (unsigned i = 0; i < BENCH_AES_RUNS; i++) {
+        for (unsigned j = 0; j < BENCH_AES_BYTES; j += AES_BLOCK_SIZE) {
+            cipher_encrypt(&cipher, &buf[j], &buf[j]);
+        }
+    }
+    _print_bench("ecb_single", ztimer_now(ZTIMER_USEC) - start);
+
+    start = ztimer_now(ZTIMER_USEC);
+    for (unsigned i = 0; i < BENCH_AES_RUNS; i++) {
+        cipher_encrypt_blocks(&cipher, buf, buf,
+                              BENCH_AES_BYTES / AES_BLOCK_SIZE);
+    }
+    _print_bench("ecb_blocks", ztimer_now(ZTIMER_USEC) - start);
+
+    start = ztimer_now(ZTIMER_USEC);
+    for (unsigned i = 0; i < BENCH_AES_RUNS; i++) {
+        cipher_encrypt_ctr(&cipher, nonce, 8, buf, BENCH_AES_BYTES, buf);
+    }
+    _print_bench("ctr", ztimer_now(ZTIMER_USEC) - start);
+
+    start = ztimer_now(ZTIMER_USEC);
+    for (unsigned i = 0; i < BENCH_AES_RUNS; i++) {
+        cipher_encrypt_ccm(&cipher, NULL, 0, 16, 2, nonce, 13,
+                           buf, BENCH_AES_BYTES, buf);
+    }
+    _print_bench("ccm", ztimer_now(ZTIMER_USEC) - start);
+}
+#endif
+
 Test *tests_crypto_aes_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
         new_TestFixture(test_crypto_aes_encrypt),
         new_TestFixture(test_crypto_aes_decrypt),
+        new_TestFixture(test_crypto_aes_encrypt_blocks),
         new_TestFixture(test_crypto_aes_init_key_length),
     };
 
@@ -0,0 +1,115 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "container.h"
+#include "embUnit/embUnit.h"
+#include "hashes/sha256.h"
+#include "modules.h"
+#include "periph_conf.h"
+#include "ztimer.h"
+
+#include "tests-crypto.h"
+
+#ifndef BENCH_BYTES
+#define BENCH_BYTES     (1024UL * 1024)
+#endif
+
+#if IS_USED(MODULE_SHA256_HW)
+#define _IMPL_NAME     "hw"
+#elif IS_USED(MODULE_SHA256_FAST)
+#define _IMPL_NAME     "fast"
+#else
+#define _IMPL_NAME     "small"
+#endif
+
+/* with a spare byte to hash unaligned data */
+static uint32_t _buf[(4096 / sizeof(uint32_t)) + 1];
+
+/* SHA-256 of the 4000 bytes starting at offset 1 of _buf */
+static const uint8_t _digest_4000[SHA256_DIGEST_LENGTH] = {
+    0x9f, 0x4d, 0xa1, 0xc2, 0xfd, 0x6e, 0x51, 0x3b,
+    0x8f, 0xcb, 0xdc, 0x78, 0xa3, 0x45, 0x5e, 0x5a,
+    0x9d, 0x53, 0xc9, 0x71, 0xa8, 0xd7, 0x86, 0x91,
+    0xbe, 0x17, 0x91, 0x25, 0xb6, 0x4d, 0x4e, 0x12,
+};
+
+static void _fill(void)
+{
+    for (unsigned i = 0; i < sizeof(_buf); i++) {
+        ((uint8_t *)_buf)[i] = i * 7;
+    }
+}
+
+static void test_crypto_sha256_multi_block(void)
+{
+    uint8_t digest[SHA256_DIGEST_LENGTH];
+
+    _fill();
+    sha256((uint8_t *)_buf + 1, 4000, digest);
+    TEST_ASSERT(compare(_digest_4000, digest, sizeof(digest)));
+}
+
+static void test_crypto_sha256_chunks(void)
+{
+    static const uint16_t chunks[] = { 1, 63, 64, 65, 127, 200, 1024 };
+    const uint8_t *data = (uint8_t *)_buf + 1;
+    uint8_t digest[SHA256_DIGEST_LENGTH];
+    sha256_context_t ctx;
+    size_t left = 4000;
+
+    _fill();
+    sha256_init(&ctx);
+    /* cover partial blocks before and after runs of complete blocks */
+    for (unsigned i = 0; left; i = (i + 1) % ARRAY_SIZE(chunks)) {
+        size_t len = chunks[i] < left ? chunks[i] : left;
+
+        sha256_update(&ctx, data, len);
+        data += len;
+        left -= len;
+    }
+    sha256_final(&ctx, digest);
+    TEST_ASSERT(compare(_digest_4000, digest, sizeof(digest)));
+}
+
+#if IS_ACTIVE(BENCH_CRYPTO)
+void bench_crypto_sha256(void)
+{
+    uint8_t digest[SHA256_DIGEST_LENGTH];
+    sha256_context_t ctx;
+    uint32_t start, us;
+
+    _fill();
+    sha256_init(&ctx);
+    start = ztimer_now(ZTIMER_USEC);
+    for (unsigned i = 0; i < BENCH_BYTES / 4096; i++) {
+        sha256_update(&ctx, _buf, 4096);
+    }
+    sha256_final(&ctx, digest);
+    us = ztimer_now(ZTIMER_USEC) - start;
+
+    /* cycles per byte times 100, based on the nominal core clock */
+    uint32_t cpb = ((uint64_t)us * (CLOCK_CORECLOCK / 10000)) / BENCH_BYTES;
+    printf("{ \"sha256\" : \"%s\", \"bytes\" : %lu, \"us\" : %" PRIu32 ", "
+           "\"cycles_per_byte\" : %" PRIu32 ".%02" PRIu32 " }\n",
+           _IMPL_NAME, BENCH_BYTES, us, cpb / 100, cpb % 100);
+}
+#endif
+
+Test *tests_crypto_sha256_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_crypto_sha256_multi_block),
+        new_TestFixture(test_crypto_sha256_chunks),
+    };
+    EMB_UNIT_TESTCALLER(crypto_sha256_tests, NULL, NULL, fixtures);
+    return (Test *)&crypto_sha256_tests;
+}
@@ -64,6 +64,23 @@ Test* tests_crypto_modes_ecb_tests(void);
 Test* tests_crypto_modes_cbc_tests(void);
 Test* tests_crypto_modes_ctr_tests(void);
 
+/**
+ * @brief   Generates tests for hashes/sha256.h
+ *
+ * @return  embUnit tests
+ */
+Test *tests_crypto_sha256_tests(void);
+
+/**
+ * @brief   Prints the throughput of the selected SHA-256 implementation
+ */
+void bench_crypto_sha256(void);
+
+/**
+ * @brief   Prints the throughput of AES-128 in ECB, CTR and CCM mode
+ */
+void bench_crypto_aes(void);
+
 #ifdef __cplusplus
 }
 #endif
@@ -22,6 +22,8 @@
 
 #include <stdio.h>
 
+#include "container.h"
+#include "macros/utils.h"
 #include "test_utils/expect.h"
 #include "timex.h"
 #include "thread.h"
@@ -39,6 +41,7 @@
  * than main s.t. it doesn't start executing right after events are enqueued */
 #define PRIO                    (THREAD_PRIORITY_MAIN + 1)
 #define DELAYED_QUEUES_NUMOF    2
+#define BATCH_EVENTS_NUMOF      4
 
 static char stack[STACKSIZE];
 
@@ -136,6 +139,32 @@ static void delayed_callback3(event_t *arg)
     printf("triggered delayed event %p\n", (void *)arg);
 }
 
+static event_queue_t *batch_queues;
+static event_t *batch_order[BATCH_EVENTS_NUMOF + 1];
+static unsigned batch_handled;
+static void batch_callback_low(event_t *arg);
+static void batch_callback_high(event_t *arg);
+static event_t batch_events[BATCH_EVENTS_NUMOF] = {
+    { .handler = batch_callback_low }, { .handler = batch_callback_low },
+    { .handler = batch_callback_low }, { .handler = batch_callback_low },
+};
+static event_t batch_event_high = { .handler = batch_callback_high };
+
+static void batch_callback_low(event_t *arg)
+{
+    expect(batch_handled < ARRAY_SIZE(batch_order));
+    if (arg == &batch_events[0]) {
+        event_post(&batch_queues[0], &batch_event_high);
+    }
+    batch_order[batch_handled++] = arg;
+}
+
+static void batch_callback_high(event_t *arg)
+{
+    expect(batch_handled < ARRAY_SIZE(batch_order));
+    batch_order[batch_handled++] = arg;
+}
+
 static void *claiming_thread(void *arg)
 {
     event_queue_t *dqs = arg;
@@ -179,6 +208,35 @@ int main(void)
     event_sync(&dqs[1]);
     expect(order == 3);
     printf("synced with %p\n", (void *)&delayed_event3);
+#if IS_USED(MODULE_EVENT_STATS)
+    /* two delayed events and the sync event were queued before the claim */
+    expect(dqs[1].stats.depth_max == 3);
+    expect(dqs[0].stats.depth_max == 1);
+    expect(dqs[0].stats.handled == 1);
+    expect(dqs[0].stats.slowest == delayed_callback3);
+#endif
+
+    /* test that up to CONFIG_EVENT_LOOP_BATCH_BUDGET events of a lower
+     * priority queue are handled before an event posted to a higher priority
+     * queue in between */
+    batch_queues = dqs;
+    for (unsigned i = 0; i < BATCH_EVENTS_NUMOF; i++) {
+        event_post(&dqs[1], &batch_events[i]);
+    }
+    event_sync(&dqs[1]);
+    event_sync(&dqs[0]);
+    expect(batch_handled == ARRAY_SIZE(batch_order));
+    for (unsigned i = 0, low = 0; i < ARRAY_SIZE(batch_order); i++) {
+        if (i == MIN(CONFIG_EVENT_LOOP_BATCH_BUDGET, BATCH_EVENTS_NUMOF)) {
+            expect(batch_order[i] == &batch_event_high);
+        }
+        else {
+            expect(batch_order[i] == &batch_events[low++]);
+        }
+    }
+    printf("handled %u events in a row with budget %u\n",
+           (unsigned)MIN(CONFIG_EVENT_LOOP_BATCH_BUDGET, BATCH_EVENTS_NUMOF),
+           (unsigned)CONFIG_EVENT_LOOP_BATCH_BUDGET);
 
     /* test posting different kind of events in order to a statically
      * initialized queue */
@@ -193,6 +251,10 @@ int main(void)
 
     puts("posting custom event");
     event_post(&queue, (event_t *)&custom_event);
+#if IS_USED(MODULE_EVENT_STATS)
+    expect(queue.stats.depth == 2);
+    expect(queue.stats.depth_max == 2);
+#endif
 
     event_timeout_t event_timeout;
 
@@ -0,0 +1,125 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Test application for mutex contention profiling
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+
+#include "mutex.h"
+#include "mutex_profiling.h"
+#include "schedstatistics.h"
+#include "thread.h"
+#include "timex.h"
+#include "ztimer.h"
+
+#define WAIT_US     (10U * US_PER_MS)
+#define HOLD_US     (5U * US_PER_MS)
+#define SIGNAL_US   (1U * US_PER_MS)
+
+static char _stack[THREAD_STACKSIZE_DEFAULT];
+static mutex_t _lock = MUTEX_INIT;
+static mutex_t _signal = MUTEX_INIT_LOCKED;
+static unsigned _failed;
+
+static void _check(int cond, const char *what)
+{
+    if (!cond) {
+        printf("FAILED: %s\n", what);
+        _failed++;
+    }
+}
+
+static void *_waiter(void *arg)
+{
+    (void)arg;
+
+    mutex_lock(&_lock);
+    ztimer_sleep(ZTIMER_USEC, HOLD_US);
+    mutex_unlock(&_lock);
+
+    return NULL;
+}
+
+static void _unlock_cb(void *arg)
+{
+    mutex_unlock(arg);
+}
+
+static void test_contention(void)
+{
+    mutex_profile_t p;
+
+    puts("contention");
+    mutex_lock(&_lock);
+    kernel_pid_t pid = thread_create(_stack, sizeof(_stack),
+                                     THREAD_PRIORITY_MAIN - 1, 0,
+                                     _waiter, NULL, "waiter");
+    ztimer_sleep(ZTIMER_USEC, WAIT_US);
+    /* the waiter runs, holds the lock for a while and terminates */
+    mutex_unlock(&_lock);
+    /* lock again only after that, so this lock is never contended */
+    while (thread_getstatus(pid) != STATUS_NOT_FOUND) {
+        ztimer_sleep(ZTIMER_USEC, HOLD_US);
+    }
+    mutex_lock(&_lock);
+    mutex_unlock(&_lock);
+
+    _check(mutex_profiling_get(&_lock, &p) == 0, "entry exists");
+    printf("locks: %" PRIu32 ", contended: %" PRIu32 ", "
+           "wait: %" PRIu32 " us, hold max: %" PRIu32 " us\n",
+           p.locks, p.contended, p.wait_us, p.hold_max_us);
+    _check(p.locks == 2, "two locks recorded");
+    _check(p.contended == 1, "one contended lock");
+    _check(p.wait_max_us >= WAIT_US, "wait time");
+    _check(p.hold_max_us >= HOLD_US, "hold time");
+    _check(p.wait_max_pc != 0, "caller of the longest wait");
+    _check(p.hold_max_pc == p.wait_max_pc, "caller of the longest hold");
+}
+
+static void test_spin(void)
+{
+    ztimer_t timer = { .callback = _unlock_cb, .arg = &_signal };
+    mutex_profile_t p;
+    unsigned schedules = sched_pidlist[thread_getpid()].schedules;
+
+    puts("spin");
+    /* the mutex is released by an ISR while the caller is still spinning */
+    ztimer_set(ZTIMER_USEC, &timer, SIGNAL_US);
+    mutex_lock(&_signal);
+
+    _check(sched_pidlist[thread_getpid()].schedules == schedules,
+           "got the mutex without blocking");
+    _check(mutex_profiling_get(&_signal, &p) == 0, "entry exists");
+    _check(p.contended == 1, "spinning counts as contention");
+    _check(p.wait_max_us >= SIGNAL_US, "wait time");
+}
+
+int main(void)
+{
+    mutex_profile_t p;
+
+    test_contention();
+    test_spin();
+
+    mutex_profiling_print();
+    mutex_profiling_reset();
+    _check(mutex_profiling_get(&_lock, &p) != 0, "reset");
+
+    puts(_failed ? "[FAILED]" : "[SUCCESS]");
+
+    return 0;
+}
@@ -0,0 +1,167 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ * @file
+ * @brief       Test sys/sched_edf against fixed priority scheduling
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdint.h>
+
+#include "container.h"
+#include "irq.h"
+#include "mutex.h"
+#include "sched_edf.h"
+#include "schedstatistics.h"
+#include "thread.h"
+#include "ztimer.h"
+
+#ifndef JOBS
+#define JOBS        20
+#endif
+
+typedef struct {
+    uint32_t period;        /* in us */
+    uint32_t cost;          /* CPU time per job in us */
+    uint8_t fixed_prio;     /* rate monotonic priority */
+    sched_edf_task_t task;
+} periodic_t;
+
+/* U = 20/50 + 35/70 = 0.9: schedulable by EDF (U <= 1), but not by fixed
+ * priorities, as the second task has a response time of 35 + 2 * 20 > 70 */
+static periodic_t _tasks[] = {
+    { .period = 50000, .cost = 20000, .fixed_prio = THREAD_PRIORITY_MAIN - 2 },
+    { .period = 70000, .cost = 35000, .fixed_prio = THREAD_PRIORITY_MAIN - 1 },
+};
+
+static char _stacks[ARRAY_SIZE(_tasks)][THREAD_STACKSIZE_DEFAULT];
+static mutex_t _done = MUTEX_INIT_LOCKED;
+static unsigned _running;
+static bool _edf;
+
+/* CPU time of the calling thread in us, using schedstatistics */
+static uint64_t _cpu_time(void)
+{
+    unsigned state = irq_disable();
+    const schedstat_t *stat = &sched_pidlist[thread_getpid()];
+    uint64_t us = stat->runtime_us + (ztimer_now(ZTIMER_USEC) - stat->laststart);
+
+    irq_restore(state);
+    return us;
+}
+
+static void _burn(uint32_t us)
+{
+    uint64_t end = _cpu_time() + us;
+
+    while (_cpu_time() < end) {}
+}
+
+static void *_thread(void *arg)
+{
+    periodic_t *p = arg;
+
+    sched_edf_task_init(&p->task, p->period, p->period);
+    if (!_edf) {
+        /* same bookkeeping, but leave the EDF priority */
+        sched_change_priority(thread_get_active(), p->fixed_prio);
+    }
+
+    for (unsigned i = 0; i < JOBS; i++) {
+        _burn(p->cost);
+        sched_edf_task_wait(&p->task);
+    }
+
+    unsigned state = irq_disable();
+    if (--_running == 0) {
+        mutex_unlock(&_done);
+    }
+    irq_restore(state);
+    return NULL;
+}
+
+static kernel_pid_t _order[ARRAY_SIZE(_tasks)];
+static unsigned _order_numof;
+
+static void *_record(void *arg)
+{
+    (void)arg;
+    _order[_order_numof++] = thread_getpid();
+    return NULL;
+}
+
+/* changes the deadline of a thread that already waits in the EDF run queue */
+static bool _set_deadline_runnable(void)
+{
+    thread_t *me = thread_get_active();
+    uint8_t prio = me->priority;
+    uint32_t now = ztimer_now(SCHED_EDF_TIMERBASE);
+    kernel_pid_t first, second;
+
+    /* keep the EDF threads from running until the deadlines are in place */
+    sched_change_priority(me, CONFIG_SCHED_EDF_PRIO - 1);
+    first = thread_create(_stacks[0], sizeof(_stacks[0]), CONFIG_SCHED_EDF_PRIO,
+                          0, _record, NULL, "first");
+    second = thread_create(_stacks[1], sizeof(_stacks[1]), CONFIG_SCHED_EDF_PRIO,
+                           0, _record, NULL, "second");
+    sched_edf_set_deadline(thread_get(first), now + 1000);
+    sched_edf_set_deadline(thread_get(second), now + 2000);
+    /* move the first thread behind the second one */
+    sched_edf_set_deadline(thread_get(first), now + 3000);
+    /* let both run to completion */
+    sched_change_priority(me, prio);
+
+    return (_order_numof == 2) && (_order[0] == second) && (_order[1] == first);
+}
+
+static unsigned _run(bool edf)
+{
+    unsigned misses = 0;
+
+    _edf = edf;
+    _running = ARRAY_SIZE(_tasks);
+    for (unsigned i = 0; i < ARRAY_SIZE(_tasks); i++) {
+        thread_create(_stacks[i], sizeof(_stacks[i]), CONFIG_SCHED_EDF_PRIO,
+                      0, _thread, &_tasks[i], "periodic");
+    }
+    mutex_lock(&_done);
+
+    for (unsigned i = 0; i < ARRAY_SIZE(_tasks); i++) {
+        const sched_edf_task_t *task = &_tasks[i].task;
+
+        printf("{ \"sched\" : \"%s\", \"task\" : %u, \"jobs\" : %" PRIu32 ", "
+               "\"misses\" : %" PRIu32 ", \"miss_rate\" : %" PRIu32 " }\n",
+               edf ? "edf" : "fixed", i, task->jobs, task->misses,
+               task->misses * 100 / task->jobs);
+        misses += task->misses;
+    }
+    return misses;
+}
+
+int main(void)
+{
+    if (!_set_deadline_runnable()) {
+        puts("[FAILED] run queue not reordered on deadline change");
+        return 0;
+    }
+    puts("run queue reordered on deadline change");
+
+    _run(false);
+    if (_run(true) == 0) {
+        puts("[SUCCESS]");
+    }
+    else {
+        puts("[FAILED]");
+    }
+    return 0;
+}
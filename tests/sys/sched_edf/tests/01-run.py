@@ -0,0 +1,24 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 Freie Universität Berlin
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+
+def testfunc(child):
+    child.expect_exact("run queue reordered on deadline change")
+    for sched in ("fixed", "edf"):
+        for task in range(2):
+            child.expect(r'{ "sched" : "%s", "task" : %d, "jobs" : 20, '
+                         r'"misses" : (\d+), "miss_rate" : (\d+) }'
+                         % (sched, task))
+    child.expect_exact("[SUCCESS]")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc, timeout=30))
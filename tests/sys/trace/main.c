@@ -22,14 +22,45 @@
  * @}
  */
 
+#include "msg.h"
+#include "thread.h"
 #include "trace.h"
+#include "ztimer.h"
+
+static char _stack[THREAD_STACKSIZE_DEFAULT];
+
+static void *_echo(void *arg)
+{
+    (void)arg;
+    msg_t msg;
+
+    msg_receive(&msg);
+    msg_reply(&msg, &msg);
+
+    return NULL;
+}
 
 int main(void)
 {
+    trace_disable(TRACE_CAT_ALL & ~TRACE_CAT_MASK(TRACE_CAT_USER));
     trace(0);
     trace(1);
 
     trace_dump();
 
+    /* record a message round trip and a timer */
+    trace_reset();
+    trace_enable(TRACE_CAT_ALL);
+
+    msg_t msg = { .type = 0x42 };
+    kernel_pid_t pid = thread_create(_stack, sizeof(_stack),
+                                     THREAD_PRIORITY_MAIN - 1, 0, _echo,
+                                     NULL, "echo");
+
+    msg_send_receive(&msg, &msg, pid);
+    ztimer_sleep(ZTIMER_USEC, 1000);
+
+    trace_export_stdio();
+
     return 0;
 }
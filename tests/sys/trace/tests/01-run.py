@@ -7,6 +7,15 @@ from testrunner import run
 def testfunc(child):
     child.expect(r"n=   0 t=\ +\d+ v=0x00000000\r\n")
     child.expect(r"n=   1 t=\+\ +\d+ v=0x00000001\r\n")
+    child.expect_exact('{"displayTimeUnit":"ns","traceEvents":[')
+    child.expect_exact('"args":{"name":"main"}}')
+    child.expect(r'{"name":"msg_send","ph":"i","s":"t","ts":\d+,"pid":0,'
+                 r'"tid":\d+,"args":{"target":\d+,"type":66}}')
+    child.expect(r'{"name":"running","ph":"B","ts":\d+,"pid":0,"tid":\d+}')
+    child.expect(r'{"name":"msg_recv","ph":"i","s":"t","ts":\d+,"pid":0,'
+                 r'"tid":\d+,"args":{"sender":\d+,"type":66}}')
+    child.expect(r'{"name":"ztimer_fire","ph":"i"')
+    child.expect_exact("]}")
 
 
 if __name__ == "__main__":
@@ -17,10 +17,108 @@
  * @}
  */
 
+#include <fcntl.h>
 #include <stdio.h>
+#include <stdlib.h>
 
+#include "fs/constfs.h"
 #include "shell.h"
+#include "vfs.h"
 #include "vfs_default.h"
+#include "ztimer.h"
+
+#define BENCH_MOUNTS    (8U)
+#define BENCH_ROUNDS    (10000U)
+
+static const uint8_t _bench_data[] = "benchmark";
+
+static const constfs_file_t _bench_files[] = {
+    {
+        .path = "/file",
+        .data = _bench_data,
+        .size = sizeof(_bench_data),
+    },
+};
+
+static const constfs_t _bench_fs = {
+    .files = _bench_files,
+    .nfiles = ARRAY_SIZE(_bench_files),
+};
+
+static const char *_bench_mount_points[BENCH_MOUNTS] = {
+    "/bench0", "/bench1", "/bench2", "/bench3",
+    "/bench4", "/bench5", "/bench6", "/bench7",
+};
+
+static vfs_mount_t _bench_mounts[BENCH_MOUNTS];
+
+static uint32_t _bench_open_close(const char *path, unsigned rounds)
+{
+    uint32_t start = ztimer_now(ZTIMER_USEC);
+
+    for (unsigned i = 0; i < rounds; i++) {
+        int fd = vfs_open(path, O_RDONLY, 0);
+
+        if (fd < 0) {
+            printf("vfs_open(\"%s\") failed: %d\n", path, fd);
+            return 0;
+        }
+        vfs_close(fd);
+    }
+    /* nanoseconds per open and close */
+    return ((uint64_t)(ztimer_now(ZTIMER_USEC) - start) * 1000) / rounds;
+}
+
+static int _vfs_bench(int argc, char **argv)
+{
+    int held[VFS_MAX_OPEN_FILES];
+    unsigned held_numof = 0;
+    unsigned rounds = (argc > 1) ? (unsigned)atoi(argv[1]) : BENCH_ROUNDS;
+
+    if (rounds == 0) {
+        printf("usage: %s [rounds]\n", argv[0]);
+        return 1;
+    }
+    for (unsigned i = 0; i < BENCH_MOUNTS; i++) {
+        _bench_mounts[i] = (vfs_mount_t) {
+            .mount_point = _bench_mount_points[i],
+            .fs = &constfs_file_system,
+            .private_data = (void *)&_bench_fs,
+        };
+        if (vfs_mount(&_bench_mounts[i]) < 0) {
+            printf("mounting %s failed\n", _bench_mount_points[i]);
+            return 1;
+        }
+    }
+
+    /* first and last mounted constfs, with a mostly empty fd table */
+    printf("{ \"path\" : \"/bench0/file\", \"open_fds\" : 0, \"ns\" : %" PRIu32 " }\n",
+           _bench_open_close("/bench0/file", rounds));
+    printf("{ \"path\" : \"/bench7/file\", \"open_fds\" : 0, \"ns\" : %" PRIu32 " }\n",
+           _bench_open_close("/bench7/file", rounds));
+
+    /* with all but one fd in use */
+    for (int fd; (fd = vfs_open("/bench0/file", O_RDONLY, 0)) >= 0;) {
+        held[held_numof++] = fd;
+    }
+    vfs_close(held[--held_numof]);
+    printf("{ \"path\" : \"/bench7/file\", \"open_fds\" : %u, \"ns\" : %" PRIu32 " }\n",
+           held_numof, _bench_open_close("/bench7/file", rounds));
+    while (held_numof) {
+        vfs_close(held[--held_numof]);
+    }
+
+    /* a file system that goes to the host on native */
+    printf("{ \"path\" : \"%s\", \"open_fds\" : 0, \"ns\" : %" PRIu32 " }\n",
+           VFS_DEFAULT_DATA, _bench_open_close(VFS_DEFAULT_DATA, rounds / 10));
+
+    for (unsigned i = 0; i < BENCH_MOUNTS; i++) {
+        vfs_umount(&_bench_mounts[i], false);
+    }
+    return 0;
+}
+
+SHELL_COMMAND(vfs_bench, "measure vfs_open()/vfs_close() overhead", _vfs_bench);
 
 int main(void)
 {
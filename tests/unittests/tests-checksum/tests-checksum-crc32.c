@@ -56,6 +56,19 @@ static void test_checksum_crc32_sequence_4bytes(void)
     TEST_ASSERT_EQUAL_INT(expect, crc32(buf, sizeof(buf)));
 }
 
+static void test_checksum_crc32_sequence_1000bytes(void)
+{
+    static uint8_t buf[1000];
+
+    for (unsigned i = 0; i < sizeof(buf); i++) {
+        buf[i] = i * 7 + 3;
+    }
+
+    TEST_ASSERT_EQUAL_INT(0x17bc2a46, crc32(buf, sizeof(buf)));
+    /* unaligned start and a length that is not a multiple of the block size */
+    TEST_ASSERT_EQUAL_INT(0x05044133, crc32(&buf[1], sizeof(buf) - 4));
+}
+
 Test *tests_checksum_crc32_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
@@ -64,6 +77,7 @@ Test *tests_checksum_crc32_tests(void)
         new_TestFixture(test_checksum_crc32_sequence_256a),
         new_TestFixture(test_checksum_crc32_sequence_1to9),
         new_TestFixture(test_checksum_crc32_sequence_4bytes),
+        new_TestFixture(test_checksum_crc32_sequence_1000bytes),
     };
 
     EMB_UNIT_TESTCALLER(checksum_crc32_tests, NULL, NULL, fixtures);
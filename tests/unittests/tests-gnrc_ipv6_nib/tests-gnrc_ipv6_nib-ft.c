@@ -639,6 +639,153 @@ static void test_nib_ft_del__success(void)
     TEST_ASSERT(!gnrc_ipv6_nib_ft_iter(NULL, 0, &iter_state, &fte));
 }
 
+/*
+ * Tries to replace a route with iface == 0
+ * Expected result: gnrc_ipv6_nib_ft_replace() returns -EINVAL
+ */
+static void test_nib_ft_replace__EINVAL_iface0(void)
+{
+    static const ipv6_addr_t dst = { .u64 = { { .u8 = GLOBAL_PREFIX } } };
+    static const ipv6_addr_t next_hop = { .u64 = { { .u8 = LINK_LOCAL_PREFIX },
+                                                 { .u64 = TEST_UINT64 } } };
+
+    TEST_ASSERT_EQUAL_INT(-EINVAL, gnrc_ipv6_nib_ft_replace(&dst,
+                                                            GLOBAL_PREFIX_LEN,
+                                                            &next_hop, 0, 0));
+}
+
+/*
+ * Creates a route and replaces it with a route to the same destination via
+ * another next hop
+ * Expected result: there should only be one route (via the second next hop)
+ */
+static void test_nib_ft_replace__success_diff_next_hop(void)
+{
+    gnrc_ipv6_nib_ft_t fte;
+    void *iter_state = NULL;
+    static const ipv6_addr_t dst = { .u64 = { { .u8 = GLOBAL_PREFIX } } };
+    ipv6_addr_t next_hop = { .u64 = { { .u8 = LINK_LOCAL_PREFIX },
+                                      { .u64 = TEST_UINT64 } } };
+
+    TEST_ASSERT_EQUAL_INT(0, gnrc_ipv6_nib_ft_add(&dst, GLOBAL_PREFIX_LEN,
+                                                  &next_hop, IFACE, 0));
+    next_hop.u64[1].u64++;
+    TEST_ASSERT_EQUAL_INT(0, gnrc_ipv6_nib_ft_replace(&dst, GLOBAL_PREFIX_LEN,
+                                                      &next_hop, IFACE, 0));
+    TEST_ASSERT(gnrc_ipv6_nib_ft_iter(NULL, 0, &iter_state, &fte));
+    TEST_ASSERT(ipv6_addr_match_prefix(&fte.dst, &dst) >= GLOBAL_PREFIX_LEN);
+    TEST_ASSERT_EQUAL_INT(GLOBAL_PREFIX_LEN, fte.dst_len);
+    TEST_ASSERT(ipv6_addr_equal(&fte.next_hop, &next_hop));
+    TEST_ASSERT_EQUAL_INT(IFACE, fte.iface);
+    TEST_ASSERT(!gnrc_ipv6_nib_ft_iter(NULL, 0, &iter_state, &fte));
+}
+
+/*
+ * Creates a route and replaces it with a route to the same destination via
+ * the same next hop, but on another interface
+ * Expected result: there should only be one route (on the second interface)
+ */
+static void test_nib_ft_replace__success_diff_iface(void)
+{
+    gnrc_ipv6_nib_ft_t fte;
+    void *iter_state = NULL;
+    static const ipv6_addr_t dst = { .u64 = { { .u8 = GLOBAL_PREFIX } } };
+    static const ipv6_addr_t next_hop = { .u64 = { { .u8 = LINK_LOCAL_PREFIX },
+                                                 { .u64 = TEST_UINT64 } } };
+
+    TEST_ASSERT_EQUAL_INT(0, gnrc_ipv6_nib_ft_add(&dst, GLOBAL_PREFIX_LEN,
+                                                  &next_hop, IFACE, 0));
+    TEST_ASSERT_EQUAL_INT(0, gnrc_ipv6_nib_ft_replace(&dst, GLOBAL_PREFIX_LEN,
+                                                      &next_hop, IFACE + 1,
+                                                      0));
+    TEST_ASSERT(gnrc_ipv6_nib_ft_iter(NULL, 0, &iter_state, &fte));
+    TEST_ASSERT(ipv6_addr_equal(&fte.next_hop, &next_hop));
+    TEST_ASSERT_EQUAL_INT(IFACE + 1, fte.iface);
+    TEST_ASSERT(!gnrc_ipv6_nib_ft_iter(NULL, 0, &iter_state, &fte));
+}
+
+/*
+ * Replaces a route twice with the same next hop and interface
+ * Expected result: there should only be one route
+ */
+static void test_nib_ft_replace__success_duplicate(void)
+{
+    gnrc_ipv6_nib_ft_t fte;
+    void *iter_state = NULL;
+    static const ipv6_addr_t dst = { .u64 = { { .u8 = GLOBAL_PREFIX } } };
+    static const ipv6_addr_t next_hop = { .u64 = { { .u8 = LINK_LOCAL_PREFIX },
+                                                 { .u64 = TEST_UINT64 } } };
+
+    TEST_ASSERT_EQUAL_INT(0, gnrc_ipv6_nib_ft_replace(&dst, GLOBAL_PREFIX_LEN,
+                                                      &next_hop, IFACE, 0));
+    TEST_ASSERT_EQUAL_INT(0, gnrc_ipv6_nib_ft_replace(&dst, GLOBAL_PREFIX_LEN,
+                                                      &next_hop, IFACE, 0));
+    TEST_ASSERT(gnrc_ipv6_nib_ft_iter(NULL, 0, &iter_state, &fte));
+    TEST_ASSERT(ipv6_addr_equal(&fte.next_hop, &next_hop));
+    TEST_ASSERT_EQUAL_INT(IFACE, fte.iface);
+    TEST_ASSERT(!gnrc_ipv6_nib_ft_iter(NULL, 0, &iter_state, &fte));
+}
+
+/*
+ * Creates MAX_NUMOF routes with different destinations via the same next hop
+ * and then replaces the route to the first destination via another next hop
+ * Expected result: only the route to the first destination goes via the new
+ * next hop, all others still go via the first next hop
+ */
+static void test_nib_ft_replace__success_other_dst_unchanged(void)
+{
+    gnrc_ipv6_nib_ft_t fte;
+    void *iter_state = NULL;
+    ipv6_addr_t dst = { .u64 = { { .u8 = GLOBAL_PREFIX } } };
+    static const ipv6_addr_t next_hop1 = { .u64 = { { .u8 = LINK_LOCAL_PREFIX },
+                                                  { .u64 = TEST_UINT64 } } };
+    ipv6_addr_t next_hop2 = next_hop1;
+    unsigned count = 0;
+
+    next_hop2.u64[1].u64++;
+    for (unsigned i = 0; i < MAX_NUMOF; i++) {
+        TEST_ASSERT_EQUAL_INT(0, gnrc_ipv6_nib_ft_add(&dst, GLOBAL_PREFIX_LEN,
+                                                      &next_hop1, IFACE, 0));
+        dst.u16[0].u16++;
+    }
+    dst.u16[0].u16 -= MAX_NUMOF;
+    TEST_ASSERT_EQUAL_INT(0, gnrc_ipv6_nib_ft_replace(&dst, GLOBAL_PREFIX_LEN,
+                                                      &next_hop2, IFACE, 0));
+    while (gnrc_ipv6_nib_ft_iter(&next_hop1, 0, &iter_state, &fte)) {
+        TEST_ASSERT(ipv6_addr_match_prefix(&fte.dst, &dst) < GLOBAL_PREFIX_LEN);
+        count++;
+    }
+    TEST_ASSERT_EQUAL_INT(MAX_NUMOF - 1, count);
+    iter_state = NULL;
+    TEST_ASSERT(gnrc_ipv6_nib_ft_iter(&next_hop2, 0, &iter_state, &fte));
+    TEST_ASSERT(ipv6_addr_match_prefix(&fte.dst, &dst) >= GLOBAL_PREFIX_LEN);
+    TEST_ASSERT(!gnrc_ipv6_nib_ft_iter(&next_hop2, 0, &iter_state, &fte));
+}
+
+/*
+ * Creates a default route and replaces it with a default route via another
+ * next hop
+ * Expected result: there should only be one default route (via the second
+ * next hop)
+ */
+static void test_nib_ft_replace__success_dr(void)
+{
+    gnrc_ipv6_nib_ft_t fte;
+    void *iter_state = NULL;
+    ipv6_addr_t next_hop = { .u64 = { { .u8 = LINK_LOCAL_PREFIX },
+                                      { .u64 = TEST_UINT64 } } };
+
+    TEST_ASSERT_EQUAL_INT(0, gnrc_ipv6_nib_ft_add(NULL, 0, &next_hop, IFACE, 0));
+    next_hop.u64[1].u64++;
+    TEST_ASSERT_EQUAL_INT(0, gnrc_ipv6_nib_ft_replace(NULL, 0, &next_hop,
+                                                      IFACE, 0));
+    TEST_ASSERT(gnrc_ipv6_nib_ft_iter(NULL, 0, &iter_state, &fte));
+    TEST_ASSERT(ipv6_addr_is_unspecified(&fte.dst));
+    TEST_ASSERT(ipv6_addr_equal(&fte.next_hop, &next_hop));
+    TEST_ASSERT_EQUAL_INT(1, fte.primary);
+    TEST_ASSERT(!gnrc_ipv6_nib_ft_iter(NULL, 0, &iter_state, &fte));
+}
+
 /**
  * Creates three default routes and removes the first one.
  * The prefix list is then iterated.
@@ -746,6 +893,12 @@ Test *tests_gnrc_ipv6_nib_ft_tests(void)
         new_TestFixture(test_nib_ft_add__success_overwrite_unspecified),
         new_TestFixture(test_nib_ft_add__success),
         new_TestFixture(test_nib_ft_add__success_dr),
+        new_TestFixture(test_nib_ft_replace__EINVAL_iface0),
+        new_TestFixture(test_nib_ft_replace__success_diff_next_hop),
+        new_TestFixture(test_nib_ft_replace__success_diff_iface),
+        new_TestFixture(test_nib_ft_replace__success_duplicate),
+        new_TestFixture(test_nib_ft_replace__success_other_dst_unchanged),
+        new_TestFixture(test_nib_ft_replace__success_dr),
         new_TestFixture(test_nib_ft_del__unknown),
         new_TestFixture(test_nib_ft_del__success),
         /* most of gnrc_ipv6_nib_ft_iter() is tested during all the tests above */
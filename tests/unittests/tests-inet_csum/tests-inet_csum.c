@@ -13,6 +13,7 @@
  */
 #include <errno.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include "embUnit.h"
 
@@ -165,6 +166,71 @@ static void test_inet_csum__empty_app_buffer(void)
     TEST_ASSERT_EQUAL_INT(hdr_expected, pyld_sum);
 }
 
+static uint16_t _bytewise_csum(uint16_t sum, const uint8_t *buf, uint16_t len)
+{
+    uint32_t csum = sum;
+
+    for (unsigned i = 0; i < len; i++) {
+        csum += (i & 1) ? buf[i] : (uint16_t)(buf[i] << 8);
+    }
+    while (csum >> 16) {
+        csum = (csum & 0xffff) + (csum >> 16);
+    }
+    return csum;
+}
+
+static void test_inet_csum__unaligned_words(void)
+{
+    uint8_t data[80];
+
+    for (unsigned i = 0; i < sizeof(data); i++) {
+        /* many 0xff to provoke carries in wide accumulators */
+        data[i] = (i % 3) ? 0xff : (uint8_t)(i * 37);
+    }
+    /* check all combinations of buffer alignment and trailing bytes */
+    for (unsigned offset = 0; offset < 8; offset++) {
+        for (unsigned len = 0; len <= (sizeof(data) - offset); len++) {
+            TEST_ASSERT_EQUAL_INT(_bytewise_csum(0x1234, &data[offset], len),
+                                  inet_csum(0x1234, &data[offset], len));
+        }
+    }
+}
+
+static void test_inet_csum__update16(void)
+{
+    /* IPv4 header from test_inet_csum__calculate_csum() with checksum */
+    uint8_t data[] = {
+        0x45, 0x00, 0x00, 0x73, 0x00, 0x00, 0x40, 0x00,
+        0x40, 0x11, 0xb8, 0x61, 0xc0, 0xa8, 0x00, 0x01,
+        0xc0, 0xa8, 0x00, 0xc7,
+    };
+
+    /* decrement TTL */
+    data[8]--;
+    TEST_ASSERT_EQUAL_INT(0xb961, inet_csum_update16(0xb861, 0x4011, 0x3f11));
+    data[10] = 0xb9;
+    TEST_ASSERT_EQUAL_INT(0xffff, inet_csum(0, data, sizeof(data)));
+}
+
+static void test_inet_csum__update(void)
+{
+    /* IPv4 header from test_inet_csum__calculate_csum() with checksum */
+    uint8_t data[] = {
+        0x45, 0x00, 0x00, 0x73, 0x00, 0x00, 0x40, 0x00,
+        0x40, 0x11, 0xb8, 0x61, 0xc0, 0xa8, 0x00, 0x01,
+        0xc0, 0xa8, 0x00, 0xc7,
+    };
+    const uint8_t new_dst[] = { 0x0a, 0x00, 0xff, 0xfe };
+    uint16_t csum;
+
+    /* rewrite destination address */
+    csum = inet_csum_update(0xb861, &data[16], new_dst, sizeof(new_dst));
+    memcpy(&data[16], new_dst, sizeof(new_dst));
+    data[10] = csum >> 8;
+    data[11] = csum & 0xff;
+    TEST_ASSERT_EQUAL_INT(0xffff, inet_csum(0, data, sizeof(data)));
+}
+
 Test *tests_inet_csum_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
@@ -176,6 +242,9 @@ Test *tests_inet_csum_tests(void)
         new_TestFixture(test_inet_csum__odd_len),
         new_TestFixture(test_inet_csum__two_app_snips),
         new_TestFixture(test_inet_csum__empty_app_buffer),
+        new_TestFixture(test_inet_csum__unaligned_words),
+        new_TestFixture(test_inet_csum__update16),
+        new_TestFixture(test_inet_csum__update),
     };
 
     EMB_UNIT_TESTCALLER(inet_csum_tests, NULL, NULL, fixtures);
@@ -0,0 +1,168 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ */
+#include <stdint.h>
+#include <string.h>
+
+#include "embUnit/embUnit.h"
+
+#include "lfrb.h"
+#include "tests-lfrb.h"
+
+#define BUFFER_SIZE         (8)
+
+/* odd size, to catch mixing up element and byte counts */
+typedef struct {
+    uint8_t data[3];
+} elem_t;
+
+static elem_t _buf[BUFFER_SIZE];
+static elem_t _io[BUFFER_SIZE * 2];
+static elem_t _out[BUFFER_SIZE * 2];
+static lfrb_t _rb = LFRB_INIT(_buf);
+
+static atomic_uint _seq[BUFFER_SIZE];
+static lfrb_mpmc_t _mpmc;
+
+static void set_up(void)
+{
+    for (unsigned i = 0; i < ARRAY_SIZE(_io); i++) {
+        memset(&_io[i], i + 1, sizeof(_io[i]));
+    }
+    memset(_out, 0, sizeof(_out));
+    memset(_buf, 0, sizeof(_buf));
+    lfrb_init(&_rb, _buf, BUFFER_SIZE, sizeof(elem_t));
+    lfrb_mpmc_init(&_mpmc, _buf, _seq, BUFFER_SIZE, sizeof(elem_t));
+}
+
+static void test_init(void)
+{
+    TEST_ASSERT_EQUAL_INT(BUFFER_SIZE, _rb.size);
+    TEST_ASSERT_EQUAL_INT(sizeof(elem_t), _rb.elem_size);
+    TEST_ASSERT(lfrb_empty(&_rb));
+    TEST_ASSERT_EQUAL_INT(BUFFER_SIZE, lfrb_free(&_rb));
+}
+
+static void test_add_one_get_one(void)
+{
+    elem_t elem;
+
+    TEST_ASSERT_EQUAL_INT(-1, lfrb_get_one(&_rb, &elem));
+    for (int i = 0; i < BUFFER_SIZE; i++) {
+        TEST_ASSERT_EQUAL_INT(0, lfrb_add_one(&_rb, &_io[i]));
+        TEST_ASSERT_EQUAL_INT(i + 1, lfrb_avail(&_rb));
+    }
+    TEST_ASSERT(lfrb_full(&_rb));
+    TEST_ASSERT_EQUAL_INT(-1, lfrb_add_one(&_rb, &_io[0]));
+    for (int i = 0; i < BUFFER_SIZE; i++) {
+        TEST_ASSERT_EQUAL_INT(0, lfrb_get_one(&_rb, &elem));
+        TEST_ASSERT_EQUAL_INT(0, memcmp(&elem, &_io[i], sizeof(elem)));
+    }
+    TEST_ASSERT(lfrb_empty(&_rb));
+}
+
+static void test_add_get_partial(void)
+{
+    TEST_ASSERT_EQUAL_INT(0, lfrb_add(&_rb, _io, 0));
+    TEST_ASSERT_EQUAL_INT(BUFFER_SIZE, lfrb_add(&_rb, _io, ARRAY_SIZE(_io)));
+    TEST_ASSERT_EQUAL_INT(0, lfrb_add(&_rb, _io, 1));
+    TEST_ASSERT_EQUAL_INT(BUFFER_SIZE, lfrb_get(&_rb, _out, ARRAY_SIZE(_out)));
+    TEST_ASSERT_EQUAL_INT(0, memcmp(_out, _io, BUFFER_SIZE * sizeof(elem_t)));
+    TEST_ASSERT_EQUAL_INT(0, lfrb_get(&_rb, _out, 1));
+}
+
+static void test_wrap_around(void)
+{
+    /* move the start to the middle of the buffer */
+    TEST_ASSERT_EQUAL_INT(5, lfrb_add(&_rb, _io, 5));
+    TEST_ASSERT_EQUAL_INT(5, lfrb_drop(&_rb, 5));
+
+    TEST_ASSERT_EQUAL_INT(BUFFER_SIZE, lfrb_add(&_rb, _io, BUFFER_SIZE));
+    TEST_ASSERT_EQUAL_INT(BUFFER_SIZE, lfrb_peek(&_rb, _out, BUFFER_SIZE));
+    TEST_ASSERT_EQUAL_INT(0, memcmp(_out, _io, BUFFER_SIZE * sizeof(elem_t)));
+    TEST_ASSERT_EQUAL_INT(BUFFER_SIZE, lfrb_avail(&_rb));
+
+    memset(_out, 0, sizeof(_out));
+    TEST_ASSERT_EQUAL_INT(3, lfrb_get(&_rb, _out, 3));
+    TEST_ASSERT_EQUAL_INT(BUFFER_SIZE - 3,
+                          lfrb_get(&_rb, &_out[3], BUFFER_SIZE));
+    TEST_ASSERT_EQUAL_INT(0, memcmp(_out, _io, BUFFER_SIZE * sizeof(elem_t)));
+}
+
+static void test_drop(void)
+{
+    TEST_ASSERT_EQUAL_INT(4, lfrb_add(&_rb, _io, 4));
+    TEST_ASSERT_EQUAL_INT(2, lfrb_drop(&_rb, 2));
+    TEST_ASSERT_EQUAL_INT(2, lfrb_drop(&_rb, 4));
+    TEST_ASSERT(lfrb_empty(&_rb));
+}
+
+static void test_counter_overflow(void)
+{
+    _rb.reads = UINT32_MAX - 2;
+    _rb.writes = UINT32_MAX - 2;
+
+    TEST_ASSERT_EQUAL_INT(BUFFER_SIZE, lfrb_add(&_rb, _io, ARRAY_SIZE(_io)));
+    TEST_ASSERT(lfrb_full(&_rb));
+    TEST_ASSERT_EQUAL_INT(BUFFER_SIZE, lfrb_get(&_rb, _out, ARRAY_SIZE(_out)));
+    TEST_ASSERT_EQUAL_INT(0, memcmp(_out, _io, BUFFER_SIZE * sizeof(elem_t)));
+}
+
+static void test_mpmc_add_get(void)
+{
+    TEST_ASSERT_EQUAL_INT(0, lfrb_mpmc_get(&_mpmc, _out, 1));
+    TEST_ASSERT_EQUAL_INT(3, lfrb_mpmc_add(&_mpmc, _io, 3));
+    TEST_ASSERT_EQUAL_INT(3, lfrb_mpmc_avail(&_mpmc));
+    TEST_ASSERT_EQUAL_INT(BUFFER_SIZE - 3,
+                          lfrb_mpmc_add(&_mpmc, &_io[3], ARRAY_SIZE(_io)));
+    TEST_ASSERT_EQUAL_INT(0, lfrb_mpmc_add(&_mpmc, _io, 1));
+    TEST_ASSERT_EQUAL_INT(BUFFER_SIZE,
+                          lfrb_mpmc_get(&_mpmc, _out, ARRAY_SIZE(_out)));
+    TEST_ASSERT_EQUAL_INT(0, memcmp(_out, _io, BUFFER_SIZE * sizeof(elem_t)));
+    TEST_ASSERT_EQUAL_INT(0, lfrb_mpmc_avail(&_mpmc));
+}
+
+static void test_mpmc_wrap_around(void)
+{
+    for (unsigned round = 0; round < 3; round++) {
+        memset(_out, 0, sizeof(_out));
+        TEST_ASSERT_EQUAL_INT(5, lfrb_mpmc_add(&_mpmc, _io, 5));
+        TEST_ASSERT_EQUAL_INT(2, lfrb_mpmc_get(&_mpmc, _out, 2));
+        TEST_ASSERT_EQUAL_INT(3, lfrb_mpmc_get(&_mpmc, &_out[2], 4));
+        TEST_ASSERT_EQUAL_INT(0, memcmp(_out, _io, 5 * sizeof(elem_t)));
+    }
+}
+
+static Test *tests_lfrb_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_init),
+        new_TestFixture(test_add_one_get_one),
+        new_TestFixture(test_add_get_partial),
+        new_TestFixture(test_wrap_around),
+        new_TestFixture(test_drop),
+        new_TestFixture(test_counter_overflow),
+        new_TestFixture(test_mpmc_add_get),
+        new_TestFixture(test_mpmc_wrap_around),
+    };
+
+    EMB_UNIT_TESTCALLER(lfrb_tests, set_up, NULL, fixtures);
+
+    return (Test *)&lfrb_tests;
+}
+
+void tests_lfrb(void)
+{
+    TESTS_RUN(tests_lfrb_tests());
+}
+/** @} */
@@ -0,0 +1,192 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ */
+#include <stdint.h>
+#include <string.h>
+
+#include "embUnit/embUnit.h"
+
+#include "container.h"
+#include "objpool.h"
+#include "sched.h"
+#include "thread.h"
+#include "tests-objpool.h"
+
+#define NUM_OBJS            (8)
+
+/* odd size, so objects are not aligned */
+typedef struct {
+    uint8_t data[sizeof(void *) + 1];
+} obj_t;
+
+static obj_t _objs[NUM_OBJS];
+static objpool_t _pool;
+static objpool_cache_t _caches[MAXTHREADS];
+
+static void set_up(void)
+{
+    memset(_objs, 0xff, sizeof(_objs));
+    objpool_init(&_pool, _objs, sizeof(obj_t), NUM_OBJS);
+}
+
+static int _in_pool(void *ptr)
+{
+    return ((uint8_t *)ptr >= (uint8_t *)_objs) &&
+           ((uint8_t *)ptr < (uint8_t *)&_objs[NUM_OBJS]) &&
+           ((((uint8_t *)ptr - (uint8_t *)_objs) % sizeof(obj_t)) == 0);
+}
+
+static void test_alloc_free(void)
+{
+    obj_t *objs[NUM_OBJS];
+
+    TEST_ASSERT_EQUAL_INT(NUM_OBJS, objpool_available(&_pool));
+    for (unsigned i = 0; i < NUM_OBJS; i++) {
+        objs[i] = objpool_alloc(&_pool);
+        TEST_ASSERT(_in_pool(objs[i]));
+        for (unsigned j = 0; j < i; j++) {
+            TEST_ASSERT(objs[i] != objs[j]);
+        }
+        /* overwrite the link */
+        memset(objs[i], i, sizeof(obj_t));
+    }
+    TEST_ASSERT_NULL(objpool_alloc(&_pool));
+    TEST_ASSERT_EQUAL_INT(0, objpool_available(&_pool));
+
+    for (unsigned i = 0; i < NUM_OBJS; i++) {
+        objpool_free(&_pool, objs[i]);
+        TEST_ASSERT_EQUAL_INT(i + 1, objpool_available(&_pool));
+    }
+    /* LIFO */
+    TEST_ASSERT(objpool_alloc(&_pool) == objs[NUM_OBJS - 1]);
+}
+
+static void test_calloc(void)
+{
+    static const obj_t zero;
+    obj_t *obj = objpool_calloc(&_pool);
+
+    TEST_ASSERT_NOT_NULL(obj);
+    TEST_ASSERT_EQUAL_INT(0, memcmp(obj, &zero, sizeof(zero)));
+}
+
+static void test_tag(void)
+{
+    uint_least32_t head;
+    obj_t *a = objpool_alloc(&_pool);
+    obj_t *b = objpool_alloc(&_pool);
+
+    objpool_free(&_pool, b);
+    objpool_free(&_pool, a);
+    head = atomic_load(&_pool.head);
+    /* same object at the head as after init, but a different tag */
+    TEST_ASSERT(objpool_alloc(&_pool) == a);
+    objpool_free(&_pool, a);
+    TEST_ASSERT(head != atomic_load(&_pool.head));
+    TEST_ASSERT_EQUAL_INT(head & 0xffff, atomic_load(&_pool.head) & 0xffff);
+}
+
+static void test_stats(void)
+{
+    objpool_stats_t stats;
+    void *objs[NUM_OBJS];
+
+    for (unsigned i = 0; i < NUM_OBJS; i++) {
+        objs[i] = objpool_alloc(&_pool);
+    }
+    TEST_ASSERT_NULL(objpool_alloc(&_pool));
+    TEST_ASSERT_NULL(objpool_alloc(&_pool));
+    for (unsigned i = 0; i < NUM_OBJS / 2; i++) {
+        objpool_free(&_pool, objs[i]);
+    }
+
+    objpool_get_stats(&_pool, &stats);
+    TEST_ASSERT_EQUAL_INT(NUM_OBJS / 2, stats.in_use);
+    TEST_ASSERT_EQUAL_INT(NUM_OBJS, stats.high_water);
+    TEST_ASSERT_EQUAL_INT(2, stats.failures);
+
+    objpool_reset_stats(&_pool);
+    objpool_get_stats(&_pool, &stats);
+    TEST_ASSERT_EQUAL_INT(NUM_OBJS / 2, stats.high_water);
+    TEST_ASSERT_EQUAL_INT(0, stats.failures);
+}
+
+static void test_cache(void)
+{
+    objpool_cache_t *cache = &_caches[thread_getpid() - KERNEL_PID_FIRST];
+    void *objs[NUM_OBJS];
+
+    objpool_cache_init(&_pool, _caches);
+    for (unsigned i = 0; i < NUM_OBJS; i++) {
+        objs[i] = objpool_alloc(&_pool);
+        TEST_ASSERT_NOT_NULL(objs[i]);
+    }
+
+    /* freed objects stay in the cache of the thread */
+    objpool_free(&_pool, objs[0]);
+    TEST_ASSERT_EQUAL_INT(1, cache->num);
+    TEST_ASSERT_EQUAL_INT(0, atomic_load(&_pool.head) & 0xffff);
+    TEST_ASSERT_EQUAL_INT(1, objpool_available(&_pool));
+    TEST_ASSERT(objpool_alloc(&_pool) == objs[0]);
+    TEST_ASSERT_EQUAL_INT(0, cache->num);
+
+    /* half of a full cache goes back to the shared list */
+    for (unsigned i = 0; i < CONFIG_OBJPOOL_CACHE_SIZE + 1; i++) {
+        objpool_free(&_pool, objs[i]);
+    }
+    TEST_ASSERT_EQUAL_INT(CONFIG_OBJPOOL_CACHE_SIZE + 1 -
+                          (CONFIG_OBJPOOL_CACHE_SIZE + 1) / 2, cache->num);
+    TEST_ASSERT_EQUAL_INT(CONFIG_OBJPOOL_CACHE_SIZE + 1,
+                          objpool_available(&_pool));
+
+    objpool_cache_flush(&_pool);
+    TEST_ASSERT_EQUAL_INT(0, cache->num);
+    TEST_ASSERT_EQUAL_INT(CONFIG_OBJPOOL_CACHE_SIZE + 1,
+                          objpool_available(&_pool));
+    for (unsigned i = CONFIG_OBJPOOL_CACHE_SIZE + 1; i < NUM_OBJS; i++) {
+        objpool_free(&_pool, objs[i]);
+    }
+    objpool_cache_flush(&_pool);
+    TEST_ASSERT_EQUAL_INT(NUM_OBJS, objpool_available(&_pool));
+
+    /* all objects are still distinct */
+    for (unsigned i = 0; i < NUM_OBJS; i++) {
+        objs[i] = objpool_alloc(&_pool);
+        TEST_ASSERT(_in_pool(objs[i]));
+        for (unsigned j = 0; j < i; j++) {
+            TEST_ASSERT(objs[i] != objs[j]);
+        }
+    }
+    TEST_ASSERT_NULL(objpool_alloc(&_pool));
+}
+
+static Test *tests_objpool_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_alloc_free),
+        new_TestFixture(test_calloc),
+        new_TestFixture(test_tag),
+        new_TestFixture(test_stats),
+        new_TestFixture(test_cache),
+    };
+
+    EMB_UNIT_TESTCALLER(objpool_tests, set_up, NULL, fixtures);
+
+    return (Test *)&objpool_tests;
+}
+
+void tests_objpool(void)
+{
+    TESTS_RUN(tests_objpool_tests());
+}
+/** @} */
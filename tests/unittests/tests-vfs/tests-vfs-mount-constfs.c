@@ -67,6 +67,18 @@ static vfs_mount_t _test_vfs_mount = {
     .private_data = (void *)&fs_data,
 };
 
+static vfs_mount_t _test_vfs_mount_nested = {
+    .mount_point = "/test/nested",
+    .fs = &constfs_file_system,
+    .private_data = (void *)&fs_data,
+};
+
+static vfs_mount_t _test_vfs_mount_sibling = {
+    .mount_point = "/test2",
+    .fs = &constfs_file_system,
+    .private_data = (void *)&fs_data,
+};
+
 static void test_vfs_mount_umount(void)
 {
     int res;
@@ -128,6 +140,36 @@ static void test_vfs_constfs_open(void)
     TEST_ASSERT_EQUAL_INT(0, res);
 }
 
+static void test_vfs_mount__longest_prefix(void)
+{
+    TEST_ASSERT_EQUAL_INT(0, vfs_mount(&_test_vfs_mount_nested));
+    TEST_ASSERT_EQUAL_INT(0, vfs_mount(&_test_vfs_mount));
+    TEST_ASSERT_EQUAL_INT(0, vfs_mount(&_test_vfs_mount_sibling));
+
+    int fd = vfs_open("/test/nested/test.txt", O_RDONLY, 0);
+    TEST_ASSERT(fd >= 0);
+    TEST_ASSERT(vfs_file_get(fd)->mp == &_test_vfs_mount_nested);
+    TEST_ASSERT_EQUAL_INT(0, vfs_close(fd));
+
+    fd = vfs_open("/test/test.txt", O_RDONLY, 0);
+    TEST_ASSERT(fd >= 0);
+    TEST_ASSERT(vfs_file_get(fd)->mp == &_test_vfs_mount);
+    TEST_ASSERT_EQUAL_INT(0, vfs_close(fd));
+
+    fd = vfs_open("/test2/test.txt", O_RDONLY, 0);
+    TEST_ASSERT(fd >= 0);
+    TEST_ASSERT(vfs_file_get(fd)->mp == &_test_vfs_mount_sibling);
+    TEST_ASSERT_EQUAL_INT(0, vfs_close(fd));
+
+    /* after unmounting, the parent mount point is used */
+    TEST_ASSERT_EQUAL_INT(0, vfs_umount(&_test_vfs_mount_nested, false));
+    fd = vfs_open("/test/nested/test.txt", O_RDONLY, 0);
+    TEST_ASSERT_EQUAL_INT(-ENOENT, fd);
+
+    TEST_ASSERT_EQUAL_INT(0, vfs_umount(&_test_vfs_mount_sibling, false));
+    TEST_ASSERT_EQUAL_INT(0, vfs_umount(&_test_vfs_mount, false));
+}
+
 static void test_vfs_constfs_read_lseek(void)
 {
     int res;
@@ -173,6 +215,84 @@ static void test_vfs_constfs_read_lseek(void)
     TEST_ASSERT_EQUAL_INT(0, res);
 }
 
+static void test_vfs_constfs_read_extent(void)
+{
+    int res;
+    res = vfs_mount(&_test_vfs_mount);
+    TEST_ASSERT_EQUAL_INT(0, res);
+
+    int fd = vfs_open("/test/data.bin", O_RDONLY, 0);
+    TEST_ASSERT(fd >= 0);
+
+    const void *data;
+    ssize_t nbytes;
+    nbytes = vfs_read_extent(fd, &data, 8);
+    TEST_ASSERT_EQUAL_INT(8, nbytes);
+    TEST_ASSERT(data == &bin_data[0]);
+
+    /* the extent ends with the file */
+    nbytes = vfs_read_extent(fd, &data, sizeof(bin_data));
+    TEST_ASSERT_EQUAL_INT(sizeof(bin_data) - 8, nbytes);
+    TEST_ASSERT(data == &bin_data[8]);
+
+    nbytes = vfs_read_extent(fd, &data, sizeof(bin_data));
+    TEST_ASSERT_EQUAL_INT(0, nbytes);
+
+    res = vfs_close(fd);
+    TEST_ASSERT_EQUAL_INT(0, res);
+
+    res = vfs_umount(&_test_vfs_mount, false);
+    TEST_ASSERT_EQUAL_INT(0, res);
+}
+
+static const void *_sent_base;
+static size_t _sent_len;
+
+static ssize_t _send(void *arg, const iolist_t *data)
+{
+    size_t max = *(size_t *)arg;
+
+    _sent_base = data->iol_base;
+    _sent_len += data->iol_len;
+    return data->iol_len < max ? data->iol_len : max;
+}
+
+static void test_vfs_constfs_sendfile(void)
+{
+    int res;
+    res = vfs_mount(&_test_vfs_mount);
+    TEST_ASSERT_EQUAL_INT(0, res);
+
+    int fd = vfs_open("/test/data.bin", O_RDONLY, 0);
+    TEST_ASSERT(fd >= 0);
+
+    /* the file contents are passed on without copying them */
+    size_t max = SIZE_MAX;
+    ssize_t nbytes;
+    _sent_len = 0;
+    nbytes = vfs_sendfile(fd, _send, &max, 16, NULL, 0);
+    TEST_ASSERT_EQUAL_INT(16, nbytes);
+    TEST_ASSERT_EQUAL_INT(16, _sent_len);
+    TEST_ASSERT(_sent_base == &bin_data[0]);
+
+    /* the position is behind the last byte actually sent */
+    max = 4;
+    nbytes = vfs_sendfile(fd, _send, &max, sizeof(bin_data), NULL, 0);
+    TEST_ASSERT_EQUAL_INT(4, nbytes);
+    TEST_ASSERT(_sent_base == &bin_data[16]);
+    TEST_ASSERT_EQUAL_INT(20, vfs_lseek(fd, 0, SEEK_CUR));
+
+    max = SIZE_MAX;
+    nbytes = vfs_sendfile(fd, _send, &max, sizeof(bin_data), NULL, 0);
+    TEST_ASSERT_EQUAL_INT(sizeof(bin_data) - 20, nbytes);
+
+    res = vfs_close(fd);
+    TEST_ASSERT_EQUAL_INT(0, res);
+
+    res = vfs_umount(&_test_vfs_mount, false);
+    TEST_ASSERT_EQUAL_INT(0, res);
+}
+
 #if MODULE_NEWLIB || MODULE_PICOLIBC || defined(CPU_NATIVE)
 static void test_vfs_constfs__posix(void)
 {
@@ -211,7 +331,10 @@ Test *tests_vfs_mount_constfs_tests(void)
         new_TestFixture(test_vfs_mount__invalid),
         new_TestFixture(test_vfs_umount__invalid_mount),
         new_TestFixture(test_vfs_constfs_open),
+        new_TestFixture(test_vfs_mount__longest_prefix),
         new_TestFixture(test_vfs_constfs_read_lseek),
+        new_TestFixture(test_vfs_constfs_read_extent),
+        new_TestFixture(test_vfs_constfs_sendfile),
 #if MODULE_NEWLIB || MODULE_PICOLIBC || defined(CPU_NATIVE)
         new_TestFixture(test_vfs_constfs__posix),
 #endif